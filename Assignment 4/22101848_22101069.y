@@ -1,8 +1,14 @@
 %{
 
+#include "arena.h"
+#include "source_buffer.h"
+#include "output_file.h"
 #include "symbol_table.h"
 #include "ast.h"
 #include "three_addr_code.h"
+#include "cfg.h"
+#include "optimizer.h"
+#include "vm.h"
 #include <iostream>
 #include <fstream>
 #include <string>
@@ -12,41 +18,104 @@
 /* Type definition for all grammar symbols */
 #define YYSTYPE symbol_info*
 
-extern FILE *yyin;
 int yyparse(void);
 int yylex(void);
+void scan_source_buffer(char *base, size_t size);
 extern YYSTYPE yylval;
 
-symbol_table *sym_tbl = new symbol_table();
-ProgramNode* program_root = new ProgramNode();
+name_table names; // identifier spellings, constructed before anything that interns
+arena parse_arena; // owns every semantic value and AST node of the compilation
+symbol_table *sym_tbl = new symbol_table(parse_arena);
+ProgramNode* program_root = NULL;
 
 int line_count = 1;
 int error_count = 0;
-ofstream log_file, error_file, code_file;
+output_file log_file, error_file, code_file; // buffered, written out at phase boundaries
 
-string variable_list=""; //for variable declaration tracking
-vector<string>parameter_types; //for parameter types in func dec and def
-vector<string>parameter_names; //for func def parameter names	
-vector<string>argument_types; //to store types of function arguments
+// How much goes to log.txt, chosen with --log-level: errors only, plus the grammar
+// rule trace, or everything (the rule trace with the source text of each reduction,
+// scope events and symbol table dumps)
+enum log_level { LOG_NONE, LOG_ERRORS, LOG_RULES, LOG_FULL };
+log_level log_verbosity = LOG_FULL;
+
+// Highest level compiled in; building with e.g. -DMAX_LOG_LEVEL=LOG_ERRORS removes the
+// tracing code altogether
+#ifndef MAX_LOG_LEVEL
+#define MAX_LOG_LEVEL LOG_FULL
+#endif
+
+#define LOG_ENABLED(level) ((level) <= MAX_LOG_LEVEL && (level) <= log_verbosity)
+// Log statement prefix, LOG_AT(level)<<...; nothing after it is evaluated when the level is off
+#define LOG_AT(level) if(!LOG_ENABLED(level)) {} else log_file
+
+vector<pair<uint32_t,int>>declared_variables; //names and array sizes (0 for regular vars) of the declaration being parsed
+vector<data_type>parameter_types; //for parameter types in func dec and def
+vector<uint32_t>parameter_names; //for func def parameter names	
+uint32_t null_name = names.intern("_null_"); //name of a parameter given without one
+vector<data_type>argument_types; //to store types of function arguments
 
 int inside_function = 0; //is compound statement inside function definition
 
-string return_data_type, function_name, function_return_type;
+data_type return_data_type, function_return_type;
+uint32_t function_name = names.intern("");
+
+// Source text of a grammar symbol, rendered from its AST node when the log needs it
+const ASTNode& source_of(symbol_info *sym)
+{
+	return *sym->get_ast_node();
+}
+
+// Source text of a statement list, without the braces of the enclosing block
+string statements_of(symbol_info *sym)
+{
+	string text;
+	((BlockNode*)sym->get_ast_node())->print_statements(text);
+	return text;
+}
+
+// Writes the parameters collected so far as "type name,type name"
+void print_parameter_list(ostream& out)
+{
+	for(size_t i = 0; i < parameter_types.size(); i++)
+	{
+		if(i != 0) out<<",";
+		out<<type_name(parameter_types[i]);
+		if(parameter_names[i] != null_name) out<<" "<<names.get_name(parameter_names[i]);
+	}
+}
+
+// Writes the variables declared so far as "name,name[size]"
+void print_variable_list(ostream& out)
+{
+	for(size_t i = 0; i < declared_variables.size(); i++)
+	{
+		if(i != 0) out<<",";
+		out<<names.get_name(declared_variables[i].first);
+		if(declared_variables[i].second != 0) out<<"["<<declared_variables[i].second<<"]";
+	}
+}
 
-void yyerror(char *s)
+// True when the operand is the literal 0 as written (used for division/modulus by zero)
+bool is_zero_literal(symbol_info *sym)
 {
-	log_file<<"At line "<<line_count<<" "<<s<<endl<<endl;
+	ConstNode* const_node = dynamic_cast<ConstNode*>(sym->get_ast_node());
+	return const_node && const_node->get_parens() == 0 && const_node->get_value() == "0";
+}
+
+void yyerror(const char *s)
+{
+	LOG_AT(LOG_ERRORS)<<"At line "<<line_count<<" "<<s<<endl<<endl;
 	error_file<<"At line "<<line_count<<" "<<s<<endl<<endl;
 	error_count++;
 	
-	variable_list = "";
+	declared_variables.clear();
 	parameter_types.clear();
 	parameter_names.clear();
 	argument_types.clear();
 	inside_function = 0;
-	return_data_type = "";
-	function_name = "";
-	function_return_type = "";
+	return_data_type = TYPE_NONE;
+	function_name = names.intern("");
+	function_return_type = TYPE_NONE;
 }
 
 %}
@@ -61,10 +130,12 @@ void yyerror(char *s)
 
 start : program
 	{
-		log_file<<"At line no: "<<line_count<<" start : program "<<endl<<endl;
-		log_file<<"Symbol Table"<<endl<<endl;
-		
-		sym_tbl->Print_all_scope(log_file);
+		LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" start : program "<<endl<<endl;
+		if(LOG_ENABLED(LOG_FULL))
+		{
+			log_file<<"Symbol Table"<<endl<<endl;
+			sym_tbl->Print_all_scope(log_file);
+		}
 		
 		$$ = $1;
 		// Set root of AST to the program node
@@ -74,17 +145,17 @@ start : program
 
 program : program unit
 	{
-		log_file<<"At line no: "<<line_count<<" program : program unit "<<endl<<endl;
-		log_file<<$1->getname()+"\n"+$2->getname()<<endl<<endl;
+		LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" program : program unit "<<endl<<endl;
+		LOG_AT(LOG_FULL)<<source_of($1)<<"\n"<<source_of($2)<<endl<<endl;
 		
-		$$ = new symbol_info($1->getname()+"\n"+$2->getname(),"program");
+		$$ = parse_arena.make<symbol_info>("","program");
 		
 		// Build/update AST node for program
 		ProgramNode* prog_node;
 		if($1->get_ast_node()) {
 			prog_node = (ProgramNode*)$1->get_ast_node();
 		} else {
-			prog_node = new ProgramNode();
+			prog_node = parse_arena.make<ProgramNode>();
 		}
 		
 		// Append the unit to the program
@@ -96,13 +167,13 @@ program : program unit
 	}
 	| unit
 	{
-		log_file<<"At line no: "<<line_count<<" program : unit "<<endl<<endl;
-		log_file<<$1->getname()<<endl<<endl;
+		LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" program : unit "<<endl<<endl;
+		LOG_AT(LOG_FULL)<<source_of($1)<<endl<<endl;
 		
-		$$ = new symbol_info($1->getname(),"program");
+		$$ = parse_arena.make<symbol_info>("","program");
 		
 		// Build AST node for program with a single unit
-		ProgramNode* prog_node = new ProgramNode();
+		ProgramNode* prog_node = parse_arena.make<ProgramNode>();
 		if($1->get_ast_node()) {
 			prog_node->add_unit($1->get_ast_node());
 		}
@@ -112,41 +183,39 @@ program : program unit
 
 unit : var_declaration
 	 {
-		log_file<<"At line no: "<<line_count<<" unit : var_declaration "<<endl<<endl;
-		log_file<<$1->getname()<<endl<<endl;
+		LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" unit : var_declaration "<<endl<<endl;
+		LOG_AT(LOG_FULL)<<source_of($1)<<endl<<endl;
 		
-		$$ = new symbol_info($1->getname(),"unit");
+		$$ = parse_arena.make<symbol_info>("","unit");
 		$$->set_ast_node($1->get_ast_node());
 	 }
      | func_definition
      {
-		log_file<<"At line no: "<<line_count<<" unit : func_definition "<<endl<<endl;
-		log_file<<$1->getname()<<endl<<endl;
+		LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" unit : func_definition "<<endl<<endl;
+		LOG_AT(LOG_FULL)<<source_of($1)<<endl<<endl;
 		
-		$$ = new symbol_info($1->getname(),"unit");
+		$$ = parse_arena.make<symbol_info>("","unit");
 		$$->set_ast_node($1->get_ast_node());
 	 }
 	 | error
 	 {
-	 	$$ = new symbol_info("","unit");
+	 	$$ = parse_arena.make<symbol_info>("","unit");
+	 	$$->set_ast_node(parse_arena.make<ErrorStmtNode>());
 	 }
      ;
 
 func_definition : type_specifier id_name LPAREN parameter_list RPAREN enter_func compound_statement
 		{	
-			log_file<<"At line no: "<<line_count<<" func_definition : type_specifier ID LPAREN parameter_list RPAREN compound_statement "<<endl<<endl;
-			log_file<<$1->getname()<<" "<<$2->getname()<<"("+$4->getname()+")\n"<<$7->getname()<<endl<<endl;
-			
-			$$ = new symbol_info($1->getname()+" "+$2->getname()+"("+$4->getname()+")\n"+$7->getname(),"func_def");	
+			$$ = parse_arena.make<symbol_info>("","func_def");	
 			
 			// Build AST node for function definition
-			FuncDeclNode* func_node = new FuncDeclNode($1->getname(), $2->getname());
+			FuncDeclNode* func_node = parse_arena.make<FuncDeclNode>($1->getvartype(), $2->getnameid());
 			
-			// Add function parameters
-			for(int i = 0; i < parameter_types.size(); i++) {
-				if(parameter_names[i] != "_null_") {
-					func_node->add_param(parameter_types[i], parameter_names[i]);
-				}
+			// Add function parameters as captured by enter_func (unnamed ones get no name)
+			vector<data_type> param_types = $6->getparamlist();
+			vector<uint32_t> param_names = $6->getparamname();
+			for(size_t i = 0; i < param_types.size(); i++) {
+				func_node->add_param(param_types[i], param_names[i] != null_name ? param_names[i] : name_table::none);
 			}
 			
 			// Set function body
@@ -156,9 +225,12 @@ func_definition : type_specifier id_name LPAREN parameter_list RPAREN enter_func
 			
 			$$->set_ast_node(func_node);
 			
+			LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" func_definition : type_specifier ID LPAREN parameter_list RPAREN compound_statement "<<endl<<endl;
+			LOG_AT(LOG_FULL)<<source_of($$)<<endl<<endl;
+			
 			if(sym_tbl->getID()!=1)
 			{
-				sym_tbl->Remove_from_table($2->getname());
+				sym_tbl->Remove_from_table($2->getnameid());
 			}
 			
 			parameter_types.clear();
@@ -167,13 +239,13 @@ func_definition : type_specifier id_name LPAREN parameter_list RPAREN enter_func
 		| type_specifier id_name LPAREN RPAREN enter_func compound_statement
 		{
 			
-			log_file<<"At line no: "<<line_count<<" func_definition : type_specifier ID LPAREN RPAREN compound_statement "<<endl<<endl;
-			log_file<<$1->getname()<<" "<<$2->getname()<<"()\n"<<$6->getname()<<endl<<endl;
+			LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" func_definition : type_specifier ID LPAREN RPAREN compound_statement "<<endl<<endl;
+			LOG_AT(LOG_FULL)<<$1->getname()<<" "<<$2->getname()<<"()\n"<<source_of($6)<<endl<<endl;
 			
-			$$ = new symbol_info($1->getname()+" "+$2->getname()+"()\n"+$6->getname(),"func_def");	
+			$$ = parse_arena.make<symbol_info>("","func_def");	
 			
 			// Build AST node for function definition
-			FuncDeclNode* func_node = new FuncDeclNode($1->getname(), $2->getname());
+			FuncDeclNode* func_node = parse_arena.make<FuncDeclNode>($1->getvartype(), $2->getnameid());
 			
 			// Set function body
 			if($6->get_ast_node()) {
@@ -184,7 +256,7 @@ func_definition : type_specifier id_name LPAREN parameter_list RPAREN enter_func
 			
 			if(sym_tbl->getID()!=1)
 			{
-				sym_tbl->Remove_from_table($2->getname());
+				sym_tbl->Remove_from_table($2->getnameid());
 			}
 			
 			parameter_types.clear();
@@ -199,115 +271,130 @@ enter_func : {
 				
 				if(parameter_types.size()!=0) //validate parameters
 				{
-					for(int i = 0; i < parameter_types.size();i++)
+					for(size_t i = 0; i < parameter_types.size();i++)
 					{
-						if(parameter_names[i]=="_null_")
+						if(parameter_names[i]==null_name)
 						{
-							error_file<<"At line no: "<<line_count<<" Parameter "<<i+1<<"'s name not given in function definition of "<<function_name<<endl<<endl;
-							log_file<<"At line no: "<<line_count<<" Parameter "<<i+1<<"'s name not given in function definition of "<<function_name<<endl<<endl;
+							error_file<<"At line no: "<<line_count<<" Parameter "<<i+1<<"'s name not given in function definition of "<<names.get_name(function_name)<<endl<<endl;
+							LOG_AT(LOG_ERRORS)<<"At line no: "<<line_count<<" Parameter "<<i+1<<"'s name not given in function definition of "<<names.get_name(function_name)<<endl<<endl;
 							error_count++;
 						}
 					}
 				}
 				
 				//check if function already exists and perform error checking
-				if(sym_tbl->Insert_in_table(function_name,"ID"))
+				bool inserted;
+				symbol_info *func_sym = sym_tbl->Insert_in_table(function_name,"ID",inserted);
+				if(inserted)
 				{
-					(sym_tbl->Lookup_in_table(function_name))->setvartype(function_return_type);
-					(sym_tbl->Lookup_in_table(function_name))->setidtype("func_def");
-					(sym_tbl->Lookup_in_table(function_name))->setparamlist(parameter_types);//set parameters
-					(sym_tbl->Lookup_in_table(function_name))->setparamname(parameter_names);
+					func_sym->setvartype(function_return_type);
+					func_sym->setidtype(ID_FUNC_DEF);
+					func_sym->setparamlist(parameter_types);//set parameters
+					func_sym->setparamname(parameter_names);
 				}
 				else
 				{
-					error_file<<"At line no: "<<line_count<<" Multiple declaration of function "<<function_name<<endl<<endl;
-					log_file<<"At line no: "<<line_count<<" Multiple declaration of function "<<function_name<<endl<<endl;
+					error_file<<"At line no: "<<line_count<<" Multiple declaration of function "<<names.get_name(function_name)<<endl<<endl;
+					LOG_AT(LOG_ERRORS)<<"At line no: "<<line_count<<" Multiple declaration of function "<<names.get_name(function_name)<<endl<<endl;
 					error_count++;
 				}
 					
-				if((sym_tbl->Lookup_in_table(function_name))->getvartype() != function_return_type)
+				if(func_sym->getvartype() != function_return_type)
 				{
-					error_file<<"At line no: "<<line_count<<" Return type mismatch of function "<<function_name<<endl<<endl;
-					log_file<<"At line no: "<<line_count<<" Return type mismatch of function "<<function_name<<endl<<endl;
+					error_file<<"At line no: "<<line_count<<" Return type mismatch of function "<<names.get_name(function_name)<<endl<<endl;
+					LOG_AT(LOG_ERRORS)<<"At line no: "<<line_count<<" Return type mismatch of function "<<names.get_name(function_name)<<endl<<endl;
 					error_count++;
 				}
+				
+				// Keep the parameters with the definition, error recovery inside the body clears the globals
+				$$ = parse_arena.make<symbol_info>(function_name,"func");
+				$$->setparamlist(parameter_types);
+				$$->setparamname(parameter_names);
             }
             ;
 
 parameter_list : parameter_list COMMA type_specifier ID
 		{
-			log_file<<"At line no: "<<line_count<<" parameter_list : parameter_list COMMA type_specifier ID "<<endl<<endl;
-			log_file<<$1->getname()+","+$3->getname()+" "+$4->getname()<<endl<<endl;
+			LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" parameter_list : parameter_list COMMA type_specifier ID "<<endl<<endl;
+			if(LOG_ENABLED(LOG_FULL))
+			{
+				print_parameter_list(log_file);
+				log_file<<","<<$3->getname()<<" "<<$4->getname()<<endl<<endl;
+			}
 					
-			$$ = new symbol_info($1->getname()+","+$3->getname()+" "+$4->getname(),"param_list");
+			$$ = parse_arena.make<symbol_info>("","param_list");
 			
-			if(count(parameter_names.begin(),parameter_names.end(),$4->getname()))
+			if(count(parameter_names.begin(),parameter_names.end(),$4->getnameid()))
 			{
-				error_file<<"At line no: "<<line_count<<" Multiple declaration of variable "<<$4->getname()<<" in parameter of "<<function_name<<endl<<endl;
-				log_file<<"At line no: "<<line_count<<" Multiple declaration of variable "<<$4->getname()<<" in parameter of "<<function_name<<endl<<endl;
+				error_file<<"At line no: "<<line_count<<" Multiple declaration of variable "<<$4->getname()<<" in parameter of "<<names.get_name(function_name)<<endl<<endl;
+				LOG_AT(LOG_ERRORS)<<"At line no: "<<line_count<<" Multiple declaration of variable "<<$4->getname()<<" in parameter of "<<names.get_name(function_name)<<endl<<endl;
 				error_count++;
 			}
 			
-			parameter_types.push_back($3->getname());
-			parameter_names.push_back($4->getname());
+			parameter_types.push_back($3->getvartype());
+			parameter_names.push_back($4->getnameid());
 		}
 		| parameter_list COMMA type_specifier
 		{
-			log_file<<"At line no: "<<line_count<<" parameter_list : parameter_list COMMA type_specifier "<<endl<<endl;
-			log_file<<$1->getname()+","+$3->getname()<<endl<<endl;
+			LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" parameter_list : parameter_list COMMA type_specifier "<<endl<<endl;
+			if(LOG_ENABLED(LOG_FULL))
+			{
+				print_parameter_list(log_file);
+				log_file<<","<<$3->getname()<<endl<<endl;
+			}
 			
-			$$ = new symbol_info($1->getname()+","+$3->getname(),"param_list");
+			$$ = parse_arena.make<symbol_info>("","param_list");
 			
-			parameter_types.push_back($3->getname());
-			parameter_names.push_back("_null_");
+			parameter_types.push_back($3->getvartype());
+			parameter_names.push_back(null_name);
 		}
  		| type_specifier ID
  		{
-			log_file<<"At line no: "<<line_count<<" parameter_list : type_specifier ID "<<endl<<endl;
-			log_file<<$1->getname()<<" "<<$2->getname()<<endl<<endl;
+			LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" parameter_list : type_specifier ID "<<endl<<endl;
+			LOG_AT(LOG_FULL)<<$1->getname()<<" "<<$2->getname()<<endl<<endl;
 			
-			$$ = new symbol_info($1->getname()+" "+$2->getname(),"param_list");
+			$$ = parse_arena.make<symbol_info>("","param_list");
 			
-			parameter_types.push_back($1->getname());
-			parameter_names.push_back($2->getname());
+			parameter_types.push_back($1->getvartype());
+			parameter_names.push_back($2->getnameid());
 		}
 		| type_specifier
 		{
-			log_file<<"At line no: "<<line_count<<" parameter_list : type_specifier "<<endl<<endl;
-			log_file<<$1->getname()<<endl<<endl;
+			LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" parameter_list : type_specifier "<<endl<<endl;
+			LOG_AT(LOG_FULL)<<$1->getname()<<endl<<endl;
 			
-			$$ = new symbol_info($1->getname(),"param_list");
+			$$ = parse_arena.make<symbol_info>("","param_list");
 			
-			parameter_types.push_back($1->getname());
-			parameter_names.push_back("_null_");
+			parameter_types.push_back($1->getvartype());
+			parameter_names.push_back(null_name);
 		}
  		;
 
 compound_statement : LCURL enter_scope_variables statements RCURL
 			{ 
- 		    	log_file<<"At line no: "<<line_count<<" compound_statement : LCURL statements RCURL "<<endl<<endl;
-				log_file<<"{\n"+$3->getname()+"\n}"<<endl<<endl;
+ 		    	LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" compound_statement : LCURL statements RCURL "<<endl<<endl;
+				LOG_AT(LOG_FULL)<<"{\n"<<statements_of($3)<<"\n}"<<endl<<endl;
 				
-				$$ = new symbol_info("{\n"+$3->getname()+"\n}","comp_stmnt");
+				$$ = parse_arena.make<symbol_info>("","comp_stmnt");
 				
 				// Set AST node for compound statement
 				$$->set_ast_node($3->get_ast_node());
 				
-				sym_tbl->Print_all_scope(log_file);
+				if(LOG_ENABLED(LOG_FULL)) sym_tbl->Print_all_scope(log_file);
 			    sym_tbl->exit_scope(log_file);
  		    }
  		    | LCURL enter_scope_variables RCURL
  		    { 
- 		    	log_file<<"At line no: "<<line_count<<" compound_statement : LCURL RCURL "<<endl<<endl;
-				log_file<<"{\n}"<<endl<<endl;
+ 		    	LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" compound_statement : LCURL RCURL "<<endl<<endl;
+				LOG_AT(LOG_FULL)<<"{\n}"<<endl<<endl;
 				
-				$$ = new symbol_info("{\n}","comp_stmnt");
+				$$ = parse_arena.make<symbol_info>("","comp_stmnt");
 				
 				// Build empty block node
-				BlockNode* empty_block = new BlockNode();
+				BlockNode* empty_block = parse_arena.make<BlockNode>();
 				$$->set_ast_node(empty_block);
 				
-				sym_tbl->Print_all_scope(log_file);
+				if(LOG_ENABLED(LOG_FULL)) sym_tbl->Print_all_scope(log_file);
 			    sym_tbl->exit_scope(log_file);
  		    }
  		    ;
@@ -319,13 +406,14 @@ enter_scope_variables :
 				{
 					if(parameter_names.size()!=0)
 					{
-						for(int i = 0; i < parameter_names.size(); i++)
+						for(size_t i = 0; i < parameter_names.size(); i++)
 						{
-							if(parameter_names[i]!="_null_")
+							if(parameter_names[i]!=null_name)
 							{
-								sym_tbl->Insert_in_table(parameter_names[i],"ID");
-								(sym_tbl->Lookup_in_table(parameter_names[i]))->setidtype("var");
-								(sym_tbl->Lookup_in_table(parameter_names[i]))->setvartype(parameter_types[i]);
+								bool inserted;
+								symbol_info *param_sym = sym_tbl->Insert_in_table(parameter_names[i],"ID",inserted);
+								param_sym->setidtype(ID_VAR);
+								param_sym->setvartype(parameter_types[i]);
 							}
 							
 						}
@@ -338,156 +426,147 @@ enter_scope_variables :
  		    
 var_declaration : type_specifier declaration_list SEMICOLON
 		 {
-			log_file<<"At line no: "<<line_count<<" var_declaration : type_specifier declaration_list SEMICOLON "<<endl<<endl;
-			log_file<<$1->getname()<<" "<<variable_list<<";"<<endl<<endl;
+			LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" var_declaration : type_specifier declaration_list SEMICOLON "<<endl<<endl;
+			if(LOG_ENABLED(LOG_FULL))
+			{
+				log_file<<$1->getname()<<" ";
+				print_variable_list(log_file);
+				log_file<<";"<<endl<<endl;
+			}
+			
+			$$ = parse_arena.make<symbol_info>("","var_dec");
 			
-			$$ = new symbol_info($1->getname()+" "+variable_list+";","var_dec");
+			// Build AST node for variable declaration, keeping the type as written
+			DeclNode* declaration_node = parse_arena.make<DeclNode>($1->getvartype());
 			
-			if($1->getname()=="void")
+			if($1->getvartype()==TYPE_VOID)
 			{
 				error_file<<"At line no: "<<line_count<<" variable type can not be void "<<endl<<endl;
-				log_file<<"At line no: "<<line_count<<" variable type can not be void "<<endl<<endl;
+				LOG_AT(LOG_ERRORS)<<"At line no: "<<line_count<<" variable type can not be void "<<endl<<endl;
 				error_count++;
-				$1 = new symbol_info("error","type"); //variable declared void so pass error instead
+				$1 = parse_arena.make<symbol_info>("error","type"); //variable declared void so pass error instead
+				$1->setvartype(TYPE_ERROR);
 			}
 			
-			// Build AST node for variable declaration
-			DeclNode* declaration_node = new DeclNode($1->getname());
-			
-			// Parse variable_list to add variables to the declaration node
-			stringstream var_stream(variable_list);
-			string var_identifier;
-			
-			while(getline(var_stream,var_identifier,','))
+			// Add the variables collected by declaration_list to the declaration node
+			for(size_t i = 0; i < declared_variables.size(); i++)
 			{
-				if(var_identifier.find("[") == string::npos) // regular variable
+				uint32_t var_name = declared_variables[i].first;
+				int array_size = declared_variables[i].second;
+				
+				declaration_node->add_var(var_name, array_size);
+				
+				bool inserted;
+				symbol_info *var_sym = sym_tbl->Insert_in_table(var_name,"ID",inserted);
+				if(inserted)
 				{
-					declaration_node->add_var(var_identifier, 0);
-					
-					if(sym_tbl->Insert_in_table(var_identifier,"ID"))
+					var_sym->setvartype($1->getvartype());
+					if(array_size == 0) // regular variable
 					{
-						(sym_tbl->Lookup_in_table(var_identifier))->setvartype($1->getname());
-						(sym_tbl->Lookup_in_table(var_identifier))->setidtype("var");
+						var_sym->setidtype(ID_VAR);
 					}
-					else
+					else // array variable
 					{
-						error_file<<"At line no: "<<line_count<<" Multiple declaration of variable "<<var_identifier<<endl<<endl;
-						log_file<<"At line no: "<<line_count<<" Multiple declaration of variable "<<var_identifier<<endl<<endl;
-						error_count++;
+						var_sym->setidtype(ID_ARRAY);
+						var_sym->setarraysize(array_size);
 					}
 				}
-				else // array variable
+				else
 				{
-					stringstream array_stream(var_identifier);
-					string array_name, array_dimension;
-					
-					getline(array_stream,array_name,'['); // extract array name
-					getline(array_stream,array_dimension,']'); // extract array size
-					
-					declaration_node->add_var(array_name, stoi(array_dimension));
-					
-					if(sym_tbl->Insert_in_table(array_name,"ID"))
-					{
-						(sym_tbl->Lookup_in_table(array_name))->setvartype($1->getname());
-						(sym_tbl->Lookup_in_table(array_name))->setidtype("array");
-						(sym_tbl->Lookup_in_table(array_name))->setarraysize(stoi(array_dimension));
-					}
-					else
-					{
-						error_file<<"At line no: "<<line_count<<" Multiple declaration of variable "<<array_name<<endl<<endl;
-						log_file<<"At line no: "<<line_count<<" Multiple declaration of variable "<<array_name<<endl<<endl;
-						error_count++;
-					}
+					error_file<<"At line no: "<<line_count<<" Multiple declaration of variable "<<names.get_name(var_name)<<endl<<endl;
+					LOG_AT(LOG_ERRORS)<<"At line no: "<<line_count<<" Multiple declaration of variable "<<names.get_name(var_name)<<endl<<endl;
+					error_count++;
 				}
 			}
 			
 			$$->set_ast_node(declaration_node);
-			variable_list = "";
+			declared_variables.clear();
 		 }
  		 ;
 
 type_specifier : INT
 		{
-			log_file<<"At line no: "<<line_count<<" type_specifier : INT "<<endl<<endl;
-			log_file<<"int"<<endl<<endl;
+			LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" type_specifier : INT "<<endl<<endl;
+			LOG_AT(LOG_FULL)<<"int"<<endl<<endl;
 			
-			$$ = new symbol_info("int","type");
-			return_data_type = "int";
+			$$ = parse_arena.make<symbol_info>("int","type");
+			$$->setvartype(TYPE_INT);
+			return_data_type = TYPE_INT;
 	    }
  		| FLOAT
  		{
-			log_file<<"At line no: "<<line_count<<" type_specifier : FLOAT "<<endl<<endl;
-			log_file<<"float"<<endl<<endl;
+			LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" type_specifier : FLOAT "<<endl<<endl;
+			LOG_AT(LOG_FULL)<<"float"<<endl<<endl;
 			
-			$$ = new symbol_info("float","type");
-			return_data_type = "float";
+			$$ = parse_arena.make<symbol_info>("float","type");
+			$$->setvartype(TYPE_FLOAT);
+			return_data_type = TYPE_FLOAT;
 	    }
  		| VOID
  		{
-			log_file<<"At line no: "<<line_count<<" type_specifier : VOID "<<endl<<endl;
-			log_file<<"void"<<endl<<endl;
+			LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" type_specifier : VOID "<<endl<<endl;
+			LOG_AT(LOG_FULL)<<"void"<<endl<<endl;
 			
-			$$ = new symbol_info("void","type");
-			return_data_type = "void";
+			$$ = parse_arena.make<symbol_info>("void","type");
+			$$->setvartype(TYPE_VOID);
+			return_data_type = TYPE_VOID;
 	    }
  		;
 
 declaration_list : declaration_list COMMA id_name
 		  {
- 		  	string var_name = $3->getname();
- 		  	log_file<<"At line no: "<<line_count<<" declaration_list : declaration_list COMMA ID "<<endl<<endl;
- 		  	
- 		  	variable_list=variable_list+","+var_name;
+ 		  	LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" declaration_list : declaration_list COMMA ID "<<endl<<endl;
  		  	
-			log_file<<variable_list<<endl<<endl;
-			
+			declared_variables.push_back(make_pair($3->getnameid(), 0));
+			if(LOG_ENABLED(LOG_FULL))
+			{
+				print_variable_list(log_file);
+				log_file<<endl<<endl;
+			}
  		  }
  		  | declaration_list COMMA id_name LTHIRD CONST_INT RTHIRD //array after declarations
  		  {
- 		  	string var_name = $3->getname();
- 		  	string array_size = $5->getname();
- 		  	log_file<<"At line no: "<<line_count<<" declaration_list : declaration_list COMMA ID LTHIRD CONST_INT RTHIRD "<<endl<<endl;
+ 		  	LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" declaration_list : declaration_list COMMA ID LTHIRD CONST_INT RTHIRD "<<endl<<endl;
  		  	
- 		  	variable_list=variable_list+","+var_name+"["+array_size+"]";
- 		  	
-			log_file<<variable_list<<endl<<endl;
-			
+			declared_variables.push_back(make_pair($3->getnameid(), stoi(string($5->getlexeme()))));
+			if(LOG_ENABLED(LOG_FULL))
+			{
+				print_variable_list(log_file);
+				log_file<<endl<<endl;
+			}
  		  }
  		  |id_name
  		  {
- 		  	string var_name = $1->getname();
- 		  	log_file<<"At line no: "<<line_count<<" declaration_list : ID "<<endl<<endl;
-			log_file<<var_name<<endl<<endl;
+ 		  	LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" declaration_list : ID "<<endl<<endl;
+			LOG_AT(LOG_FULL)<<$1->getname()<<endl<<endl;
 			
-			variable_list+=var_name;
+			declared_variables.push_back(make_pair($1->getnameid(), 0));
  		  }
  		  | id_name LTHIRD CONST_INT RTHIRD //array
  		  {
- 		  	string var_name = $1->getname();
- 		  	string array_size = $3->getname();
- 		  	log_file<<"At line no: "<<line_count<<" declaration_list : ID LTHIRD CONST_INT RTHIRD "<<endl<<endl;
-			log_file<<var_name+"["+array_size+"]"<<endl<<endl;
+ 		  	LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" declaration_list : ID LTHIRD CONST_INT RTHIRD "<<endl<<endl;
+			LOG_AT(LOG_FULL)<<$1->getname()<<"["<<$3->getlexeme()<<"]"<<endl<<endl;
 			
-			variable_list=variable_list+var_name+"["+array_size+"]";
+			declared_variables.push_back(make_pair($1->getnameid(), stoi(string($3->getlexeme()))));
  		  }
  		  ;
 id_name : ID
 		  {
-		   	$$ = new symbol_info($1->getname(),"ID");
-		   	function_name = $1->getname();
+		   	$$ = parse_arena.make<symbol_info>($1->getnameid(),"ID");
+		   	function_name = $$->getnameid();
 		   	function_return_type = return_data_type;
 		  }
  		  ;
 
 statements : statement
 	   {
-	    	log_file<<"At line no: "<<line_count<<" statements : statement "<<endl<<endl;
-			log_file<<$1->getname()<<endl<<endl;
+	    	LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" statements : statement "<<endl<<endl;
+			LOG_AT(LOG_FULL)<<source_of($1)<<endl<<endl;
 			
-			$$ = new symbol_info($1->getname(),"stmnts");
+			$$ = parse_arena.make<symbol_info>("","stmnts");
 			
 			// Build block for statements
-			BlockNode* statement_block = new BlockNode();
+			BlockNode* statement_block = parse_arena.make<BlockNode>();
 			if($1->get_ast_node()) {
 				statement_block->add_statement((StmtNode*)$1->get_ast_node());
 			}
@@ -495,10 +574,10 @@ statements : statement
 	   }
 	   | statements statement
 	   {
-	    	log_file<<"At line no: "<<line_count<<" statements : statements statement "<<endl<<endl;
-			log_file<<$1->getname()<<"\n"<<$2->getname()<<endl<<endl;
+	    	LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" statements : statements statement "<<endl<<endl;
+			LOG_AT(LOG_FULL)<<statements_of($1)<<"\n"<<source_of($2)<<endl<<endl;
 			
-			$$ = new symbol_info($1->getname()+"\n"+$2->getname(),"stmnts");
+			$$ = parse_arena.make<symbol_info>("","stmnts");
 			
 			// Append statement to block
 			BlockNode* statement_block = (BlockNode*)$1->get_ast_node();
@@ -509,60 +588,62 @@ statements : statement
 	   }
 	   | error
 	   {
-	  		$$ = new symbol_info("","stmnts");
-			BlockNode* error_block = new BlockNode();
+	  		$$ = parse_arena.make<symbol_info>("","stmnts");
+			BlockNode* error_block = parse_arena.make<BlockNode>();
+			error_block->add_statement(parse_arena.make<ErrorStmtNode>());
 			$$->set_ast_node(error_block);
 	   }  
 	   | statements error
 	   {
-	   		$$ = new symbol_info($1->getname(),"stmnts");
+	   		$$ = parse_arena.make<symbol_info>("","stmnts");
 			$$->set_ast_node($1->get_ast_node());
 	   }
 	   ;
 	   
 statement : var_declaration
 	  {
-	    	log_file<<"At line no: "<<line_count<<" statement : var_declaration "<<endl<<endl;
-			log_file<<$1->getname()<<endl<<endl;
+	    	LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" statement : var_declaration "<<endl<<endl;
+			LOG_AT(LOG_FULL)<<source_of($1)<<endl<<endl;
 			
-			$$ = new symbol_info($1->getname(),"stmnt");
+			$$ = parse_arena.make<symbol_info>("","stmnt");
 			$$->set_ast_node($1->get_ast_node());
 	  }
 	  | func_definition
 	  {
-	  		log_file<<"At line no: "<<line_count<<" Function definition must be in the global scope "<<endl<<endl;
+	  		LOG_AT(LOG_ERRORS)<<"At line no: "<<line_count<<" Function definition must be in the global scope "<<endl<<endl;
 	  		error_file<<"At line no: "<<line_count<<" Function definition must be in the global scope "<<endl<<endl;
 	  		error_count++;
-	  		$$ = new symbol_info("","stmnt");
+	  		$$ = parse_arena.make<symbol_info>("","stmnt");
+	  		$$->set_ast_node(parse_arena.make<ErrorStmtNode>());
 	  		
 	  }
 	  | expression_statement
 	  {
-	    	log_file<<"At line no: "<<line_count<<" statement : expression_statement "<<endl<<endl;
-			log_file<<$1->getname()<<endl<<endl;
+	    	LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" statement : expression_statement "<<endl<<endl;
+			LOG_AT(LOG_FULL)<<source_of($1)<<endl<<endl;
 			
-			$$ = new symbol_info($1->getname(),"stmnt");
+			$$ = parse_arena.make<symbol_info>("","stmnt");
 			$$->set_ast_node($1->get_ast_node());
 	  }
 	  | compound_statement
 	  {
-	    	log_file<<"At line no: "<<line_count<<" statement : compound_statement "<<endl<<endl;
-			log_file<<$1->getname()<<endl<<endl;
+	    	LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" statement : compound_statement "<<endl<<endl;
+			LOG_AT(LOG_FULL)<<source_of($1)<<endl<<endl;
 			
-			$$ = new symbol_info($1->getname(),"stmnt");
+			$$ = parse_arena.make<symbol_info>("","stmnt");
 			$$->set_ast_node($1->get_ast_node());
 	  }
 	  | FOR LPAREN expression_statement expression_statement expression RPAREN statement
 	  {
-	    	log_file<<"At line no: "<<line_count<<" statement : FOR LPAREN expression_statement expression_statement expression RPAREN statement "<<endl<<endl;
-			log_file<<"for("<<$3->getname()<<$4->getname()<<$5->getname()<<")\n"<<$7->getname()<<endl<<endl;
+	    	LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" statement : FOR LPAREN expression_statement expression_statement expression RPAREN statement "<<endl<<endl;
+			LOG_AT(LOG_FULL)<<"for("<<source_of($3)<<source_of($4)<<source_of($5)<<")\n"<<source_of($7)<<endl<<endl;
 			
-			$$ = new symbol_info("for("+$3->getname()+$4->getname()+$5->getname()+")\n"+$7->getname(),"stmnt");
+			$$ = parse_arena.make<symbol_info>("","stmnt");
 			
 			// Build AST node for for loop
-			ForNode* for_loop_node = new ForNode(
-				(ExprNode*)$3->get_ast_node(),
-				(ExprNode*)$4->get_ast_node(),
+			ForNode* for_loop_node = parse_arena.make<ForNode>(
+				(ExprStmtNode*)$3->get_ast_node(),
+				(ExprStmtNode*)$4->get_ast_node(),
 				(ExprNode*)$5->get_ast_node(),
 				(StmtNode*)$7->get_ast_node()
 			);
@@ -570,13 +651,13 @@ statement : var_declaration
 	  }
 	  | IF LPAREN expression RPAREN statement %prec LOWER_THAN_ELSE
 	  {
-	    	log_file<<"At line no: "<<line_count<<" statement : IF LPAREN expression RPAREN statement "<<endl<<endl;
-			log_file<<"if("<<$3->getname()<<")\n"<<$5->getname()<<endl<<endl;
+	    	LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" statement : IF LPAREN expression RPAREN statement "<<endl<<endl;
+			LOG_AT(LOG_FULL)<<"if("<<source_of($3)<<")\n"<<source_of($5)<<endl<<endl;
 			
-			$$ = new symbol_info("if("+$3->getname()+")\n"+$5->getname(),"stmnt");
+			$$ = parse_arena.make<symbol_info>("","stmnt");
 			
 			// Build AST node for if statement (no else)
-			IfNode* if_stmt_node = new IfNode(
+			IfNode* if_stmt_node = parse_arena.make<IfNode>(
 				(ExprNode*)$3->get_ast_node(),
 				(StmtNode*)$5->get_ast_node()
 			);
@@ -584,13 +665,13 @@ statement : var_declaration
 	  }
 	  | IF LPAREN expression RPAREN statement ELSE statement
 	  {
-	    	log_file<<"At line no: "<<line_count<<" statement : IF LPAREN expression RPAREN statement ELSE statement "<<endl<<endl;
-			log_file<<"if("<<$3->getname()<<")\n"<<$5->getname()<<"\nelse\n"<<$7->getname()<<endl<<endl;
+	    	LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" statement : IF LPAREN expression RPAREN statement ELSE statement "<<endl<<endl;
+			LOG_AT(LOG_FULL)<<"if("<<source_of($3)<<")\n"<<source_of($5)<<"\nelse\n"<<source_of($7)<<endl<<endl;
 			
-			$$ = new symbol_info("if("+$3->getname()+")\n"+$5->getname()+"\nelse\n"+$7->getname(),"stmnt");
+			$$ = parse_arena.make<symbol_info>("","stmnt");
 			
 			// Build AST node for if-else statement
-			IfNode* if_else_node = new IfNode(
+			IfNode* if_else_node = parse_arena.make<IfNode>(
 				(ExprNode*)$3->get_ast_node(),
 				(StmtNode*)$5->get_ast_node(),
 				(StmtNode*)$7->get_ast_node()
@@ -599,13 +680,13 @@ statement : var_declaration
 	  }
 	  | WHILE LPAREN expression RPAREN statement
 	  {
-	    	log_file<<"At line no: "<<line_count<<" statement : WHILE LPAREN expression RPAREN statement "<<endl<<endl;
-			log_file<<"while("<<$3->getname()<<")\n"<<$5->getname()<<endl<<endl;
+	    	LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" statement : WHILE LPAREN expression RPAREN statement "<<endl<<endl;
+			LOG_AT(LOG_FULL)<<"while("<<source_of($3)<<")\n"<<source_of($5)<<endl<<endl;
 			
-			$$ = new symbol_info("while("+$3->getname()+")\n"+$5->getname(),"stmnt");
+			$$ = parse_arena.make<symbol_info>("","stmnt");
 			
 			// Build AST node for while loop
-			WhileNode* while_loop_node = new WhileNode(
+			WhileNode* while_loop_node = parse_arena.make<WhileNode>(
 				(ExprNode*)$3->get_ast_node(),
 				(StmtNode*)$5->get_ast_node()
 			);
@@ -613,190 +694,190 @@ statement : var_declaration
 	  }
 	  | PRINTLN LPAREN id_name RPAREN SEMICOLON
 	  {
-	    	log_file<<"At line no: "<<line_count<<" statement : PRINTLN LPAREN ID RPAREN SEMICOLON "<<endl<<endl;
-			log_file<<"printf("<<$3->getname()<<");"<<endl<<endl; 
+	    	LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" statement : PRINTLN LPAREN ID RPAREN SEMICOLON "<<endl<<endl;
+			LOG_AT(LOG_FULL)<<"printf("<<$3->getname()<<");"<<endl<<endl; 
 			
-			if(sym_tbl->Lookup_in_table($3->getname()) == NULL)
+			if(sym_tbl->Lookup_in_table($3->getnameid()) == NULL)
 			{
 				error_file<<"At line no: "<<line_count<<" Undeclared variable "<<$3->getname()<<endl<<endl;
-				log_file<<"At line no: "<<line_count<<" Undeclared variable "<<$3->getname()<<endl<<endl;
+				LOG_AT(LOG_ERRORS)<<"At line no: "<<line_count<<" Undeclared variable "<<$3->getname()<<endl<<endl;
 				error_count++;
 			}
 			
-			$$ = new symbol_info("printf("+$3->getname()+");","stmnt");
+			$$ = parse_arena.make<symbol_info>("","stmnt");
 			
-			// Build a basic expression statement for printf
-			VarNode* print_var = new VarNode($3->getname(), 
-			                         sym_tbl->Lookup_in_table($3->getname()) ? 
-			                         sym_tbl->Lookup_in_table($3->getname())->getvartype() : "error");
-			ExprStmtNode* printf_node = new ExprStmtNode(print_var);
+			// Build printf statement node
+			VarNode* print_var = parse_arena.make<VarNode>($3->getnameid(), 
+			                         sym_tbl->Lookup_in_table($3->getnameid()) ? 
+			                         sym_tbl->Lookup_in_table($3->getnameid())->getvartype() : TYPE_ERROR);
+			PrintNode* printf_node = parse_arena.make<PrintNode>(print_var);
 			$$->set_ast_node(printf_node);
 	  }
 	  | RETURN expression SEMICOLON
 	  {
-	    	log_file<<"At line no: "<<line_count<<" statement : RETURN expression SEMICOLON "<<endl<<endl;
-			log_file<<"return "<<$2->getname()<<";"<<endl<<endl;
+	    	LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" statement : RETURN expression SEMICOLON "<<endl<<endl;
+			LOG_AT(LOG_FULL)<<"return "<<source_of($2)<<";"<<endl<<endl;
 			
-			$$ = new symbol_info("return "+$2->getname()+";","stmnt");
+			$$ = parse_arena.make<symbol_info>("","stmnt");
 			
 			// Build AST node for return statement
-			ReturnNode* return_stmt_node = new ReturnNode((ExprNode*)$2->get_ast_node());
+			ReturnNode* return_stmt_node = parse_arena.make<ReturnNode>((ExprNode*)$2->get_ast_node());
 			$$->set_ast_node(return_stmt_node);
 	  }
 	  ;
 	  
 expression_statement : SEMICOLON
 			{
-				log_file<<"At line no: "<<line_count<<" expression_statement : SEMICOLON "<<endl<<endl;
-				log_file<<";"<<endl<<endl;
+				LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" expression_statement : SEMICOLON "<<endl<<endl;
+				LOG_AT(LOG_FULL)<<";"<<endl<<endl;
 				
-				$$ = new symbol_info(";","expr_stmt");
+				$$ = parse_arena.make<symbol_info>("","expr_stmt");
 				
 				// Build empty expression statement
-				ExprStmtNode* empty_expr_stmt = new ExprStmtNode(nullptr);
+				ExprStmtNode* empty_expr_stmt = parse_arena.make<ExprStmtNode>(nullptr);
 				$$->set_ast_node(empty_expr_stmt);
 	        }			
 			| expression SEMICOLON 
 			{
-				log_file<<"At line no: "<<line_count<<" expression_statement : expression SEMICOLON "<<endl<<endl;
-				log_file<<$1->getname()<<";"<<endl<<endl;
+				LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" expression_statement : expression SEMICOLON "<<endl<<endl;
+				LOG_AT(LOG_FULL)<<source_of($1)<<";"<<endl<<endl;
 				
-				$$ = new symbol_info($1->getname()+";","expr_stmt");
+				$$ = parse_arena.make<symbol_info>("","expr_stmt");
 				
 				// Build expression statement from expression
-				ExprStmtNode* expr_stmt_node = new ExprStmtNode((ExprNode*)$1->get_ast_node());
+				ExprStmtNode* expr_stmt_node = parse_arena.make<ExprStmtNode>((ExprNode*)$1->get_ast_node());
 				$$->set_ast_node(expr_stmt_node);
 	        }
 			;
 	  
 variable : id_name 	
       {
-	    log_file<<"At line no: "<<line_count<<" variable : ID "<<endl<<endl;
-		log_file<<$1->getname()<<endl<<endl;
+	    LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" variable : ID "<<endl<<endl;
+		LOG_AT(LOG_FULL)<<$1->getname()<<endl<<endl;
 			
-		$$ = new symbol_info($1->getname(),"varbl");
+		$$ = parse_arena.make<symbol_info>("","varbl");
 		
-		if(sym_tbl->Lookup_in_table($1->getname()) == NULL)
+		if(sym_tbl->Lookup_in_table($1->getnameid()) == NULL)
 		{
 			error_file<<"At line no: "<<line_count<<" Undeclared variable "<<$1->getname()<<endl<<endl;
-			log_file<<"At line no: "<<line_count<<" Undeclared variable "<<$1->getname()<<endl<<endl;
+			LOG_AT(LOG_ERRORS)<<"At line no: "<<line_count<<" Undeclared variable "<<$1->getname()<<endl<<endl;
 			error_count++;
 			
-			$$->setvartype("error");; //not found set error type
+			$$->setvartype(TYPE_ERROR);; //not found set error type
 		}
-		else if((sym_tbl->Lookup_in_table($1->getname()))->getidtype() != "var") //variable is not a normal variable
+		else if((sym_tbl->Lookup_in_table($1->getnameid()))->getidtype() != ID_VAR) //variable is not a normal variable
 		{
-			if((sym_tbl->Lookup_in_table($1->getname()))->getidtype() == "array")
+			if((sym_tbl->Lookup_in_table($1->getnameid()))->getidtype() == ID_ARRAY)
 			{
 				error_file<<"At line no: "<<line_count<<" variable is of array type : "<<$1->getname()<<endl<<endl;
-				log_file<<"At line no: "<<line_count<<" variable is of array type : "<<$1->getname()<<endl<<endl;
+				LOG_AT(LOG_ERRORS)<<"At line no: "<<line_count<<" variable is of array type : "<<$1->getname()<<endl<<endl;
 				error_count++;
 			}
-			else if((sym_tbl->Lookup_in_table($1->getname()))->getidtype() == "func_def") 
+			else if((sym_tbl->Lookup_in_table($1->getnameid()))->getidtype() == ID_FUNC_DEF) 
 			{
 				error_file<<"At line no: "<<line_count<<" variable is of function type : "<<$1->getname()<<endl<<endl;
-				log_file<<"At line no: "<<line_count<<" variable is of function type : "<<$1->getname()<<endl<<endl;
+				LOG_AT(LOG_ERRORS)<<"At line no: "<<line_count<<" variable is of function type : "<<$1->getname()<<endl<<endl;
 				error_count++;
 			}
-			else if((sym_tbl->Lookup_in_table($1->getname()))->getidtype() == "func_dec") 
+			else if((sym_tbl->Lookup_in_table($1->getnameid()))->getidtype() == ID_FUNC_DEC) 
 			{
 				error_file<<"At line no: "<<line_count<<" variable is of function type : "<<$1->getname()<<endl<<endl;
-				log_file<<"At line no: "<<line_count<<" variable is of function type : "<<$1->getname()<<endl<<endl;
+				LOG_AT(LOG_ERRORS)<<"At line no: "<<line_count<<" variable is of function type : "<<$1->getname()<<endl<<endl;
 				error_count++;
 			}
 			
 			
-			$$->setvartype("error");; //doesn't match set error type
+			$$->setvartype(TYPE_ERROR);; //doesn't match set error type
 		}
-		else $$->setvartype((sym_tbl->Lookup_in_table($1->getname()))->getvartype());  //set variable type as id type
+		else $$->setvartype((sym_tbl->Lookup_in_table($1->getnameid()))->getvartype());  //set variable type as id type
 		
 		// Build AST node for variable
-		VarNode* variable_node = new VarNode($1->getname(), $$->getvartype());
+		VarNode* variable_node = parse_arena.make<VarNode>($1->getnameid(), $$->getvartype());
 		$$->set_ast_node(variable_node);
 	 }	
 	 | id_name LTHIRD expression RTHIRD 
 	 {
-	 	log_file<<"At line no: "<<line_count<<" variable : ID LTHIRD expression RTHIRD "<<endl<<endl;
-		log_file<<$1->getname()<<"["<<$3->getname()<<"]"<<endl<<endl;
+	 	LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" variable : ID LTHIRD expression RTHIRD "<<endl<<endl;
+		LOG_AT(LOG_FULL)<<$1->getname()<<"["<<source_of($3)<<"]"<<endl<<endl;
 		
-		$$ = new symbol_info($1->getname()+"["+$3->getname()+"]","varbl");
+		$$ = parse_arena.make<symbol_info>("","varbl");
 		
-		if(sym_tbl->Lookup_in_table($1->getname()) == NULL)
+		if(sym_tbl->Lookup_in_table($1->getnameid()) == NULL)
 		{
 			error_file<<"At line no: "<<line_count<<" Undeclared variable "<<$1->getname()<<endl<<endl;
-			log_file<<"At line no: "<<line_count<<" Undeclared variable "<<$1->getname()<<endl<<endl;
+			LOG_AT(LOG_ERRORS)<<"At line no: "<<line_count<<" Undeclared variable "<<$1->getname()<<endl<<endl;
 			error_count++;
 			
-			$$->setvartype("error");; //not found set error type
+			$$->setvartype(TYPE_ERROR);; //not found set error type
 		}
-		else if((sym_tbl->Lookup_in_table($1->getname()))->getidtype() != "array") //variable is not an array
+		else if((sym_tbl->Lookup_in_table($1->getnameid()))->getidtype() != ID_ARRAY) //variable is not an array
 		{
 			error_file<<"At line no: "<<line_count<<" variable is not of array type : "<<$1->getname()<<endl<<endl;
-			log_file<<"At line no: "<<line_count<<" variable is not of array type : "<<$1->getname()<<endl<<endl;
+			LOG_AT(LOG_ERRORS)<<"At line no: "<<line_count<<" variable is not of array type : "<<$1->getname()<<endl<<endl;
 			error_count++;
 			
-			$$->setvartype("error");; //doesn't match set error type
+			$$->setvartype(TYPE_ERROR);; //doesn't match set error type
 		}
-		else if($3->getvartype()!="int") // get type of expression for array index
+		else if($3->getvartype() != TYPE_INT) // get type of expression for array index
 		{
 			error_file<<"At line no: "<<line_count<<" array index is not of integer type : "<<$1->getname()<<endl<<endl;
-			log_file<<"At line no: "<<line_count<<" array index is not of integer type : "<<$1->getname()<<endl<<endl;
+			LOG_AT(LOG_ERRORS)<<"At line no: "<<line_count<<" array index is not of integer type : "<<$1->getname()<<endl<<endl;
 			error_count++;
 			
-			$$->setvartype("error");
+			$$->setvartype(TYPE_ERROR);
 		}
 		else
 		{
-			$$->setvartype((sym_tbl->Lookup_in_table($1->getname()))->getvartype());
+			$$->setvartype((sym_tbl->Lookup_in_table($1->getnameid()))->getvartype());
 		}
 		
 		// Build AST node for array access
-		VarNode* array_access_node = new VarNode($1->getname(), $$->getvartype(), (ExprNode*)$3->get_ast_node());
+		VarNode* array_access_node = parse_arena.make<VarNode>($1->getnameid(), $$->getvartype(), (ExprNode*)$3->get_ast_node());
 		$$->set_ast_node(array_access_node);
 	 }
 	 ;
 	 
 expression : logic_expression //expression can be void
 	   {
-	    	log_file<<"At line no: "<<line_count<<" expression : logic_expression "<<endl<<endl;
-			log_file<<$1->getname()<<endl<<endl;
+	    	LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" expression : logic_expression "<<endl<<endl;
+			LOG_AT(LOG_FULL)<<source_of($1)<<endl<<endl;
 			
-			$$ = new symbol_info($1->getname(),"expr");
+			$$ = parse_arena.make<symbol_info>("","expr");
 			$$->setvartype($1->getvartype());
 			$$->set_ast_node($1->get_ast_node());
 	   }
 	   | variable ASSIGNOP logic_expression 	
 	   {
-	    	log_file<<"At line no: "<<line_count<<" expression : variable ASSIGNOP logic_expression "<<endl<<endl;
-			log_file<<$1->getname()<<"="<<$3->getname()<<endl<<endl;
+	    	LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" expression : variable ASSIGNOP logic_expression "<<endl<<endl;
+			LOG_AT(LOG_FULL)<<source_of($1)<<"="<<source_of($3)<<endl<<endl;
 
-			$$ = new symbol_info($1->getname()+"="+$3->getname(),"expr");
+			$$ = parse_arena.make<symbol_info>("","expr");
 			$$->setvartype($1->getvartype());
 			
-			if($1->getvartype() == "void" || $3->getvartype() == "void") //if any operand is void
+			if($1->getvartype() == TYPE_VOID || $3->getvartype() == TYPE_VOID) //if any operand is void
 			{
 				error_file<<"At line no: "<<line_count<<" operation on void type "<<endl<<endl;
-				log_file<<"At line no: "<<line_count<<" operation on void type "<<endl<<endl;
+				LOG_AT(LOG_ERRORS)<<"At line no: "<<line_count<<" operation on void type "<<endl<<endl;
 				error_count++;
 				
-				$$->setvartype("error");
+				$$->setvartype(TYPE_ERROR);
 			}
-			else if($1->getvartype() == "int" && $3->getvartype() == "float") // assigning float into int
+			else if($1->getvartype() == TYPE_INT && $3->getvartype() == TYPE_FLOAT) // assigning float into int
 			{
 				error_file<<"At line no: "<<line_count<<" Warning: Assignment of float value into variable of integer type "<<endl<<endl;
-				log_file<<"At line no: "<<line_count<<" Warning: Assignment of float value into variable of integer type "<<endl<<endl;
+				LOG_AT(LOG_ERRORS)<<"At line no: "<<line_count<<" Warning: Assignment of float value into variable of integer type "<<endl<<endl;
 				error_count++;
 				
-				$$->setvartype("int");
+				$$->setvartype(TYPE_INT);
 			}
 			
-			if($1->getvartype() == "error" || $3->getvartype() == "error") //if any operand is error
+			if($1->getvartype() == TYPE_ERROR || $3->getvartype() == TYPE_ERROR) //if any operand is error
 			{
-				$$->setvartype("error");
+				$$->setvartype(TYPE_ERROR);
 			}
 			
 			// Build AST node for assignment
-			AssignNode* assignment_node = new AssignNode(
+			AssignNode* assignment_node = parse_arena.make<AssignNode>(
 				(VarNode*)$1->get_ast_node(),
 				(ExprNode*)$3->get_ast_node(),
 				$$->getvartype()
@@ -807,40 +888,40 @@ expression : logic_expression //expression can be void
 			
 logic_expression : rel_expression //logic expression can be void
 	     {
-	    	log_file<<"At line no: "<<line_count<<" logic_expression : rel_expression "<<endl<<endl;
-			log_file<<$1->getname()<<endl<<endl;
+	    	LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" logic_expression : rel_expression "<<endl<<endl;
+			LOG_AT(LOG_FULL)<<source_of($1)<<endl<<endl;
 			
-			$$ = new symbol_info($1->getname(),"lgc_expr");
+			$$ = parse_arena.make<symbol_info>("","lgc_expr");
 			$$->setvartype($1->getvartype());
 			$$->set_ast_node($1->get_ast_node());
 	     }	
 		 | rel_expression LOGICOP rel_expression 
 		 {
-	    	log_file<<"At line no: "<<line_count<<" logic_expression : rel_expression LOGICOP rel_expression "<<endl<<endl;
-			log_file<<$1->getname()<<$2->getname()<<$3->getname()<<endl<<endl;
+	    	LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" logic_expression : rel_expression LOGICOP rel_expression "<<endl<<endl;
+			LOG_AT(LOG_FULL)<<source_of($1)<<$2->getlexeme()<<source_of($3)<<endl<<endl;
 			
-			$$ = new symbol_info($1->getname()+$2->getname()+$3->getname(),"lgc_expr");
-			$$->setvartype("int");
+			$$ = parse_arena.make<symbol_info>("","lgc_expr");
+			$$->setvartype(TYPE_INT);
 			
 			//perform type checking on both sides of logicop
 			
-			if($1->getvartype() == "void" || $3->getvartype() == "void") //if any operand is void
+			if($1->getvartype() == TYPE_VOID || $3->getvartype() == TYPE_VOID) //if any operand is void
 			{
 				error_file<<"At line no: "<<line_count<<" operation on void type "<<endl<<endl;
-				log_file<<"At line no: "<<line_count<<" operation on void type "<<endl<<endl;
+				LOG_AT(LOG_ERRORS)<<"At line no: "<<line_count<<" operation on void type "<<endl<<endl;
 				error_count++;
 				
-				$$->setvartype("error");
+				$$->setvartype(TYPE_ERROR);
 			}
 			
-			if($1->getvartype() == "error" || $3->getvartype() == "error") //if any operand is error
+			if($1->getvartype() == TYPE_ERROR || $3->getvartype() == TYPE_ERROR) //if any operand is error
 			{
-				$$->setvartype("error");
+				$$->setvartype(TYPE_ERROR);
 			}
 			
 			// Build AST node for logical operation
-			BinaryOpNode* logic_operation_node = new BinaryOpNode(
-				$2->getname(),
+			BinaryOpNode* logic_operation_node = parse_arena.make<BinaryOpNode>(
+				string($2->getlexeme()),
 				(ExprNode*)$1->get_ast_node(),
 				(ExprNode*)$3->get_ast_node(),
 				$$->getvartype()
@@ -851,40 +932,40 @@ logic_expression : rel_expression //logic expression can be void
 			
 rel_expression	: simple_expression //relational expression can be void
 		{
-	    	log_file<<"At line no: "<<line_count<<" rel_expression : simple_expression "<<endl<<endl;
-			log_file<<$1->getname()<<endl<<endl;
+	    	LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" rel_expression : simple_expression "<<endl<<endl;
+			LOG_AT(LOG_FULL)<<source_of($1)<<endl<<endl;
 			
-			$$ = new symbol_info($1->getname(),"rel_expr");
+			$$ = parse_arena.make<symbol_info>("","rel_expr");
 			$$->setvartype($1->getvartype());
 			$$->set_ast_node($1->get_ast_node());
 	    }
 		| simple_expression RELOP simple_expression
 		{
-	    	log_file<<"At line no: "<<line_count<<" rel_expression : simple_expression RELOP simple_expression "<<endl<<endl;
-			log_file<<$1->getname()<<$2->getname()<<$3->getname()<<endl<<endl;
+	    	LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" rel_expression : simple_expression RELOP simple_expression "<<endl<<endl;
+			LOG_AT(LOG_FULL)<<source_of($1)<<$2->getlexeme()<<source_of($3)<<endl<<endl;
 			
-			$$ = new symbol_info($1->getname()+$2->getname()+$3->getname(),"rel_expr");
-			$$->setvartype("int");
+			$$ = parse_arena.make<symbol_info>("","rel_expr");
+			$$->setvartype(TYPE_INT);
 			
 			//perform type checking on both sides of relop
 			
-			if($1->getvartype() == "void" || $3->getvartype() == "void") //if any operand is void
+			if($1->getvartype() == TYPE_VOID || $3->getvartype() == TYPE_VOID) //if any operand is void
 			{
 				error_file<<"At line no: "<<line_count<<" operation on void type "<<endl<<endl;
-				log_file<<"At line no: "<<line_count<<" operation on void type "<<endl<<endl;
+				LOG_AT(LOG_ERRORS)<<"At line no: "<<line_count<<" operation on void type "<<endl<<endl;
 				error_count++;
 				
-				$$->setvartype("error");
+				$$->setvartype(TYPE_ERROR);
 			}
 			
-			if($1->getvartype() == "error" || $3->getvartype() == "error") //if any operand is error
+			if($1->getvartype() == TYPE_ERROR || $3->getvartype() == TYPE_ERROR) //if any operand is error
 			{
-				$$->setvartype("error");
+				$$->setvartype(TYPE_ERROR);
 			}
 			
 			// Build AST node for relational operation
-			BinaryOpNode* relational_operation_node = new BinaryOpNode(
-				$2->getname(),
+			BinaryOpNode* relational_operation_node = parse_arena.make<BinaryOpNode>(
+				string($2->getlexeme()),
 				(ExprNode*)$1->get_ast_node(),
 				(ExprNode*)$3->get_ast_node(),
 				$$->getvartype()
@@ -895,46 +976,46 @@ rel_expression	: simple_expression //relational expression can be void
 				
 simple_expression : term //simple expression can be void
           {
-	    	log_file<<"At line no: "<<line_count<<" simple_expression : term "<<endl<<endl;
-			log_file<<$1->getname()<<endl<<endl;
+	    	LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" simple_expression : term "<<endl<<endl;
+			LOG_AT(LOG_FULL)<<source_of($1)<<endl<<endl;
 			
-			$$ = new symbol_info($1->getname(),"simp_expr");
+			$$ = parse_arena.make<symbol_info>("","simp_expr");
 			$$->setvartype($1->getvartype());
 			$$->set_ast_node($1->get_ast_node());
 			
 	      }
 		  | simple_expression ADDOP term 
 		  {
-	    	log_file<<"At line no: "<<line_count<<" simple_expression : simple_expression ADDOP term "<<endl<<endl;
-			log_file<<$1->getname()<<$2->getname()<<$3->getname()<<endl<<endl;
+	    	LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" simple_expression : simple_expression ADDOP term "<<endl<<endl;
+			LOG_AT(LOG_FULL)<<source_of($1)<<$2->getlexeme()<<source_of($3)<<endl<<endl;
 			
-			$$ = new symbol_info($1->getname()+$2->getname()+$3->getname(),"simp_expr");
+			$$ = parse_arena.make<symbol_info>("","simp_expr");
 			$$->setvartype($1->getvartype());
 			
 			//perform type checking on both sides of addop
 			
-			if($1->getvartype() == "void" || $3->getvartype() == "void") //if any operand is void
+			if($1->getvartype() == TYPE_VOID || $3->getvartype() == TYPE_VOID) //if any operand is void
 			{
 				error_file<<"At line no: "<<line_count<<" operation on void type "<<endl<<endl;
-				log_file<<"At line no: "<<line_count<<" operation on void type "<<endl<<endl;
+				LOG_AT(LOG_ERRORS)<<"At line no: "<<line_count<<" operation on void type "<<endl<<endl;
 				error_count++;
 				
-				$$->setvartype("error");
+				$$->setvartype(TYPE_ERROR);
 			}
-			else if($1->getvartype() == "float" || $3->getvartype() == "float") //if any operand is float
+			else if($1->getvartype() == TYPE_FLOAT || $3->getvartype() == TYPE_FLOAT) //if any operand is float
 			{
-				$$->setvartype("float");
+				$$->setvartype(TYPE_FLOAT);
 			}
-			else $$->setvartype("int");
+			else $$->setvartype(TYPE_INT);
 			
-			if($1->getvartype() == "error" || $3->getvartype() == "error") //if any operand is error
+			if($1->getvartype() == TYPE_ERROR || $3->getvartype() == TYPE_ERROR) //if any operand is error
 			{
-				$$->setvartype("error");
+				$$->setvartype(TYPE_ERROR);
 			}
 			
 			// Build AST node for addition/subtraction
-			BinaryOpNode* addop_node = new BinaryOpNode(
-				$2->getname(),
+			BinaryOpNode* addop_node = parse_arena.make<BinaryOpNode>(
+				string($2->getlexeme()),
 				(ExprNode*)$1->get_ast_node(),
 				(ExprNode*)$3->get_ast_node(),
 				$$->getvartype()
@@ -945,81 +1026,81 @@ simple_expression : term //simple expression can be void
 					
 term :	unary_expression //term can be void due to unary_expr->factor
      {
-	    	log_file<<"At line no: "<<line_count<<" term : unary_expression "<<endl<<endl;
-			log_file<<$1->getname()<<endl<<endl;
+	    	LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" term : unary_expression "<<endl<<endl;
+			LOG_AT(LOG_FULL)<<source_of($1)<<endl<<endl;
 			
-			$$ = new symbol_info($1->getname(),"term");
+			$$ = parse_arena.make<symbol_info>("","term");
 			$$->setvartype($1->getvartype());
 			$$->set_ast_node($1->get_ast_node());
 			
 	 }
      |  term MULOP unary_expression
      {
-	    	log_file<<"At line no: "<<line_count<<" term : term MULOP unary_expression "<<endl<<endl;
-			log_file<<$1->getname()<<$2->getname()<<$3->getname()<<endl<<endl;
+	    	LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" term : term MULOP unary_expression "<<endl<<endl;
+			LOG_AT(LOG_FULL)<<source_of($1)<<$2->getlexeme()<<source_of($3)<<endl<<endl;
 			
-			$$ = new symbol_info($1->getname()+$2->getname()+$3->getname(),"term");
+			$$ = parse_arena.make<symbol_info>("","term");
 			$$->setvartype($1->getvartype());
 			
 			//perform type checking on both sides of mulop
-			if($1->getvartype() == "void" || $3->getvartype() == "void") //if any operand is void
+			if($1->getvartype() == TYPE_VOID || $3->getvartype() == TYPE_VOID) //if any operand is void
 			{
 				error_file<<"At line no: "<<line_count<<" operation on void type "<<endl<<endl;
-				log_file<<"At line no: "<<line_count<<" operation on void type "<<endl<<endl;
+				LOG_AT(LOG_ERRORS)<<"At line no: "<<line_count<<" operation on void type "<<endl<<endl;
 				error_count++;
 				
-				$$->setvartype("error");
+				$$->setvartype(TYPE_ERROR);
 			}
-			else if($1->getvartype() == "float" || $3->getvartype() == "float") //if any operand is float
+			else if($1->getvartype() == TYPE_FLOAT || $3->getvartype() == TYPE_FLOAT) //if any operand is float
 			{
-				$$->setvartype("float");
+				$$->setvartype(TYPE_FLOAT);
 			}
-			else $$->setvartype("int");
+			else $$->setvartype(TYPE_INT);
 			
 			//check if both operands are int for modulus
-			if($2->getname() == "%")
+			if($2->getlexeme() == "%")
 			{
-				if($1->getvartype() == "int" && $3->getvartype() == "int")
+				if($1->getvartype() == TYPE_INT && $3->getvartype() == TYPE_INT)
 				{
-					if($3->getname()=="0")
+					if(is_zero_literal($3))
 					{
 						error_file<<"At line no: "<<line_count<<" Modulus by 0 "<<endl<<endl;
-						log_file<<"At line no: "<<line_count<<" Modulus by 0 "<<endl<<endl;
+						LOG_AT(LOG_ERRORS)<<"At line no: "<<line_count<<" Modulus by 0 "<<endl<<endl;
 						error_count++;
 						
-						$$->setvartype("error");
+						$$->setvartype(TYPE_ERROR);
 					}
-					else $$->setvartype("int");
+					else $$->setvartype(TYPE_INT);
 				}
-				else if($1->getvartype() == "float" || $3->getvartype() == "float")
+				else if($1->getvartype() == TYPE_FLOAT || $3->getvartype() == TYPE_FLOAT)
 				{
 					error_file<<"At line no: "<<line_count<<" Modulus operator on non integer type "<<endl<<endl;
-					log_file<<"At line no: "<<line_count<<" Modulus operator on non integer type "<<endl<<endl;
+					LOG_AT(LOG_ERRORS)<<"At line no: "<<line_count<<" Modulus operator on non integer type "<<endl<<endl;
 					error_count++;
 					
-					$$->setvartype("error");
+					$$->setvartype(TYPE_ERROR);
 				}
 			}
 			
-			if($2->getname() == "/") //division by zero
+			if($2->getlexeme() == "/") //division by zero
 			{
-				if($3->getname()=="0")
+				if(is_zero_literal($3))
 				{
 					error_file<<"At line no: "<<line_count<<" Divide by 0 "<<endl<<endl;
-					log_file<<"At line no: "<<line_count<<" Divide by 0 "<<endl<<endl;
+					LOG_AT(LOG_ERRORS)<<"At line no: "<<line_count<<" Divide by 0 "<<endl<<endl;
 					error_count++;
 					
-					$$->setvartype("error");
+					$$->setvartype(TYPE_ERROR);
 				}
 			}
-			if($1->getvartype() == "error" || $3->getvartype() == "error") //if any operand is error
+			if($1->getvartype() == TYPE_ERROR || $3->getvartype() == TYPE_ERROR) //if any operand is error
 			{
-				$$->setvartype("error");
+				$$->setvartype(TYPE_ERROR);
 			}
 			
 			// Build AST node for multiplication/division/modulus
-			BinaryOpNode* mulop_node = new BinaryOpNode(
-				$2->getname(),
+			BinaryOpNode* mulop_node = parse_arena.make<BinaryOpNode>(
+				string($2->getlexeme()),
 				(ExprNode*)$1->get_ast_node(),
 				(ExprNode*)$3->get_ast_node(),
 				$$->getvartype()
@@ -1030,24 +1111,24 @@ term :	unary_expression //term can be void due to unary_expr->factor
 
 unary_expression : ADDOP unary_expression  // unary expression can be void due to factor
 		 {
-	    	log_file<<"At line no: "<<line_count<<" unary_expression : ADDOP unary_expression "<<endl<<endl;
-			log_file<<$1->getname()<<$2->getname()<<endl<<endl;
+	    	LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" unary_expression : ADDOP unary_expression "<<endl<<endl;
+			LOG_AT(LOG_FULL)<<$1->getlexeme()<<source_of($2)<<endl<<endl;
 			
-			$$ = new symbol_info($1->getname()+$2->getname(),"un_expr");
+			$$ = parse_arena.make<symbol_info>("","un_expr");
 			$$->setvartype($2->getvartype());
 			
-			if($2->getvartype()=="void")
+			if($2->getvartype() == TYPE_VOID)
 			{
-				error_file<<"At line no: "<<line_count<<" operation on void type : "<<$2->getname()<<endl<<endl;
-				log_file<<"At line no: "<<line_count<<" operation on void type : "<<$2->getname()<<endl<<endl;
+				error_file<<"At line no: "<<line_count<<" operation on void type : "<<source_of($2)<<endl<<endl;
+				LOG_AT(LOG_ERRORS)<<"At line no: "<<line_count<<" operation on void type : "<<source_of($2)<<endl<<endl;
 				error_count++;
 				
-				$$->setvartype("error");
+				$$->setvartype(TYPE_ERROR);
 			}
 			
 			// Build AST node for unary plus/minus
-			UnaryOpNode* unary_addop_node = new UnaryOpNode(
-				$1->getname(),
+			UnaryOpNode* unary_addop_node = parse_arena.make<UnaryOpNode>(
+				string($1->getlexeme()),
 				(ExprNode*)$2->get_ast_node(),
 				$$->getvartype()
 			);
@@ -1055,23 +1136,23 @@ unary_expression : ADDOP unary_expression  // unary expression can be void due t
 	     }
 		 | NOT unary_expression 
 		 {
-	    	log_file<<"At line no: "<<line_count<<" unary_expression : NOT unary_expression "<<endl<<endl;
-			log_file<<"!"<<$2->getname()<<endl<<endl;
+	    	LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" unary_expression : NOT unary_expression "<<endl<<endl;
+			LOG_AT(LOG_FULL)<<"!"<<source_of($2)<<endl<<endl;
 			
-			$$ = new symbol_info("!"+$2->getname(),"un_expr");
-			$$->setvartype("int");
+			$$ = parse_arena.make<symbol_info>("","un_expr");
+			$$->setvartype(TYPE_INT);
 			
-			if($2->getvartype()=="void")
+			if($2->getvartype() == TYPE_VOID)
 			{
-				error_file<<"At line no: "<<line_count<<" operation on void type : "<<$2->getname()<<endl<<endl;
-				log_file<<"At line no: "<<line_count<<" operation on void type : "<<$2->getname()<<endl<<endl;
+				error_file<<"At line no: "<<line_count<<" operation on void type : "<<source_of($2)<<endl<<endl;
+				LOG_AT(LOG_ERRORS)<<"At line no: "<<line_count<<" operation on void type : "<<source_of($2)<<endl<<endl;
 				error_count++;
 				
-				$$->setvartype("error");
+				$$->setvartype(TYPE_ERROR);
 			}
 			
 			// Build AST node for logical NOT
-			UnaryOpNode* not_operation_node = new UnaryOpNode(
+			UnaryOpNode* not_operation_node = parse_arena.make<UnaryOpNode>(
 				"!",
 				(ExprNode*)$2->get_ast_node(),
 				$$->getvartype()
@@ -1080,10 +1161,10 @@ unary_expression : ADDOP unary_expression  // unary expression can be void due t
 	     }
 		 | factor 
 		 {
-	    	log_file<<"At line no: "<<line_count<<" unary_expression : factor "<<endl<<endl;
-			log_file<<$1->getname()<<endl<<endl;
+	    	LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" unary_expression : factor "<<endl<<endl;
+			LOG_AT(LOG_FULL)<<source_of($1)<<endl<<endl;
 			
-			$$ = new symbol_info($1->getname(),"un_expr");
+			$$ = parse_arena.make<symbol_info>("","un_expr");
 			$$->setvartype($1->getvartype());
 			$$->set_ast_node($1->get_ast_node());
 	     }
@@ -1091,71 +1172,71 @@ unary_expression : ADDOP unary_expression  // unary expression can be void due t
 	
 factor	: variable  // factor can be void
     {
-	    log_file<<"At line no: "<<line_count<<" factor : variable "<<endl<<endl;
-		log_file<<$1->getname()<<endl<<endl;
+	    LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" factor : variable "<<endl<<endl;
+		LOG_AT(LOG_FULL)<<source_of($1)<<endl<<endl;
 			
-		$$ = new symbol_info($1->getname(),"fctr");
+		$$ = parse_arena.make<symbol_info>("","fctr");
 		$$->setvartype($1->getvartype());
 		$$->set_ast_node($1->get_ast_node());
 	}
 	| id_name LPAREN argument_list RPAREN
 	{
-	    log_file<<"At line no: "<<line_count<<" factor : ID LPAREN argument_list RPAREN "<<endl<<endl;
-	    log_file<<$1->getname()<<"("<<$3->getname()<<")"<<endl<<endl;
+	    LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" factor : ID LPAREN argument_list RPAREN "<<endl<<endl;
+	    LOG_AT(LOG_FULL)<<$1->getname()<<"("<<source_of($3)<<")"<<endl<<endl;
 	
-	    $$ = new symbol_info($1->getname()+"("+$3->getname()+")","fctr");
-	    $$->setvartype("error");
+	    $$ = parse_arena.make<symbol_info>("","fctr");
+	    $$->setvartype(TYPE_ERROR);
 	
 	    int type_match_flag = 0;
 	
 	    // Perform type checking (existing code)
-	    if(sym_tbl->Lookup_in_table($1->getname())==NULL) //undeclared function
+	    if(sym_tbl->Lookup_in_table($1->getnameid())==NULL) //undeclared function
 	    {
 	        error_file<<"At line no: "<<line_count<<" Undeclared function: "<<$1->getname()<<endl<<endl;
-	        log_file<<"At line no: "<<line_count<<" Undeclared function: "<<$1->getname()<<endl<<endl;
+	        LOG_AT(LOG_ERRORS)<<"At line no: "<<line_count<<" Undeclared function: "<<$1->getname()<<endl<<endl;
 	        error_count++;
 	    }
 	    else
 	    {
-	        if((sym_tbl->Lookup_in_table($1->getname()))->getidtype()=="func_dec") //declared but not defined
+	        if((sym_tbl->Lookup_in_table($1->getnameid()))->getidtype() == ID_FUNC_DEC) //declared but not defined
 	        {
 	            error_file<<"At line no: "<<line_count<<" Undefined function: "<<$1->getname()<<endl<<endl;
-	            log_file<<"At line no: "<<line_count<<" Undefined function: "<<$1->getname()<<endl<<endl;
+	            LOG_AT(LOG_ERRORS)<<"At line no: "<<line_count<<" Undefined function: "<<$1->getname()<<endl<<endl;
 	            error_count++;
 	        }
-	        else if((sym_tbl->Lookup_in_table($1->getname()))->getidtype()=="func_def")
+	        else if((sym_tbl->Lookup_in_table($1->getnameid()))->getidtype() == ID_FUNC_DEF)
 	        {
-	            vector<string> param_type_list = (sym_tbl->Lookup_in_table($1->getname()))->getparamlist();
+	            vector<data_type> param_type_list = (sym_tbl->Lookup_in_table($1->getnameid()))->getparamlist();
 	
 	            if(argument_types.size()!=param_type_list.size()) //number of parameters don't match
 	            {
 	                error_file<<"At line no: "<<line_count<<" Inconsistencies in number of arguments in function call: "<<$1->getname()<<endl<<endl;
-	                log_file<<"At line no: "<<line_count<<" Inconsistencies in number of arguments in function call: "<<$1->getname()<<endl<<endl;
+	                LOG_AT(LOG_ERRORS)<<"At line no: "<<line_count<<" Inconsistencies in number of arguments in function call: "<<$1->getname()<<endl<<endl;
 	                error_count++;
 	            }
 	            else if(param_type_list.size()!=0)
 	            {
-	                for(int i = 0; i < param_type_list.size(); i++)
+	                for(size_t i = 0; i < param_type_list.size(); i++)
 	                {
 	                    if(argument_types[i]!=param_type_list[i])
 	                    {
-	                        if(argument_types[i] == "int" && param_type_list[i] == "float") {}
-	                        else if(argument_types[i]!="error")
+	                        if(argument_types[i] == TYPE_INT && param_type_list[i] == TYPE_FLOAT) {}
+	                        else if(argument_types[i] != TYPE_ERROR)
 	                        {
 	                            type_match_flag = 1;
 	                            error_file<<"At line no: "<<line_count<<" "<<"argument "<<i+1<<" type mismatch in function call: "<<$1->getname()<<endl<<endl;
-	                            log_file<<"At line no: "<<line_count<<" "<<"argument "<<i+1<<" type mismatch in function call: "<<$1->getname()<<endl<<endl;
+	                            LOG_AT(LOG_ERRORS)<<"At line no: "<<line_count<<" "<<"argument "<<i+1<<" type mismatch in function call: "<<$1->getname()<<endl<<endl;
 	                            error_count++;
 	                        }
 	                    }
 	                }                   
 	            }
-	            if(!type_match_flag) $$->setvartype((sym_tbl->Lookup_in_table($1->getname()))->getvartype());
+	            if(!type_match_flag) $$->setvartype((sym_tbl->Lookup_in_table($1->getnameid()))->getvartype());
 	        }
 	    }
 	
 	    // Build function call node
-	    FuncCallNode* func_call_node = new FuncCallNode($1->getname(), $$->getvartype());
+	    FuncCallNode* func_call_node = parse_arena.make<FuncCallNode>($1->getnameid(), $$->getvartype());
 	
 	    // Get arguments from the ArgumentsNode if exists
 	    if ($3->get_ast_node()) {
@@ -1174,103 +1255,104 @@ factor	: variable  // factor can be void
 	}
 	| LPAREN expression RPAREN
 	{
-	   	log_file<<"At line no: "<<line_count<<" factor : LPAREN expression RPAREN "<<endl<<endl;
-		log_file<<"("<<$2->getname()<<")"<<endl<<endl;
+	   	LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" factor : LPAREN expression RPAREN "<<endl<<endl;
+		LOG_AT(LOG_FULL)<<"("<<source_of($2)<<")"<<endl<<endl;
 		
-		$$ = new symbol_info("("+$2->getname()+")","fctr");
+		$$ = parse_arena.make<symbol_info>("","fctr");
 		$$->setvartype($2->getvartype());
+		((ExprNode*)$2->get_ast_node())->add_parens();
 		$$->set_ast_node($2->get_ast_node()); // Pass through expression AST
 	}
 	| CONST_INT 
 	{
-	    log_file<<"At line no: "<<line_count<<" factor : CONST_INT "<<endl<<endl;
-		log_file<<$1->getname()<<endl<<endl;
+	    LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" factor : CONST_INT "<<endl<<endl;
+		LOG_AT(LOG_FULL)<<$1->getlexeme()<<endl<<endl;
 			
-		$$ = new symbol_info($1->getname(),"fctr");
-		$$->setvartype("int");
+		$$ = parse_arena.make<symbol_info>("","fctr");
+		$$->setvartype(TYPE_INT);
 		
 		// Build AST node for integer constant
-		ConstNode* int_const_node = new ConstNode($1->getname(), "int");
+		ConstNode* int_const_node = parse_arena.make<ConstNode>(string($1->getlexeme()), TYPE_INT);
 		$$->set_ast_node(int_const_node);
 	}
 	| CONST_FLOAT
 	{
-	    log_file<<"At line no: "<<line_count<<" factor : CONST_FLOAT "<<endl<<endl;
-		log_file<<$1->getname()<<endl<<endl;
+	    LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" factor : CONST_FLOAT "<<endl<<endl;
+		LOG_AT(LOG_FULL)<<$1->getlexeme()<<endl<<endl;
 			
-		$$ = new symbol_info($1->getname(),"fctr");
-		$$->setvartype("float");
+		$$ = parse_arena.make<symbol_info>("","fctr");
+		$$->setvartype(TYPE_FLOAT);
 		
 		// Build AST node for float constant
-		ConstNode* float_const_node = new ConstNode($1->getname(), "float");
+		ConstNode* float_const_node = parse_arena.make<ConstNode>(string($1->getlexeme()), TYPE_FLOAT);
 		$$->set_ast_node(float_const_node);
 	}
 	| variable INCOP 
 	{
-	    log_file<<"At line no: "<<line_count<<" factor : variable INCOP "<<endl<<endl;
-		log_file<<$1->getname()<<"++"<<endl<<endl;
+	    LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" factor : variable INCOP "<<endl<<endl;
+		LOG_AT(LOG_FULL)<<source_of($1)<<"++"<<endl<<endl;
 			
-		$$ = new symbol_info($1->getname()+"++","fctr");
+		$$ = parse_arena.make<symbol_info>("","fctr");
 		$$->setvartype($1->getvartype());
 		
 		// Build AST nodes for increment
 		// For x++, represented as (x = x + 1)
 		VarNode* inc_var_node = (VarNode*)$1->get_ast_node();
-		ConstNode* one_const_node = new ConstNode("1", "int");
-		BinaryOpNode* add_one_node = new BinaryOpNode("+", inc_var_node, one_const_node, $1->getvartype());
-		AssignNode* inc_assign_node = new AssignNode(inc_var_node, add_one_node, $1->getvartype());
+		ConstNode* one_const_node = parse_arena.make<ConstNode>("1", TYPE_INT);
+		BinaryOpNode* add_one_node = parse_arena.make<BinaryOpNode>("+", inc_var_node, one_const_node, $1->getvartype());
+		AssignNode* inc_assign_node = parse_arena.make<AssignNode>(inc_var_node, add_one_node, $1->getvartype(), "++");
 		$$->set_ast_node(inc_assign_node);
 	}
 	| variable DECOP
 	{
-	    log_file<<"At line no: "<<line_count<<" factor : variable DECOP "<<endl<<endl;
-		log_file<<$1->getname()<<"--"<<endl<<endl;
+	    LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" factor : variable DECOP "<<endl<<endl;
+		LOG_AT(LOG_FULL)<<source_of($1)<<"--"<<endl<<endl;
 			
-		$$ = new symbol_info($1->getname()+"--","fctr");
+		$$ = parse_arena.make<symbol_info>("","fctr");
 		$$->setvartype($1->getvartype());
 		
 		// Build AST nodes for decrement
 		// For x--, represented as (x = x - 1)
 		VarNode* dec_var_node = (VarNode*)$1->get_ast_node();
-		ConstNode* one_const_node = new ConstNode("1", "int");
-		BinaryOpNode* sub_one_node = new BinaryOpNode("-", dec_var_node, one_const_node, $1->getvartype());
-		AssignNode* dec_assign_node = new AssignNode(dec_var_node, sub_one_node, $1->getvartype());
+		ConstNode* one_const_node = parse_arena.make<ConstNode>("1", TYPE_INT);
+		BinaryOpNode* sub_one_node = parse_arena.make<BinaryOpNode>("-", dec_var_node, one_const_node, $1->getvartype());
+		AssignNode* dec_assign_node = parse_arena.make<AssignNode>(dec_var_node, sub_one_node, $1->getvartype(), "--");
 		$$->set_ast_node(dec_assign_node);
 	}
 	;
 	
 argument_list : arguments
               {
-                    log_file<<"At line no: "<<line_count<<" argument_list : arguments "<<endl<<endl;
-                    log_file<<$1->getname()<<endl<<endl;
+                    LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" argument_list : arguments "<<endl<<endl;
+                    LOG_AT(LOG_FULL)<<source_of($1)<<endl<<endl;
                         
                     $$ = $1; // Pass through arguments node
               }
               |
               {
-                    log_file<<"At line no: "<<line_count<<" argument_list :  "<<endl<<endl;
-                    log_file<<""<<endl<<endl;
+                    LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" argument_list :  "<<endl<<endl;
+                    LOG_AT(LOG_FULL)<<""<<endl<<endl;
                         
-                    $$ = new symbol_info("","arg_list");
+                    $$ = parse_arena.make<symbol_info>("","arg_list");
                     // Build empty arguments node
-                    ArgumentsNode* empty_args = new ArgumentsNode();
+                    ArgumentsNode* empty_args = parse_arena.make<ArgumentsNode>();
                     $$->set_ast_node(empty_args);
               }
               ;
     
 arguments : arguments COMMA logic_expression
           {
-                log_file<<"At line no: "<<line_count<<" arguments : arguments COMMA logic_expression "<<endl<<endl;
-                log_file<<$1->getname()<<","<<$3->getname()<<endl<<endl;
+                LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" arguments : arguments COMMA logic_expression "<<endl<<endl;
+                LOG_AT(LOG_FULL)<<source_of($1)<<","<<source_of($3)<<endl<<endl;
                         
-                $$ = new symbol_info($1->getname()+","+$3->getname(),"arg");
+                $$ = parse_arena.make<symbol_info>("","arg");
                 
                 // Get existing arguments node or create new
                 ArgumentsNode* args_list;
                 if ($1->get_ast_node()) {
                     args_list = dynamic_cast<ArgumentsNode*>($1->get_ast_node());
                 } else {
-                    args_list = new ArgumentsNode();
+                    args_list = parse_arena.make<ArgumentsNode>();
                 }
                 
                 // Add new argument
@@ -1283,13 +1365,13 @@ arguments : arguments COMMA logic_expression
           }
           | logic_expression
           {
-                log_file<<"At line no: "<<line_count<<" arguments : logic_expression "<<endl<<endl;
-                log_file<<$1->getname()<<endl<<endl;
+                LOG_AT(LOG_RULES)<<"At line no: "<<line_count<<" arguments : logic_expression "<<endl<<endl;
+                LOG_AT(LOG_FULL)<<source_of($1)<<endl<<endl;
                         
-                $$ = new symbol_info($1->getname(),"arg");
+                $$ = parse_arena.make<symbol_info>("","arg");
                 
                 // Build new arguments node with single argument
-                ArgumentsNode* args_list = new ArgumentsNode();
+                ArgumentsNode* args_list = parse_arena.make<ArgumentsNode>();
                 if ($1->get_ast_node()) {
                     args_list->add_argument(dynamic_cast<ExprNode*>($1->get_ast_node()));
                 }
@@ -1304,52 +1386,157 @@ arguments : arguments COMMA logic_expression
 
 int main(int argc, char *argv[])
 {
-	if(argc != 2) 
+	const char *input_path = NULL;
+	bool background_writer = false; // write the output files from a separate thread
+	string cfg_path; // Graphviz file for the control-flow graphs, none if empty
+	bool optimize = true;
+	bool run = false; // execute the generated code
+	unsigned long division_cost = 1; // int division on the target, in simple instructions
+	const char *level_names[] = {"none", "errors", "rules", "full"};
+	
+	for(int i = 1; i < argc; i++)
+	{
+		string arg = argv[i];
+		if(arg == "--background-writer") background_writer = true;
+		else if(arg == "--log-level" || arg.compare(0, 12, "--log-level=") == 0)
+		{
+			string level;
+			if(arg.size() > 11) level = arg.substr(12);
+			else if(i + 1 < argc) level = argv[++i];
+			
+			int found = -1;
+			for(int l = LOG_NONE; l <= LOG_FULL; l++)
+			{
+				if(level == level_names[l]) found = l;
+			}
+			if(found < 0)
+			{
+				cout<<"Unknown log level "<<level<<" (use none, errors, rules or full)"<<endl;
+				return 0;
+			}
+			log_verbosity = (log_level)found;
+		}
+		else if(arg == "--division-cost" || arg.compare(0, 16, "--division-cost=") == 0)
+		{
+			string cost;
+			if(arg.size() > 15) cost = arg.substr(16);
+			else if(i + 1 < argc) cost = argv[++i];
+			
+			char *end;
+			division_cost = strtoul(cost.c_str(), &end, 10);
+			if(cost.empty() || *end != '\0' || division_cost == 0)
+			{
+				cout<<"Invalid division cost "<<cost<<" (use a positive number)"<<endl;
+				return 0;
+			}
+		}
+		else if(arg == "--no-optimize") optimize = false;
+		else if(arg == "--run") run = true;
+		else if(arg == "--dump-cfg") cfg_path = "cfg.dot";
+		else if(arg.compare(0, 11, "--dump-cfg=") == 0) cfg_path = arg.substr(11);
+		else if(arg.compare(0, 2, "--") == 0)
+		{
+			cout<<"Unknown option "<<arg<<endl;
+			return 0;
+		}
+		else if(input_path == NULL) input_path = argv[i];
+		else
+		{
+			cout<<"Please input file name"<<endl;
+			return 0;
+		}
+	}
+	if(input_path == NULL) 
 	{
 		cout<<"Please input file name"<<endl;
 		return 0;
 	}
-	yyin = fopen(argv[1], "r");
-	log_file.open("log.txt", ios::trunc);
-	error_file.open("error.txt", ios::trunc);
-	code_file.open("code.txt", ios::trunc);
+	// The scanner works on the whole file in memory (memory-mapped when possible)
+	source_buffer source;
+	bool opened = source.open(input_path);
+	log_file.open("log.txt", background_writer);
+	error_file.open("error.txt", background_writer);
+	code_file.open("code.txt", background_writer);
 
-	if(yyin == NULL)
+	if(!opened)
 	{
 		cout<<"Couldn't open file"<<endl;
 		return 0;
 	}
+	scan_source_buffer(source.base(), source.scan_size());
 	
 	// First pass: Parse input and build AST
 	cout << "==== Pass 1: Parsing and constructing AST ====" << endl;
-	log_file << "==== Pass 1: Parsing and constructing AST ====" << endl;
+	LOG_AT(LOG_ERRORS) << "==== Pass 1: Parsing and constructing AST ====" << endl;
 	
+	sym_tbl->set_trace(LOG_ENABLED(LOG_FULL));
 	sym_tbl->enter_scope(log_file);
 	yyparse();
 	
-	log_file << endl << "Symbol Table after first pass:" << endl;
-	sym_tbl->Print_all_scope(log_file);
+	if(LOG_ENABLED(LOG_FULL))
+	{
+		log_file << endl << "Symbol Table after first pass:" << endl;
+		sym_tbl->Print_all_scope(log_file);
+	}
+	log_file.drain();
+	error_file.drain();
 	
 	// Only proceed to second pass if no errors occurred
 	if (error_count == 0 && program_root) {
 		cout << "==== Pass 2: Generating Three-Address Code ====" << endl;
-		log_file << endl << "==== Pass 2: Generating Three-Address Code ====" << endl;
+		LOG_AT(LOG_ERRORS) << endl << "==== Pass 2: Generating Three-Address Code ====" << endl;
 		
 		// Generate three-address code (second pass)
-		log_file << "Initiating Three-Address Code generation..." << endl;
+		LOG_AT(LOG_ERRORS) << "Initiating Three-Address Code generation..." << endl;
 		ThreeAddrCodeGenerator tac_generator(program_root, code_file);
-		tac_generator.generate();
+		tac_generator.build();
 		
-		log_file << "Three-Address Code generation completed successfully" << endl;
+		if(optimize)
+		{
+			LOG_AT(LOG_RULES) << endl << "==== Optimizing Three-Address Code ====" << endl;
+			tac_optimizer optimizer(tac_generator.get_program(), LOG_ENABLED(LOG_RULES) ? &log_file : nullptr, division_cost);
+			optimizer.run();
+		}
+		else
+		{
+			// The jump cleanup is cheap enough to run even unoptimized
+			jump_peephole peephole(tac_generator.get_program());
+			for(tac_function& func : tac_generator.get_program().functions) peephole.run(func);
+		}
+		
+		if(!cfg_path.empty())
+		{
+			output_file cfg_file;
+			cfg_file.open(cfg_path.c_str());
+			if(cfg_file.is_open()) dump_cfg(tac_generator.get_program(), cfg_file);
+			else cout<<"Couldn't open "<<cfg_path<<endl;
+		}
+		
+		tac_generator.print();
+		code_file.drain();
+		
+		LOG_AT(LOG_ERRORS) << "Three-Address Code generation completed successfully" << endl;
 		cout << "Three-Address Code generated successfully. Output in code.txt" << endl;
+		
+		if(run)
+		{
+			cout << "==== Running the program ====" << endl;
+			tac_vm vm(tac_generator.get_program());
+			if(vm.run(cout))
+			{
+				cout << "==== Program returned " << (vm.exit_value.type == TYPE_FLOAT ? to_string(vm.exit_value.f) : to_string(vm.exit_value.i))
+					<< " after " << vm.executed << " instructions and " << vm.calls_made << " calls ====" << endl;
+			}
+			else cout << vm.error << endl;
+		}
 	} else {
 		cout << "Three-Address Code generation skipped due to compilation errors" << endl;
-		log_file << endl << "Three-Address Code generation skipped due to errors" << endl;
+		LOG_AT(LOG_ERRORS) << endl << "Three-Address Code generation skipped due to errors" << endl;
 		code_file << "// Three-Address Code generation aborted due to compilation errors" << endl;
 	}
 	
-	log_file<<endl<<"Total lines: "<<line_count<<endl;
-	log_file<<"Total errors: "<<error_count<<endl;
+	LOG_AT(LOG_ERRORS)<<endl<<"Total lines: "<<line_count<<endl;
+	LOG_AT(LOG_ERRORS)<<"Total errors: "<<error_count<<endl;
 	error_file<<"Total errors: "<<error_count<<endl;
 	
 	log_file.close();
@@ -1357,7 +1544,9 @@ int main(int argc, char *argv[])
 	code_file.close();
 
 	
-	fclose(yyin);
+	// Release the symbol table, then every semantic value and AST node in one shot
+	delete sym_tbl;
+	parse_arena.release();
 	
 	return 0;
 }
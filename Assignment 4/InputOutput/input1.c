@@ -0,0 +1,13 @@
+int main() {
+  int a, b, x;
+  a = 0;
+  b = 5;
+  x = a != 0 && b / a > 1;
+  printf(x);
+  a = 2;
+  x = a != 0 && b / a > 1;
+  printf(x);
+  x = a == 0 || b % a == 1;
+  printf(x);
+  return x;
+}
@@ -0,0 +1,14 @@
+int main() {
+  int i, x;
+  int f[10];
+  f[9] = 4;
+  i = 10;
+  x = i < 10 && f[i] > 0;
+  printf(x);
+  i = 9;
+  x = i < 10 && f[i] > 0;
+  printf(x);
+  x = i >= 10 || f[i] == 4;
+  printf(x);
+  return x;
+}
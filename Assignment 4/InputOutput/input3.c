@@ -0,0 +1,23 @@
+int g;
+int main() {
+  int i;
+  float f;
+  g = 7;
+  i = 5;
+  {
+    int i;
+    float g;
+    i = 0;
+    g = 2.5;
+    printf(g);
+    {
+      float i;
+      i = 1.5;
+      f = i;
+    }
+    printf(i);
+  }
+  printf(f);
+  printf(g);
+  return i;
+}
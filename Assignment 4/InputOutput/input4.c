@@ -0,0 +1,3013 @@
+int f(int x) {
+  int c, s, t;
+  c = 2;
+  s = 0;
+  t = 1;
+  if (x > 0) s = s + x * 0 - t; else t = t + 0;
+  if (x > 1) s = s + x * 1 - t; else t = t + 1;
+  if (x > 2) s = s + x * 2 - t; else t = t + 2;
+  if (c > 0) t = t + c * 3; else s = s / c;
+  if (x > 4) s = s + x * 4 - t; else t = t + 4;
+  if (x > 5) s = s + x * 5 - t; else t = t + 0;
+  if (x > 6) s = s + x * 6 - t; else t = t + 1;
+  if (c > 1) t = t + c * 0; else s = s / c;
+  if (x > 8) s = s + x * 8 - t; else t = t + 3;
+  if (x > 9) s = s + x * 9 - t; else t = t + 4;
+  if (x > 10) s = s + x * 10 - t; else t = t + 0;
+  if (c > 2) t = t + c * 4; else s = s / c;
+  if (x > 12) s = s + x * 12 - t; else t = t + 2;
+  if (x > 13) s = s + x * 0 - t; else t = t + 3;
+  if (x > 14) s = s + x * 1 - t; else t = t + 4;
+  if (c > 0) t = t + c * 1; else s = s / c;
+  if (x > 16) s = s + x * 3 - t; else t = t + 1;
+  if (x > 17) s = s + x * 4 - t; else t = t + 2;
+  if (x > 18) s = s + x * 5 - t; else t = t + 3;
+  if (c > 1) t = t + c * 5; else s = s / c;
+  if (x > 20) s = s + x * 7 - t; else t = t + 0;
+  if (x > 21) s = s + x * 8 - t; else t = t + 1;
+  if (x > 22) s = s + x * 9 - t; else t = t + 2;
+  if (c > 2) t = t + c * 2; else s = s / c;
+  if (x > 24) s = s + x * 11 - t; else t = t + 4;
+  if (x > 25) s = s + x * 12 - t; else t = t + 0;
+  if (x > 26) s = s + x * 0 - t; else t = t + 1;
+  if (c > 0) t = t + c * 6; else s = s / c;
+  if (x > 28) s = s + x * 2 - t; else t = t + 3;
+  if (x > 29) s = s + x * 3 - t; else t = t + 4;
+  if (x > 30) s = s + x * 4 - t; else t = t + 0;
+  if (c > 1) t = t + c * 3; else s = s / c;
+  if (x > 32) s = s + x * 6 - t; else t = t + 2;
+  if (x > 33) s = s + x * 7 - t; else t = t + 3;
+  if (x > 34) s = s + x * 8 - t; else t = t + 4;
+  if (c > 2) t = t + c * 0; else s = s / c;
+  if (x > 36) s = s + x * 10 - t; else t = t + 1;
+  if (x > 37) s = s + x * 11 - t; else t = t + 2;
+  if (x > 38) s = s + x * 12 - t; else t = t + 3;
+  if (c > 0) t = t + c * 4; else s = s / c;
+  if (x > 40) s = s + x * 1 - t; else t = t + 0;
+  if (x > 41) s = s + x * 2 - t; else t = t + 1;
+  if (x > 42) s = s + x * 3 - t; else t = t + 2;
+  if (c > 1) t = t + c * 1; else s = s / c;
+  if (x > 44) s = s + x * 5 - t; else t = t + 4;
+  if (x > 45) s = s + x * 6 - t; else t = t + 0;
+  if (x > 46) s = s + x * 7 - t; else t = t + 1;
+  if (c > 2) t = t + c * 5; else s = s / c;
+  if (x > 48) s = s + x * 9 - t; else t = t + 3;
+  if (x > 49) s = s + x * 10 - t; else t = t + 4;
+  if (x > 0) s = s + x * 11 - t; else t = t + 0;
+  if (c > 0) t = t + c * 2; else s = s / c;
+  if (x > 2) s = s + x * 0 - t; else t = t + 2;
+  if (x > 3) s = s + x * 1 - t; else t = t + 3;
+  if (x > 4) s = s + x * 2 - t; else t = t + 4;
+  if (c > 1) t = t + c * 6; else s = s / c;
+  if (x > 6) s = s + x * 4 - t; else t = t + 1;
+  if (x > 7) s = s + x * 5 - t; else t = t + 2;
+  if (x > 8) s = s + x * 6 - t; else t = t + 3;
+  if (c > 2) t = t + c * 3; else s = s / c;
+  if (x > 10) s = s + x * 8 - t; else t = t + 0;
+  if (x > 11) s = s + x * 9 - t; else t = t + 1;
+  if (x > 12) s = s + x * 10 - t; else t = t + 2;
+  if (c > 0) t = t + c * 0; else s = s / c;
+  if (x > 14) s = s + x * 12 - t; else t = t + 4;
+  if (x > 15) s = s + x * 0 - t; else t = t + 0;
+  if (x > 16) s = s + x * 1 - t; else t = t + 1;
+  if (c > 1) t = t + c * 4; else s = s / c;
+  if (x > 18) s = s + x * 3 - t; else t = t + 3;
+  if (x > 19) s = s + x * 4 - t; else t = t + 4;
+  if (x > 20) s = s + x * 5 - t; else t = t + 0;
+  if (c > 2) t = t + c * 1; else s = s / c;
+  if (x > 22) s = s + x * 7 - t; else t = t + 2;
+  if (x > 23) s = s + x * 8 - t; else t = t + 3;
+  if (x > 24) s = s + x * 9 - t; else t = t + 4;
+  if (c > 0) t = t + c * 5; else s = s / c;
+  if (x > 26) s = s + x * 11 - t; else t = t + 1;
+  if (x > 27) s = s + x * 12 - t; else t = t + 2;
+  if (x > 28) s = s + x * 0 - t; else t = t + 3;
+  if (c > 1) t = t + c * 2; else s = s / c;
+  if (x > 30) s = s + x * 2 - t; else t = t + 0;
+  if (x > 31) s = s + x * 3 - t; else t = t + 1;
+  if (x > 32) s = s + x * 4 - t; else t = t + 2;
+  if (c > 2) t = t + c * 6; else s = s / c;
+  if (x > 34) s = s + x * 6 - t; else t = t + 4;
+  if (x > 35) s = s + x * 7 - t; else t = t + 0;
+  if (x > 36) s = s + x * 8 - t; else t = t + 1;
+  if (c > 0) t = t + c * 3; else s = s / c;
+  if (x > 38) s = s + x * 10 - t; else t = t + 3;
+  if (x > 39) s = s + x * 11 - t; else t = t + 4;
+  if (x > 40) s = s + x * 12 - t; else t = t + 0;
+  if (c > 1) t = t + c * 0; else s = s / c;
+  if (x > 42) s = s + x * 1 - t; else t = t + 2;
+  if (x > 43) s = s + x * 2 - t; else t = t + 3;
+  if (x > 44) s = s + x * 3 - t; else t = t + 4;
+  if (c > 2) t = t + c * 4; else s = s / c;
+  if (x > 46) s = s + x * 5 - t; else t = t + 1;
+  if (x > 47) s = s + x * 6 - t; else t = t + 2;
+  if (x > 48) s = s + x * 7 - t; else t = t + 3;
+  if (c > 0) t = t + c * 1; else s = s / c;
+  if (x > 0) s = s + x * 9 - t; else t = t + 0;
+  if (x > 1) s = s + x * 10 - t; else t = t + 1;
+  if (x > 2) s = s + x * 11 - t; else t = t + 2;
+  if (c > 1) t = t + c * 5; else s = s / c;
+  if (x > 4) s = s + x * 0 - t; else t = t + 4;
+  if (x > 5) s = s + x * 1 - t; else t = t + 0;
+  if (x > 6) s = s + x * 2 - t; else t = t + 1;
+  if (c > 2) t = t + c * 2; else s = s / c;
+  if (x > 8) s = s + x * 4 - t; else t = t + 3;
+  if (x > 9) s = s + x * 5 - t; else t = t + 4;
+  if (x > 10) s = s + x * 6 - t; else t = t + 0;
+  if (c > 0) t = t + c * 6; else s = s / c;
+  if (x > 12) s = s + x * 8 - t; else t = t + 2;
+  if (x > 13) s = s + x * 9 - t; else t = t + 3;
+  if (x > 14) s = s + x * 10 - t; else t = t + 4;
+  if (c > 1) t = t + c * 3; else s = s / c;
+  if (x > 16) s = s + x * 12 - t; else t = t + 1;
+  if (x > 17) s = s + x * 0 - t; else t = t + 2;
+  if (x > 18) s = s + x * 1 - t; else t = t + 3;
+  if (c > 2) t = t + c * 0; else s = s / c;
+  if (x > 20) s = s + x * 3 - t; else t = t + 0;
+  if (x > 21) s = s + x * 4 - t; else t = t + 1;
+  if (x > 22) s = s + x * 5 - t; else t = t + 2;
+  if (c > 0) t = t + c * 4; else s = s / c;
+  if (x > 24) s = s + x * 7 - t; else t = t + 4;
+  if (x > 25) s = s + x * 8 - t; else t = t + 0;
+  if (x > 26) s = s + x * 9 - t; else t = t + 1;
+  if (c > 1) t = t + c * 1; else s = s / c;
+  if (x > 28) s = s + x * 11 - t; else t = t + 3;
+  if (x > 29) s = s + x * 12 - t; else t = t + 4;
+  if (x > 30) s = s + x * 0 - t; else t = t + 0;
+  if (c > 2) t = t + c * 5; else s = s / c;
+  if (x > 32) s = s + x * 2 - t; else t = t + 2;
+  if (x > 33) s = s + x * 3 - t; else t = t + 3;
+  if (x > 34) s = s + x * 4 - t; else t = t + 4;
+  if (c > 0) t = t + c * 2; else s = s / c;
+  if (x > 36) s = s + x * 6 - t; else t = t + 1;
+  if (x > 37) s = s + x * 7 - t; else t = t + 2;
+  if (x > 38) s = s + x * 8 - t; else t = t + 3;
+  if (c > 1) t = t + c * 6; else s = s / c;
+  if (x > 40) s = s + x * 10 - t; else t = t + 0;
+  if (x > 41) s = s + x * 11 - t; else t = t + 1;
+  if (x > 42) s = s + x * 12 - t; else t = t + 2;
+  if (c > 2) t = t + c * 3; else s = s / c;
+  if (x > 44) s = s + x * 1 - t; else t = t + 4;
+  if (x > 45) s = s + x * 2 - t; else t = t + 0;
+  if (x > 46) s = s + x * 3 - t; else t = t + 1;
+  if (c > 0) t = t + c * 0; else s = s / c;
+  if (x > 48) s = s + x * 5 - t; else t = t + 3;
+  if (x > 49) s = s + x * 6 - t; else t = t + 4;
+  if (x > 0) s = s + x * 7 - t; else t = t + 0;
+  if (c > 1) t = t + c * 4; else s = s / c;
+  if (x > 2) s = s + x * 9 - t; else t = t + 2;
+  if (x > 3) s = s + x * 10 - t; else t = t + 3;
+  if (x > 4) s = s + x * 11 - t; else t = t + 4;
+  if (c > 2) t = t + c * 1; else s = s / c;
+  if (x > 6) s = s + x * 0 - t; else t = t + 1;
+  if (x > 7) s = s + x * 1 - t; else t = t + 2;
+  if (x > 8) s = s + x * 2 - t; else t = t + 3;
+  if (c > 0) t = t + c * 5; else s = s / c;
+  if (x > 10) s = s + x * 4 - t; else t = t + 0;
+  if (x > 11) s = s + x * 5 - t; else t = t + 1;
+  if (x > 12) s = s + x * 6 - t; else t = t + 2;
+  if (c > 1) t = t + c * 2; else s = s / c;
+  if (x > 14) s = s + x * 8 - t; else t = t + 4;
+  if (x > 15) s = s + x * 9 - t; else t = t + 0;
+  if (x > 16) s = s + x * 10 - t; else t = t + 1;
+  if (c > 2) t = t + c * 6; else s = s / c;
+  if (x > 18) s = s + x * 12 - t; else t = t + 3;
+  if (x > 19) s = s + x * 0 - t; else t = t + 4;
+  if (x > 20) s = s + x * 1 - t; else t = t + 0;
+  if (c > 0) t = t + c * 3; else s = s / c;
+  if (x > 22) s = s + x * 3 - t; else t = t + 2;
+  if (x > 23) s = s + x * 4 - t; else t = t + 3;
+  if (x > 24) s = s + x * 5 - t; else t = t + 4;
+  if (c > 1) t = t + c * 0; else s = s / c;
+  if (x > 26) s = s + x * 7 - t; else t = t + 1;
+  if (x > 27) s = s + x * 8 - t; else t = t + 2;
+  if (x > 28) s = s + x * 9 - t; else t = t + 3;
+  if (c > 2) t = t + c * 4; else s = s / c;
+  if (x > 30) s = s + x * 11 - t; else t = t + 0;
+  if (x > 31) s = s + x * 12 - t; else t = t + 1;
+  if (x > 32) s = s + x * 0 - t; else t = t + 2;
+  if (c > 0) t = t + c * 1; else s = s / c;
+  if (x > 34) s = s + x * 2 - t; else t = t + 4;
+  if (x > 35) s = s + x * 3 - t; else t = t + 0;
+  if (x > 36) s = s + x * 4 - t; else t = t + 1;
+  if (c > 1) t = t + c * 5; else s = s / c;
+  if (x > 38) s = s + x * 6 - t; else t = t + 3;
+  if (x > 39) s = s + x * 7 - t; else t = t + 4;
+  if (x > 40) s = s + x * 8 - t; else t = t + 0;
+  if (c > 2) t = t + c * 2; else s = s / c;
+  if (x > 42) s = s + x * 10 - t; else t = t + 2;
+  if (x > 43) s = s + x * 11 - t; else t = t + 3;
+  if (x > 44) s = s + x * 12 - t; else t = t + 4;
+  if (c > 0) t = t + c * 6; else s = s / c;
+  if (x > 46) s = s + x * 1 - t; else t = t + 1;
+  if (x > 47) s = s + x * 2 - t; else t = t + 2;
+  if (x > 48) s = s + x * 3 - t; else t = t + 3;
+  if (c > 1) t = t + c * 3; else s = s / c;
+  if (x > 0) s = s + x * 5 - t; else t = t + 0;
+  if (x > 1) s = s + x * 6 - t; else t = t + 1;
+  if (x > 2) s = s + x * 7 - t; else t = t + 2;
+  if (c > 2) t = t + c * 0; else s = s / c;
+  if (x > 4) s = s + x * 9 - t; else t = t + 4;
+  if (x > 5) s = s + x * 10 - t; else t = t + 0;
+  if (x > 6) s = s + x * 11 - t; else t = t + 1;
+  if (c > 0) t = t + c * 4; else s = s / c;
+  if (x > 8) s = s + x * 0 - t; else t = t + 3;
+  if (x > 9) s = s + x * 1 - t; else t = t + 4;
+  if (x > 10) s = s + x * 2 - t; else t = t + 0;
+  if (c > 1) t = t + c * 1; else s = s / c;
+  if (x > 12) s = s + x * 4 - t; else t = t + 2;
+  if (x > 13) s = s + x * 5 - t; else t = t + 3;
+  if (x > 14) s = s + x * 6 - t; else t = t + 4;
+  if (c > 2) t = t + c * 5; else s = s / c;
+  if (x > 16) s = s + x * 8 - t; else t = t + 1;
+  if (x > 17) s = s + x * 9 - t; else t = t + 2;
+  if (x > 18) s = s + x * 10 - t; else t = t + 3;
+  if (c > 0) t = t + c * 2; else s = s / c;
+  if (x > 20) s = s + x * 12 - t; else t = t + 0;
+  if (x > 21) s = s + x * 0 - t; else t = t + 1;
+  if (x > 22) s = s + x * 1 - t; else t = t + 2;
+  if (c > 1) t = t + c * 6; else s = s / c;
+  if (x > 24) s = s + x * 3 - t; else t = t + 4;
+  if (x > 25) s = s + x * 4 - t; else t = t + 0;
+  if (x > 26) s = s + x * 5 - t; else t = t + 1;
+  if (c > 2) t = t + c * 3; else s = s / c;
+  if (x > 28) s = s + x * 7 - t; else t = t + 3;
+  if (x > 29) s = s + x * 8 - t; else t = t + 4;
+  if (x > 30) s = s + x * 9 - t; else t = t + 0;
+  if (c > 0) t = t + c * 0; else s = s / c;
+  if (x > 32) s = s + x * 11 - t; else t = t + 2;
+  if (x > 33) s = s + x * 12 - t; else t = t + 3;
+  if (x > 34) s = s + x * 0 - t; else t = t + 4;
+  if (c > 1) t = t + c * 4; else s = s / c;
+  if (x > 36) s = s + x * 2 - t; else t = t + 1;
+  if (x > 37) s = s + x * 3 - t; else t = t + 2;
+  if (x > 38) s = s + x * 4 - t; else t = t + 3;
+  if (c > 2) t = t + c * 1; else s = s / c;
+  if (x > 40) s = s + x * 6 - t; else t = t + 0;
+  if (x > 41) s = s + x * 7 - t; else t = t + 1;
+  if (x > 42) s = s + x * 8 - t; else t = t + 2;
+  if (c > 0) t = t + c * 5; else s = s / c;
+  if (x > 44) s = s + x * 10 - t; else t = t + 4;
+  if (x > 45) s = s + x * 11 - t; else t = t + 0;
+  if (x > 46) s = s + x * 12 - t; else t = t + 1;
+  if (c > 1) t = t + c * 2; else s = s / c;
+  if (x > 48) s = s + x * 1 - t; else t = t + 3;
+  if (x > 49) s = s + x * 2 - t; else t = t + 4;
+  if (x > 0) s = s + x * 3 - t; else t = t + 0;
+  if (c > 2) t = t + c * 6; else s = s / c;
+  if (x > 2) s = s + x * 5 - t; else t = t + 2;
+  if (x > 3) s = s + x * 6 - t; else t = t + 3;
+  if (x > 4) s = s + x * 7 - t; else t = t + 4;
+  if (c > 0) t = t + c * 3; else s = s / c;
+  if (x > 6) s = s + x * 9 - t; else t = t + 1;
+  if (x > 7) s = s + x * 10 - t; else t = t + 2;
+  if (x > 8) s = s + x * 11 - t; else t = t + 3;
+  if (c > 1) t = t + c * 0; else s = s / c;
+  if (x > 10) s = s + x * 0 - t; else t = t + 0;
+  if (x > 11) s = s + x * 1 - t; else t = t + 1;
+  if (x > 12) s = s + x * 2 - t; else t = t + 2;
+  if (c > 2) t = t + c * 4; else s = s / c;
+  if (x > 14) s = s + x * 4 - t; else t = t + 4;
+  if (x > 15) s = s + x * 5 - t; else t = t + 0;
+  if (x > 16) s = s + x * 6 - t; else t = t + 1;
+  if (c > 0) t = t + c * 1; else s = s / c;
+  if (x > 18) s = s + x * 8 - t; else t = t + 3;
+  if (x > 19) s = s + x * 9 - t; else t = t + 4;
+  if (x > 20) s = s + x * 10 - t; else t = t + 0;
+  if (c > 1) t = t + c * 5; else s = s / c;
+  if (x > 22) s = s + x * 12 - t; else t = t + 2;
+  if (x > 23) s = s + x * 0 - t; else t = t + 3;
+  if (x > 24) s = s + x * 1 - t; else t = t + 4;
+  if (c > 2) t = t + c * 2; else s = s / c;
+  if (x > 26) s = s + x * 3 - t; else t = t + 1;
+  if (x > 27) s = s + x * 4 - t; else t = t + 2;
+  if (x > 28) s = s + x * 5 - t; else t = t + 3;
+  if (c > 0) t = t + c * 6; else s = s / c;
+  if (x > 30) s = s + x * 7 - t; else t = t + 0;
+  if (x > 31) s = s + x * 8 - t; else t = t + 1;
+  if (x > 32) s = s + x * 9 - t; else t = t + 2;
+  if (c > 1) t = t + c * 3; else s = s / c;
+  if (x > 34) s = s + x * 11 - t; else t = t + 4;
+  if (x > 35) s = s + x * 12 - t; else t = t + 0;
+  if (x > 36) s = s + x * 0 - t; else t = t + 1;
+  if (c > 2) t = t + c * 0; else s = s / c;
+  if (x > 38) s = s + x * 2 - t; else t = t + 3;
+  if (x > 39) s = s + x * 3 - t; else t = t + 4;
+  if (x > 40) s = s + x * 4 - t; else t = t + 0;
+  if (c > 0) t = t + c * 4; else s = s / c;
+  if (x > 42) s = s + x * 6 - t; else t = t + 2;
+  if (x > 43) s = s + x * 7 - t; else t = t + 3;
+  if (x > 44) s = s + x * 8 - t; else t = t + 4;
+  if (c > 1) t = t + c * 1; else s = s / c;
+  if (x > 46) s = s + x * 10 - t; else t = t + 1;
+  if (x > 47) s = s + x * 11 - t; else t = t + 2;
+  if (x > 48) s = s + x * 12 - t; else t = t + 3;
+  if (c > 2) t = t + c * 5; else s = s / c;
+  if (x > 0) s = s + x * 1 - t; else t = t + 0;
+  if (x > 1) s = s + x * 2 - t; else t = t + 1;
+  if (x > 2) s = s + x * 3 - t; else t = t + 2;
+  if (c > 0) t = t + c * 2; else s = s / c;
+  if (x > 4) s = s + x * 5 - t; else t = t + 4;
+  if (x > 5) s = s + x * 6 - t; else t = t + 0;
+  if (x > 6) s = s + x * 7 - t; else t = t + 1;
+  if (c > 1) t = t + c * 6; else s = s / c;
+  if (x > 8) s = s + x * 9 - t; else t = t + 3;
+  if (x > 9) s = s + x * 10 - t; else t = t + 4;
+  if (x > 10) s = s + x * 11 - t; else t = t + 0;
+  if (c > 2) t = t + c * 3; else s = s / c;
+  if (x > 12) s = s + x * 0 - t; else t = t + 2;
+  if (x > 13) s = s + x * 1 - t; else t = t + 3;
+  if (x > 14) s = s + x * 2 - t; else t = t + 4;
+  if (c > 0) t = t + c * 0; else s = s / c;
+  if (x > 16) s = s + x * 4 - t; else t = t + 1;
+  if (x > 17) s = s + x * 5 - t; else t = t + 2;
+  if (x > 18) s = s + x * 6 - t; else t = t + 3;
+  if (c > 1) t = t + c * 4; else s = s / c;
+  if (x > 20) s = s + x * 8 - t; else t = t + 0;
+  if (x > 21) s = s + x * 9 - t; else t = t + 1;
+  if (x > 22) s = s + x * 10 - t; else t = t + 2;
+  if (c > 2) t = t + c * 1; else s = s / c;
+  if (x > 24) s = s + x * 12 - t; else t = t + 4;
+  if (x > 25) s = s + x * 0 - t; else t = t + 0;
+  if (x > 26) s = s + x * 1 - t; else t = t + 1;
+  if (c > 0) t = t + c * 5; else s = s / c;
+  if (x > 28) s = s + x * 3 - t; else t = t + 3;
+  if (x > 29) s = s + x * 4 - t; else t = t + 4;
+  if (x > 30) s = s + x * 5 - t; else t = t + 0;
+  if (c > 1) t = t + c * 2; else s = s / c;
+  if (x > 32) s = s + x * 7 - t; else t = t + 2;
+  if (x > 33) s = s + x * 8 - t; else t = t + 3;
+  if (x > 34) s = s + x * 9 - t; else t = t + 4;
+  if (c > 2) t = t + c * 6; else s = s / c;
+  if (x > 36) s = s + x * 11 - t; else t = t + 1;
+  if (x > 37) s = s + x * 12 - t; else t = t + 2;
+  if (x > 38) s = s + x * 0 - t; else t = t + 3;
+  if (c > 0) t = t + c * 3; else s = s / c;
+  if (x > 40) s = s + x * 2 - t; else t = t + 0;
+  if (x > 41) s = s + x * 3 - t; else t = t + 1;
+  if (x > 42) s = s + x * 4 - t; else t = t + 2;
+  if (c > 1) t = t + c * 0; else s = s / c;
+  if (x > 44) s = s + x * 6 - t; else t = t + 4;
+  if (x > 45) s = s + x * 7 - t; else t = t + 0;
+  if (x > 46) s = s + x * 8 - t; else t = t + 1;
+  if (c > 2) t = t + c * 4; else s = s / c;
+  if (x > 48) s = s + x * 10 - t; else t = t + 3;
+  if (x > 49) s = s + x * 11 - t; else t = t + 4;
+  if (x > 0) s = s + x * 12 - t; else t = t + 0;
+  if (c > 0) t = t + c * 1; else s = s / c;
+  if (x > 2) s = s + x * 1 - t; else t = t + 2;
+  if (x > 3) s = s + x * 2 - t; else t = t + 3;
+  if (x > 4) s = s + x * 3 - t; else t = t + 4;
+  if (c > 1) t = t + c * 5; else s = s / c;
+  if (x > 6) s = s + x * 5 - t; else t = t + 1;
+  if (x > 7) s = s + x * 6 - t; else t = t + 2;
+  if (x > 8) s = s + x * 7 - t; else t = t + 3;
+  if (c > 2) t = t + c * 2; else s = s / c;
+  if (x > 10) s = s + x * 9 - t; else t = t + 0;
+  if (x > 11) s = s + x * 10 - t; else t = t + 1;
+  if (x > 12) s = s + x * 11 - t; else t = t + 2;
+  if (c > 0) t = t + c * 6; else s = s / c;
+  if (x > 14) s = s + x * 0 - t; else t = t + 4;
+  if (x > 15) s = s + x * 1 - t; else t = t + 0;
+  if (x > 16) s = s + x * 2 - t; else t = t + 1;
+  if (c > 1) t = t + c * 3; else s = s / c;
+  if (x > 18) s = s + x * 4 - t; else t = t + 3;
+  if (x > 19) s = s + x * 5 - t; else t = t + 4;
+  if (x > 20) s = s + x * 6 - t; else t = t + 0;
+  if (c > 2) t = t + c * 0; else s = s / c;
+  if (x > 22) s = s + x * 8 - t; else t = t + 2;
+  if (x > 23) s = s + x * 9 - t; else t = t + 3;
+  if (x > 24) s = s + x * 10 - t; else t = t + 4;
+  if (c > 0) t = t + c * 4; else s = s / c;
+  if (x > 26) s = s + x * 12 - t; else t = t + 1;
+  if (x > 27) s = s + x * 0 - t; else t = t + 2;
+  if (x > 28) s = s + x * 1 - t; else t = t + 3;
+  if (c > 1) t = t + c * 1; else s = s / c;
+  if (x > 30) s = s + x * 3 - t; else t = t + 0;
+  if (x > 31) s = s + x * 4 - t; else t = t + 1;
+  if (x > 32) s = s + x * 5 - t; else t = t + 2;
+  if (c > 2) t = t + c * 5; else s = s / c;
+  if (x > 34) s = s + x * 7 - t; else t = t + 4;
+  if (x > 35) s = s + x * 8 - t; else t = t + 0;
+  if (x > 36) s = s + x * 9 - t; else t = t + 1;
+  if (c > 0) t = t + c * 2; else s = s / c;
+  if (x > 38) s = s + x * 11 - t; else t = t + 3;
+  if (x > 39) s = s + x * 12 - t; else t = t + 4;
+  if (x > 40) s = s + x * 0 - t; else t = t + 0;
+  if (c > 1) t = t + c * 6; else s = s / c;
+  if (x > 42) s = s + x * 2 - t; else t = t + 2;
+  if (x > 43) s = s + x * 3 - t; else t = t + 3;
+  if (x > 44) s = s + x * 4 - t; else t = t + 4;
+  if (c > 2) t = t + c * 3; else s = s / c;
+  if (x > 46) s = s + x * 6 - t; else t = t + 1;
+  if (x > 47) s = s + x * 7 - t; else t = t + 2;
+  if (x > 48) s = s + x * 8 - t; else t = t + 3;
+  if (c > 0) t = t + c * 0; else s = s / c;
+  if (x > 0) s = s + x * 10 - t; else t = t + 0;
+  if (x > 1) s = s + x * 11 - t; else t = t + 1;
+  if (x > 2) s = s + x * 12 - t; else t = t + 2;
+  if (c > 1) t = t + c * 4; else s = s / c;
+  if (x > 4) s = s + x * 1 - t; else t = t + 4;
+  if (x > 5) s = s + x * 2 - t; else t = t + 0;
+  if (x > 6) s = s + x * 3 - t; else t = t + 1;
+  if (c > 2) t = t + c * 1; else s = s / c;
+  if (x > 8) s = s + x * 5 - t; else t = t + 3;
+  if (x > 9) s = s + x * 6 - t; else t = t + 4;
+  if (x > 10) s = s + x * 7 - t; else t = t + 0;
+  if (c > 0) t = t + c * 5; else s = s / c;
+  if (x > 12) s = s + x * 9 - t; else t = t + 2;
+  if (x > 13) s = s + x * 10 - t; else t = t + 3;
+  if (x > 14) s = s + x * 11 - t; else t = t + 4;
+  if (c > 1) t = t + c * 2; else s = s / c;
+  if (x > 16) s = s + x * 0 - t; else t = t + 1;
+  if (x > 17) s = s + x * 1 - t; else t = t + 2;
+  if (x > 18) s = s + x * 2 - t; else t = t + 3;
+  if (c > 2) t = t + c * 6; else s = s / c;
+  if (x > 20) s = s + x * 4 - t; else t = t + 0;
+  if (x > 21) s = s + x * 5 - t; else t = t + 1;
+  if (x > 22) s = s + x * 6 - t; else t = t + 2;
+  if (c > 0) t = t + c * 3; else s = s / c;
+  if (x > 24) s = s + x * 8 - t; else t = t + 4;
+  if (x > 25) s = s + x * 9 - t; else t = t + 0;
+  if (x > 26) s = s + x * 10 - t; else t = t + 1;
+  if (c > 1) t = t + c * 0; else s = s / c;
+  if (x > 28) s = s + x * 12 - t; else t = t + 3;
+  if (x > 29) s = s + x * 0 - t; else t = t + 4;
+  if (x > 30) s = s + x * 1 - t; else t = t + 0;
+  if (c > 2) t = t + c * 4; else s = s / c;
+  if (x > 32) s = s + x * 3 - t; else t = t + 2;
+  if (x > 33) s = s + x * 4 - t; else t = t + 3;
+  if (x > 34) s = s + x * 5 - t; else t = t + 4;
+  if (c > 0) t = t + c * 1; else s = s / c;
+  if (x > 36) s = s + x * 7 - t; else t = t + 1;
+  if (x > 37) s = s + x * 8 - t; else t = t + 2;
+  if (x > 38) s = s + x * 9 - t; else t = t + 3;
+  if (c > 1) t = t + c * 5; else s = s / c;
+  if (x > 40) s = s + x * 11 - t; else t = t + 0;
+  if (x > 41) s = s + x * 12 - t; else t = t + 1;
+  if (x > 42) s = s + x * 0 - t; else t = t + 2;
+  if (c > 2) t = t + c * 2; else s = s / c;
+  if (x > 44) s = s + x * 2 - t; else t = t + 4;
+  if (x > 45) s = s + x * 3 - t; else t = t + 0;
+  if (x > 46) s = s + x * 4 - t; else t = t + 1;
+  if (c > 0) t = t + c * 6; else s = s / c;
+  if (x > 48) s = s + x * 6 - t; else t = t + 3;
+  if (x > 49) s = s + x * 7 - t; else t = t + 4;
+  if (x > 0) s = s + x * 8 - t; else t = t + 0;
+  if (c > 1) t = t + c * 3; else s = s / c;
+  if (x > 2) s = s + x * 10 - t; else t = t + 2;
+  if (x > 3) s = s + x * 11 - t; else t = t + 3;
+  if (x > 4) s = s + x * 12 - t; else t = t + 4;
+  if (c > 2) t = t + c * 0; else s = s / c;
+  if (x > 6) s = s + x * 1 - t; else t = t + 1;
+  if (x > 7) s = s + x * 2 - t; else t = t + 2;
+  if (x > 8) s = s + x * 3 - t; else t = t + 3;
+  if (c > 0) t = t + c * 4; else s = s / c;
+  if (x > 10) s = s + x * 5 - t; else t = t + 0;
+  if (x > 11) s = s + x * 6 - t; else t = t + 1;
+  if (x > 12) s = s + x * 7 - t; else t = t + 2;
+  if (c > 1) t = t + c * 1; else s = s / c;
+  if (x > 14) s = s + x * 9 - t; else t = t + 4;
+  if (x > 15) s = s + x * 10 - t; else t = t + 0;
+  if (x > 16) s = s + x * 11 - t; else t = t + 1;
+  if (c > 2) t = t + c * 5; else s = s / c;
+  if (x > 18) s = s + x * 0 - t; else t = t + 3;
+  if (x > 19) s = s + x * 1 - t; else t = t + 4;
+  if (x > 20) s = s + x * 2 - t; else t = t + 0;
+  if (c > 0) t = t + c * 2; else s = s / c;
+  if (x > 22) s = s + x * 4 - t; else t = t + 2;
+  if (x > 23) s = s + x * 5 - t; else t = t + 3;
+  if (x > 24) s = s + x * 6 - t; else t = t + 4;
+  if (c > 1) t = t + c * 6; else s = s / c;
+  if (x > 26) s = s + x * 8 - t; else t = t + 1;
+  if (x > 27) s = s + x * 9 - t; else t = t + 2;
+  if (x > 28) s = s + x * 10 - t; else t = t + 3;
+  if (c > 2) t = t + c * 3; else s = s / c;
+  if (x > 30) s = s + x * 12 - t; else t = t + 0;
+  if (x > 31) s = s + x * 0 - t; else t = t + 1;
+  if (x > 32) s = s + x * 1 - t; else t = t + 2;
+  if (c > 0) t = t + c * 0; else s = s / c;
+  if (x > 34) s = s + x * 3 - t; else t = t + 4;
+  if (x > 35) s = s + x * 4 - t; else t = t + 0;
+  if (x > 36) s = s + x * 5 - t; else t = t + 1;
+  if (c > 1) t = t + c * 4; else s = s / c;
+  if (x > 38) s = s + x * 7 - t; else t = t + 3;
+  if (x > 39) s = s + x * 8 - t; else t = t + 4;
+  if (x > 40) s = s + x * 9 - t; else t = t + 0;
+  if (c > 2) t = t + c * 1; else s = s / c;
+  if (x > 42) s = s + x * 11 - t; else t = t + 2;
+  if (x > 43) s = s + x * 12 - t; else t = t + 3;
+  if (x > 44) s = s + x * 0 - t; else t = t + 4;
+  if (c > 0) t = t + c * 5; else s = s / c;
+  if (x > 46) s = s + x * 2 - t; else t = t + 1;
+  if (x > 47) s = s + x * 3 - t; else t = t + 2;
+  if (x > 48) s = s + x * 4 - t; else t = t + 3;
+  if (c > 1) t = t + c * 2; else s = s / c;
+  if (x > 0) s = s + x * 6 - t; else t = t + 0;
+  if (x > 1) s = s + x * 7 - t; else t = t + 1;
+  if (x > 2) s = s + x * 8 - t; else t = t + 2;
+  if (c > 2) t = t + c * 6; else s = s / c;
+  if (x > 4) s = s + x * 10 - t; else t = t + 4;
+  if (x > 5) s = s + x * 11 - t; else t = t + 0;
+  if (x > 6) s = s + x * 12 - t; else t = t + 1;
+  if (c > 0) t = t + c * 3; else s = s / c;
+  if (x > 8) s = s + x * 1 - t; else t = t + 3;
+  if (x > 9) s = s + x * 2 - t; else t = t + 4;
+  if (x > 10) s = s + x * 3 - t; else t = t + 0;
+  if (c > 1) t = t + c * 0; else s = s / c;
+  if (x > 12) s = s + x * 5 - t; else t = t + 2;
+  if (x > 13) s = s + x * 6 - t; else t = t + 3;
+  if (x > 14) s = s + x * 7 - t; else t = t + 4;
+  if (c > 2) t = t + c * 4; else s = s / c;
+  if (x > 16) s = s + x * 9 - t; else t = t + 1;
+  if (x > 17) s = s + x * 10 - t; else t = t + 2;
+  if (x > 18) s = s + x * 11 - t; else t = t + 3;
+  if (c > 0) t = t + c * 1; else s = s / c;
+  if (x > 20) s = s + x * 0 - t; else t = t + 0;
+  if (x > 21) s = s + x * 1 - t; else t = t + 1;
+  if (x > 22) s = s + x * 2 - t; else t = t + 2;
+  if (c > 1) t = t + c * 5; else s = s / c;
+  if (x > 24) s = s + x * 4 - t; else t = t + 4;
+  if (x > 25) s = s + x * 5 - t; else t = t + 0;
+  if (x > 26) s = s + x * 6 - t; else t = t + 1;
+  if (c > 2) t = t + c * 2; else s = s / c;
+  if (x > 28) s = s + x * 8 - t; else t = t + 3;
+  if (x > 29) s = s + x * 9 - t; else t = t + 4;
+  if (x > 30) s = s + x * 10 - t; else t = t + 0;
+  if (c > 0) t = t + c * 6; else s = s / c;
+  if (x > 32) s = s + x * 12 - t; else t = t + 2;
+  if (x > 33) s = s + x * 0 - t; else t = t + 3;
+  if (x > 34) s = s + x * 1 - t; else t = t + 4;
+  if (c > 1) t = t + c * 3; else s = s / c;
+  if (x > 36) s = s + x * 3 - t; else t = t + 1;
+  if (x > 37) s = s + x * 4 - t; else t = t + 2;
+  if (x > 38) s = s + x * 5 - t; else t = t + 3;
+  if (c > 2) t = t + c * 0; else s = s / c;
+  if (x > 40) s = s + x * 7 - t; else t = t + 0;
+  if (x > 41) s = s + x * 8 - t; else t = t + 1;
+  if (x > 42) s = s + x * 9 - t; else t = t + 2;
+  if (c > 0) t = t + c * 4; else s = s / c;
+  if (x > 44) s = s + x * 11 - t; else t = t + 4;
+  if (x > 45) s = s + x * 12 - t; else t = t + 0;
+  if (x > 46) s = s + x * 0 - t; else t = t + 1;
+  if (c > 1) t = t + c * 1; else s = s / c;
+  if (x > 48) s = s + x * 2 - t; else t = t + 3;
+  if (x > 49) s = s + x * 3 - t; else t = t + 4;
+  if (x > 0) s = s + x * 4 - t; else t = t + 0;
+  if (c > 2) t = t + c * 5; else s = s / c;
+  if (x > 2) s = s + x * 6 - t; else t = t + 2;
+  if (x > 3) s = s + x * 7 - t; else t = t + 3;
+  if (x > 4) s = s + x * 8 - t; else t = t + 4;
+  if (c > 0) t = t + c * 2; else s = s / c;
+  if (x > 6) s = s + x * 10 - t; else t = t + 1;
+  if (x > 7) s = s + x * 11 - t; else t = t + 2;
+  if (x > 8) s = s + x * 12 - t; else t = t + 3;
+  if (c > 1) t = t + c * 6; else s = s / c;
+  if (x > 10) s = s + x * 1 - t; else t = t + 0;
+  if (x > 11) s = s + x * 2 - t; else t = t + 1;
+  if (x > 12) s = s + x * 3 - t; else t = t + 2;
+  if (c > 2) t = t + c * 3; else s = s / c;
+  if (x > 14) s = s + x * 5 - t; else t = t + 4;
+  if (x > 15) s = s + x * 6 - t; else t = t + 0;
+  if (x > 16) s = s + x * 7 - t; else t = t + 1;
+  if (c > 0) t = t + c * 0; else s = s / c;
+  if (x > 18) s = s + x * 9 - t; else t = t + 3;
+  if (x > 19) s = s + x * 10 - t; else t = t + 4;
+  if (x > 20) s = s + x * 11 - t; else t = t + 0;
+  if (c > 1) t = t + c * 4; else s = s / c;
+  if (x > 22) s = s + x * 0 - t; else t = t + 2;
+  if (x > 23) s = s + x * 1 - t; else t = t + 3;
+  if (x > 24) s = s + x * 2 - t; else t = t + 4;
+  if (c > 2) t = t + c * 1; else s = s / c;
+  if (x > 26) s = s + x * 4 - t; else t = t + 1;
+  if (x > 27) s = s + x * 5 - t; else t = t + 2;
+  if (x > 28) s = s + x * 6 - t; else t = t + 3;
+  if (c > 0) t = t + c * 5; else s = s / c;
+  if (x > 30) s = s + x * 8 - t; else t = t + 0;
+  if (x > 31) s = s + x * 9 - t; else t = t + 1;
+  if (x > 32) s = s + x * 10 - t; else t = t + 2;
+  if (c > 1) t = t + c * 2; else s = s / c;
+  if (x > 34) s = s + x * 12 - t; else t = t + 4;
+  if (x > 35) s = s + x * 0 - t; else t = t + 0;
+  if (x > 36) s = s + x * 1 - t; else t = t + 1;
+  if (c > 2) t = t + c * 6; else s = s / c;
+  if (x > 38) s = s + x * 3 - t; else t = t + 3;
+  if (x > 39) s = s + x * 4 - t; else t = t + 4;
+  if (x > 40) s = s + x * 5 - t; else t = t + 0;
+  if (c > 0) t = t + c * 3; else s = s / c;
+  if (x > 42) s = s + x * 7 - t; else t = t + 2;
+  if (x > 43) s = s + x * 8 - t; else t = t + 3;
+  if (x > 44) s = s + x * 9 - t; else t = t + 4;
+  if (c > 1) t = t + c * 0; else s = s / c;
+  if (x > 46) s = s + x * 11 - t; else t = t + 1;
+  if (x > 47) s = s + x * 12 - t; else t = t + 2;
+  if (x > 48) s = s + x * 0 - t; else t = t + 3;
+  if (c > 2) t = t + c * 4; else s = s / c;
+  if (x > 0) s = s + x * 2 - t; else t = t + 0;
+  if (x > 1) s = s + x * 3 - t; else t = t + 1;
+  if (x > 2) s = s + x * 4 - t; else t = t + 2;
+  if (c > 0) t = t + c * 1; else s = s / c;
+  if (x > 4) s = s + x * 6 - t; else t = t + 4;
+  if (x > 5) s = s + x * 7 - t; else t = t + 0;
+  if (x > 6) s = s + x * 8 - t; else t = t + 1;
+  if (c > 1) t = t + c * 5; else s = s / c;
+  if (x > 8) s = s + x * 10 - t; else t = t + 3;
+  if (x > 9) s = s + x * 11 - t; else t = t + 4;
+  if (x > 10) s = s + x * 12 - t; else t = t + 0;
+  if (c > 2) t = t + c * 2; else s = s / c;
+  if (x > 12) s = s + x * 1 - t; else t = t + 2;
+  if (x > 13) s = s + x * 2 - t; else t = t + 3;
+  if (x > 14) s = s + x * 3 - t; else t = t + 4;
+  if (c > 0) t = t + c * 6; else s = s / c;
+  if (x > 16) s = s + x * 5 - t; else t = t + 1;
+  if (x > 17) s = s + x * 6 - t; else t = t + 2;
+  if (x > 18) s = s + x * 7 - t; else t = t + 3;
+  if (c > 1) t = t + c * 3; else s = s / c;
+  if (x > 20) s = s + x * 9 - t; else t = t + 0;
+  if (x > 21) s = s + x * 10 - t; else t = t + 1;
+  if (x > 22) s = s + x * 11 - t; else t = t + 2;
+  if (c > 2) t = t + c * 0; else s = s / c;
+  if (x > 24) s = s + x * 0 - t; else t = t + 4;
+  if (x > 25) s = s + x * 1 - t; else t = t + 0;
+  if (x > 26) s = s + x * 2 - t; else t = t + 1;
+  if (c > 0) t = t + c * 4; else s = s / c;
+  if (x > 28) s = s + x * 4 - t; else t = t + 3;
+  if (x > 29) s = s + x * 5 - t; else t = t + 4;
+  if (x > 30) s = s + x * 6 - t; else t = t + 0;
+  if (c > 1) t = t + c * 1; else s = s / c;
+  if (x > 32) s = s + x * 8 - t; else t = t + 2;
+  if (x > 33) s = s + x * 9 - t; else t = t + 3;
+  if (x > 34) s = s + x * 10 - t; else t = t + 4;
+  if (c > 2) t = t + c * 5; else s = s / c;
+  if (x > 36) s = s + x * 12 - t; else t = t + 1;
+  if (x > 37) s = s + x * 0 - t; else t = t + 2;
+  if (x > 38) s = s + x * 1 - t; else t = t + 3;
+  if (c > 0) t = t + c * 2; else s = s / c;
+  if (x > 40) s = s + x * 3 - t; else t = t + 0;
+  if (x > 41) s = s + x * 4 - t; else t = t + 1;
+  if (x > 42) s = s + x * 5 - t; else t = t + 2;
+  if (c > 1) t = t + c * 6; else s = s / c;
+  if (x > 44) s = s + x * 7 - t; else t = t + 4;
+  if (x > 45) s = s + x * 8 - t; else t = t + 0;
+  if (x > 46) s = s + x * 9 - t; else t = t + 1;
+  if (c > 2) t = t + c * 3; else s = s / c;
+  if (x > 48) s = s + x * 11 - t; else t = t + 3;
+  if (x > 49) s = s + x * 12 - t; else t = t + 4;
+  if (x > 0) s = s + x * 0 - t; else t = t + 0;
+  if (c > 0) t = t + c * 0; else s = s / c;
+  if (x > 2) s = s + x * 2 - t; else t = t + 2;
+  if (x > 3) s = s + x * 3 - t; else t = t + 3;
+  if (x > 4) s = s + x * 4 - t; else t = t + 4;
+  if (c > 1) t = t + c * 4; else s = s / c;
+  if (x > 6) s = s + x * 6 - t; else t = t + 1;
+  if (x > 7) s = s + x * 7 - t; else t = t + 2;
+  if (x > 8) s = s + x * 8 - t; else t = t + 3;
+  if (c > 2) t = t + c * 1; else s = s / c;
+  if (x > 10) s = s + x * 10 - t; else t = t + 0;
+  if (x > 11) s = s + x * 11 - t; else t = t + 1;
+  if (x > 12) s = s + x * 12 - t; else t = t + 2;
+  if (c > 0) t = t + c * 5; else s = s / c;
+  if (x > 14) s = s + x * 1 - t; else t = t + 4;
+  if (x > 15) s = s + x * 2 - t; else t = t + 0;
+  if (x > 16) s = s + x * 3 - t; else t = t + 1;
+  if (c > 1) t = t + c * 2; else s = s / c;
+  if (x > 18) s = s + x * 5 - t; else t = t + 3;
+  if (x > 19) s = s + x * 6 - t; else t = t + 4;
+  if (x > 20) s = s + x * 7 - t; else t = t + 0;
+  if (c > 2) t = t + c * 6; else s = s / c;
+  if (x > 22) s = s + x * 9 - t; else t = t + 2;
+  if (x > 23) s = s + x * 10 - t; else t = t + 3;
+  if (x > 24) s = s + x * 11 - t; else t = t + 4;
+  if (c > 0) t = t + c * 3; else s = s / c;
+  if (x > 26) s = s + x * 0 - t; else t = t + 1;
+  if (x > 27) s = s + x * 1 - t; else t = t + 2;
+  if (x > 28) s = s + x * 2 - t; else t = t + 3;
+  if (c > 1) t = t + c * 0; else s = s / c;
+  if (x > 30) s = s + x * 4 - t; else t = t + 0;
+  if (x > 31) s = s + x * 5 - t; else t = t + 1;
+  if (x > 32) s = s + x * 6 - t; else t = t + 2;
+  if (c > 2) t = t + c * 4; else s = s / c;
+  if (x > 34) s = s + x * 8 - t; else t = t + 4;
+  if (x > 35) s = s + x * 9 - t; else t = t + 0;
+  if (x > 36) s = s + x * 10 - t; else t = t + 1;
+  if (c > 0) t = t + c * 1; else s = s / c;
+  if (x > 38) s = s + x * 12 - t; else t = t + 3;
+  if (x > 39) s = s + x * 0 - t; else t = t + 4;
+  if (x > 40) s = s + x * 1 - t; else t = t + 0;
+  if (c > 1) t = t + c * 5; else s = s / c;
+  if (x > 42) s = s + x * 3 - t; else t = t + 2;
+  if (x > 43) s = s + x * 4 - t; else t = t + 3;
+  if (x > 44) s = s + x * 5 - t; else t = t + 4;
+  if (c > 2) t = t + c * 2; else s = s / c;
+  if (x > 46) s = s + x * 7 - t; else t = t + 1;
+  if (x > 47) s = s + x * 8 - t; else t = t + 2;
+  if (x > 48) s = s + x * 9 - t; else t = t + 3;
+  if (c > 0) t = t + c * 6; else s = s / c;
+  if (x > 0) s = s + x * 11 - t; else t = t + 0;
+  if (x > 1) s = s + x * 12 - t; else t = t + 1;
+  if (x > 2) s = s + x * 0 - t; else t = t + 2;
+  if (c > 1) t = t + c * 3; else s = s / c;
+  if (x > 4) s = s + x * 2 - t; else t = t + 4;
+  if (x > 5) s = s + x * 3 - t; else t = t + 0;
+  if (x > 6) s = s + x * 4 - t; else t = t + 1;
+  if (c > 2) t = t + c * 0; else s = s / c;
+  if (x > 8) s = s + x * 6 - t; else t = t + 3;
+  if (x > 9) s = s + x * 7 - t; else t = t + 4;
+  if (x > 10) s = s + x * 8 - t; else t = t + 0;
+  if (c > 0) t = t + c * 4; else s = s / c;
+  if (x > 12) s = s + x * 10 - t; else t = t + 2;
+  if (x > 13) s = s + x * 11 - t; else t = t + 3;
+  if (x > 14) s = s + x * 12 - t; else t = t + 4;
+  if (c > 1) t = t + c * 1; else s = s / c;
+  if (x > 16) s = s + x * 1 - t; else t = t + 1;
+  if (x > 17) s = s + x * 2 - t; else t = t + 2;
+  if (x > 18) s = s + x * 3 - t; else t = t + 3;
+  if (c > 2) t = t + c * 5; else s = s / c;
+  if (x > 20) s = s + x * 5 - t; else t = t + 0;
+  if (x > 21) s = s + x * 6 - t; else t = t + 1;
+  if (x > 22) s = s + x * 7 - t; else t = t + 2;
+  if (c > 0) t = t + c * 2; else s = s / c;
+  if (x > 24) s = s + x * 9 - t; else t = t + 4;
+  if (x > 25) s = s + x * 10 - t; else t = t + 0;
+  if (x > 26) s = s + x * 11 - t; else t = t + 1;
+  if (c > 1) t = t + c * 6; else s = s / c;
+  if (x > 28) s = s + x * 0 - t; else t = t + 3;
+  if (x > 29) s = s + x * 1 - t; else t = t + 4;
+  if (x > 30) s = s + x * 2 - t; else t = t + 0;
+  if (c > 2) t = t + c * 3; else s = s / c;
+  if (x > 32) s = s + x * 4 - t; else t = t + 2;
+  if (x > 33) s = s + x * 5 - t; else t = t + 3;
+  if (x > 34) s = s + x * 6 - t; else t = t + 4;
+  if (c > 0) t = t + c * 0; else s = s / c;
+  if (x > 36) s = s + x * 8 - t; else t = t + 1;
+  if (x > 37) s = s + x * 9 - t; else t = t + 2;
+  if (x > 38) s = s + x * 10 - t; else t = t + 3;
+  if (c > 1) t = t + c * 4; else s = s / c;
+  if (x > 40) s = s + x * 12 - t; else t = t + 0;
+  if (x > 41) s = s + x * 0 - t; else t = t + 1;
+  if (x > 42) s = s + x * 1 - t; else t = t + 2;
+  if (c > 2) t = t + c * 1; else s = s / c;
+  if (x > 44) s = s + x * 3 - t; else t = t + 4;
+  if (x > 45) s = s + x * 4 - t; else t = t + 0;
+  if (x > 46) s = s + x * 5 - t; else t = t + 1;
+  if (c > 0) t = t + c * 5; else s = s / c;
+  if (x > 48) s = s + x * 7 - t; else t = t + 3;
+  if (x > 49) s = s + x * 8 - t; else t = t + 4;
+  if (x > 0) s = s + x * 9 - t; else t = t + 0;
+  if (c > 1) t = t + c * 2; else s = s / c;
+  if (x > 2) s = s + x * 11 - t; else t = t + 2;
+  if (x > 3) s = s + x * 12 - t; else t = t + 3;
+  if (x > 4) s = s + x * 0 - t; else t = t + 4;
+  if (c > 2) t = t + c * 6; else s = s / c;
+  if (x > 6) s = s + x * 2 - t; else t = t + 1;
+  if (x > 7) s = s + x * 3 - t; else t = t + 2;
+  if (x > 8) s = s + x * 4 - t; else t = t + 3;
+  if (c > 0) t = t + c * 3; else s = s / c;
+  if (x > 10) s = s + x * 6 - t; else t = t + 0;
+  if (x > 11) s = s + x * 7 - t; else t = t + 1;
+  if (x > 12) s = s + x * 8 - t; else t = t + 2;
+  if (c > 1) t = t + c * 0; else s = s / c;
+  if (x > 14) s = s + x * 10 - t; else t = t + 4;
+  if (x > 15) s = s + x * 11 - t; else t = t + 0;
+  if (x > 16) s = s + x * 12 - t; else t = t + 1;
+  if (c > 2) t = t + c * 4; else s = s / c;
+  if (x > 18) s = s + x * 1 - t; else t = t + 3;
+  if (x > 19) s = s + x * 2 - t; else t = t + 4;
+  if (x > 20) s = s + x * 3 - t; else t = t + 0;
+  if (c > 0) t = t + c * 1; else s = s / c;
+  if (x > 22) s = s + x * 5 - t; else t = t + 2;
+  if (x > 23) s = s + x * 6 - t; else t = t + 3;
+  if (x > 24) s = s + x * 7 - t; else t = t + 4;
+  if (c > 1) t = t + c * 5; else s = s / c;
+  if (x > 26) s = s + x * 9 - t; else t = t + 1;
+  if (x > 27) s = s + x * 10 - t; else t = t + 2;
+  if (x > 28) s = s + x * 11 - t; else t = t + 3;
+  if (c > 2) t = t + c * 2; else s = s / c;
+  if (x > 30) s = s + x * 0 - t; else t = t + 0;
+  if (x > 31) s = s + x * 1 - t; else t = t + 1;
+  if (x > 32) s = s + x * 2 - t; else t = t + 2;
+  if (c > 0) t = t + c * 6; else s = s / c;
+  if (x > 34) s = s + x * 4 - t; else t = t + 4;
+  if (x > 35) s = s + x * 5 - t; else t = t + 0;
+  if (x > 36) s = s + x * 6 - t; else t = t + 1;
+  if (c > 1) t = t + c * 3; else s = s / c;
+  if (x > 38) s = s + x * 8 - t; else t = t + 3;
+  if (x > 39) s = s + x * 9 - t; else t = t + 4;
+  if (x > 40) s = s + x * 10 - t; else t = t + 0;
+  if (c > 2) t = t + c * 0; else s = s / c;
+  if (x > 42) s = s + x * 12 - t; else t = t + 2;
+  if (x > 43) s = s + x * 0 - t; else t = t + 3;
+  if (x > 44) s = s + x * 1 - t; else t = t + 4;
+  if (c > 0) t = t + c * 4; else s = s / c;
+  if (x > 46) s = s + x * 3 - t; else t = t + 1;
+  if (x > 47) s = s + x * 4 - t; else t = t + 2;
+  if (x > 48) s = s + x * 5 - t; else t = t + 3;
+  if (c > 1) t = t + c * 1; else s = s / c;
+  if (x > 0) s = s + x * 7 - t; else t = t + 0;
+  if (x > 1) s = s + x * 8 - t; else t = t + 1;
+  if (x > 2) s = s + x * 9 - t; else t = t + 2;
+  if (c > 2) t = t + c * 5; else s = s / c;
+  if (x > 4) s = s + x * 11 - t; else t = t + 4;
+  if (x > 5) s = s + x * 12 - t; else t = t + 0;
+  if (x > 6) s = s + x * 0 - t; else t = t + 1;
+  if (c > 0) t = t + c * 2; else s = s / c;
+  if (x > 8) s = s + x * 2 - t; else t = t + 3;
+  if (x > 9) s = s + x * 3 - t; else t = t + 4;
+  if (x > 10) s = s + x * 4 - t; else t = t + 0;
+  if (c > 1) t = t + c * 6; else s = s / c;
+  if (x > 12) s = s + x * 6 - t; else t = t + 2;
+  if (x > 13) s = s + x * 7 - t; else t = t + 3;
+  if (x > 14) s = s + x * 8 - t; else t = t + 4;
+  if (c > 2) t = t + c * 3; else s = s / c;
+  if (x > 16) s = s + x * 10 - t; else t = t + 1;
+  if (x > 17) s = s + x * 11 - t; else t = t + 2;
+  if (x > 18) s = s + x * 12 - t; else t = t + 3;
+  if (c > 0) t = t + c * 0; else s = s / c;
+  if (x > 20) s = s + x * 1 - t; else t = t + 0;
+  if (x > 21) s = s + x * 2 - t; else t = t + 1;
+  if (x > 22) s = s + x * 3 - t; else t = t + 2;
+  if (c > 1) t = t + c * 4; else s = s / c;
+  if (x > 24) s = s + x * 5 - t; else t = t + 4;
+  if (x > 25) s = s + x * 6 - t; else t = t + 0;
+  if (x > 26) s = s + x * 7 - t; else t = t + 1;
+  if (c > 2) t = t + c * 1; else s = s / c;
+  if (x > 28) s = s + x * 9 - t; else t = t + 3;
+  if (x > 29) s = s + x * 10 - t; else t = t + 4;
+  if (x > 30) s = s + x * 11 - t; else t = t + 0;
+  if (c > 0) t = t + c * 5; else s = s / c;
+  if (x > 32) s = s + x * 0 - t; else t = t + 2;
+  if (x > 33) s = s + x * 1 - t; else t = t + 3;
+  if (x > 34) s = s + x * 2 - t; else t = t + 4;
+  if (c > 1) t = t + c * 2; else s = s / c;
+  if (x > 36) s = s + x * 4 - t; else t = t + 1;
+  if (x > 37) s = s + x * 5 - t; else t = t + 2;
+  if (x > 38) s = s + x * 6 - t; else t = t + 3;
+  if (c > 2) t = t + c * 6; else s = s / c;
+  if (x > 40) s = s + x * 8 - t; else t = t + 0;
+  if (x > 41) s = s + x * 9 - t; else t = t + 1;
+  if (x > 42) s = s + x * 10 - t; else t = t + 2;
+  if (c > 0) t = t + c * 3; else s = s / c;
+  if (x > 44) s = s + x * 12 - t; else t = t + 4;
+  if (x > 45) s = s + x * 0 - t; else t = t + 0;
+  if (x > 46) s = s + x * 1 - t; else t = t + 1;
+  if (c > 1) t = t + c * 0; else s = s / c;
+  if (x > 48) s = s + x * 3 - t; else t = t + 3;
+  if (x > 49) s = s + x * 4 - t; else t = t + 4;
+  if (x > 0) s = s + x * 5 - t; else t = t + 0;
+  if (c > 2) t = t + c * 4; else s = s / c;
+  if (x > 2) s = s + x * 7 - t; else t = t + 2;
+  if (x > 3) s = s + x * 8 - t; else t = t + 3;
+  if (x > 4) s = s + x * 9 - t; else t = t + 4;
+  if (c > 0) t = t + c * 1; else s = s / c;
+  if (x > 6) s = s + x * 11 - t; else t = t + 1;
+  if (x > 7) s = s + x * 12 - t; else t = t + 2;
+  if (x > 8) s = s + x * 0 - t; else t = t + 3;
+  if (c > 1) t = t + c * 5; else s = s / c;
+  if (x > 10) s = s + x * 2 - t; else t = t + 0;
+  if (x > 11) s = s + x * 3 - t; else t = t + 1;
+  if (x > 12) s = s + x * 4 - t; else t = t + 2;
+  if (c > 2) t = t + c * 2; else s = s / c;
+  if (x > 14) s = s + x * 6 - t; else t = t + 4;
+  if (x > 15) s = s + x * 7 - t; else t = t + 0;
+  if (x > 16) s = s + x * 8 - t; else t = t + 1;
+  if (c > 0) t = t + c * 6; else s = s / c;
+  if (x > 18) s = s + x * 10 - t; else t = t + 3;
+  if (x > 19) s = s + x * 11 - t; else t = t + 4;
+  if (x > 20) s = s + x * 12 - t; else t = t + 0;
+  if (c > 1) t = t + c * 3; else s = s / c;
+  if (x > 22) s = s + x * 1 - t; else t = t + 2;
+  if (x > 23) s = s + x * 2 - t; else t = t + 3;
+  if (x > 24) s = s + x * 3 - t; else t = t + 4;
+  if (c > 2) t = t + c * 0; else s = s / c;
+  if (x > 26) s = s + x * 5 - t; else t = t + 1;
+  if (x > 27) s = s + x * 6 - t; else t = t + 2;
+  if (x > 28) s = s + x * 7 - t; else t = t + 3;
+  if (c > 0) t = t + c * 4; else s = s / c;
+  if (x > 30) s = s + x * 9 - t; else t = t + 0;
+  if (x > 31) s = s + x * 10 - t; else t = t + 1;
+  if (x > 32) s = s + x * 11 - t; else t = t + 2;
+  if (c > 1) t = t + c * 1; else s = s / c;
+  if (x > 34) s = s + x * 0 - t; else t = t + 4;
+  if (x > 35) s = s + x * 1 - t; else t = t + 0;
+  if (x > 36) s = s + x * 2 - t; else t = t + 1;
+  if (c > 2) t = t + c * 5; else s = s / c;
+  if (x > 38) s = s + x * 4 - t; else t = t + 3;
+  if (x > 39) s = s + x * 5 - t; else t = t + 4;
+  if (x > 40) s = s + x * 6 - t; else t = t + 0;
+  if (c > 0) t = t + c * 2; else s = s / c;
+  if (x > 42) s = s + x * 8 - t; else t = t + 2;
+  if (x > 43) s = s + x * 9 - t; else t = t + 3;
+  if (x > 44) s = s + x * 10 - t; else t = t + 4;
+  if (c > 1) t = t + c * 6; else s = s / c;
+  if (x > 46) s = s + x * 12 - t; else t = t + 1;
+  if (x > 47) s = s + x * 0 - t; else t = t + 2;
+  if (x > 48) s = s + x * 1 - t; else t = t + 3;
+  if (c > 2) t = t + c * 3; else s = s / c;
+  if (x > 0) s = s + x * 3 - t; else t = t + 0;
+  if (x > 1) s = s + x * 4 - t; else t = t + 1;
+  if (x > 2) s = s + x * 5 - t; else t = t + 2;
+  if (c > 0) t = t + c * 0; else s = s / c;
+  if (x > 4) s = s + x * 7 - t; else t = t + 4;
+  if (x > 5) s = s + x * 8 - t; else t = t + 0;
+  if (x > 6) s = s + x * 9 - t; else t = t + 1;
+  if (c > 1) t = t + c * 4; else s = s / c;
+  if (x > 8) s = s + x * 11 - t; else t = t + 3;
+  if (x > 9) s = s + x * 12 - t; else t = t + 4;
+  if (x > 10) s = s + x * 0 - t; else t = t + 0;
+  if (c > 2) t = t + c * 1; else s = s / c;
+  if (x > 12) s = s + x * 2 - t; else t = t + 2;
+  if (x > 13) s = s + x * 3 - t; else t = t + 3;
+  if (x > 14) s = s + x * 4 - t; else t = t + 4;
+  if (c > 0) t = t + c * 5; else s = s / c;
+  if (x > 16) s = s + x * 6 - t; else t = t + 1;
+  if (x > 17) s = s + x * 7 - t; else t = t + 2;
+  if (x > 18) s = s + x * 8 - t; else t = t + 3;
+  if (c > 1) t = t + c * 2; else s = s / c;
+  if (x > 20) s = s + x * 10 - t; else t = t + 0;
+  if (x > 21) s = s + x * 11 - t; else t = t + 1;
+  if (x > 22) s = s + x * 12 - t; else t = t + 2;
+  if (c > 2) t = t + c * 6; else s = s / c;
+  if (x > 24) s = s + x * 1 - t; else t = t + 4;
+  if (x > 25) s = s + x * 2 - t; else t = t + 0;
+  if (x > 26) s = s + x * 3 - t; else t = t + 1;
+  if (c > 0) t = t + c * 3; else s = s / c;
+  if (x > 28) s = s + x * 5 - t; else t = t + 3;
+  if (x > 29) s = s + x * 6 - t; else t = t + 4;
+  if (x > 30) s = s + x * 7 - t; else t = t + 0;
+  if (c > 1) t = t + c * 0; else s = s / c;
+  if (x > 32) s = s + x * 9 - t; else t = t + 2;
+  if (x > 33) s = s + x * 10 - t; else t = t + 3;
+  if (x > 34) s = s + x * 11 - t; else t = t + 4;
+  if (c > 2) t = t + c * 4; else s = s / c;
+  if (x > 36) s = s + x * 0 - t; else t = t + 1;
+  if (x > 37) s = s + x * 1 - t; else t = t + 2;
+  if (x > 38) s = s + x * 2 - t; else t = t + 3;
+  if (c > 0) t = t + c * 1; else s = s / c;
+  if (x > 40) s = s + x * 4 - t; else t = t + 0;
+  if (x > 41) s = s + x * 5 - t; else t = t + 1;
+  if (x > 42) s = s + x * 6 - t; else t = t + 2;
+  if (c > 1) t = t + c * 5; else s = s / c;
+  if (x > 44) s = s + x * 8 - t; else t = t + 4;
+  if (x > 45) s = s + x * 9 - t; else t = t + 0;
+  if (x > 46) s = s + x * 10 - t; else t = t + 1;
+  if (c > 2) t = t + c * 2; else s = s / c;
+  if (x > 48) s = s + x * 12 - t; else t = t + 3;
+  if (x > 49) s = s + x * 0 - t; else t = t + 4;
+  if (x > 0) s = s + x * 1 - t; else t = t + 0;
+  if (c > 0) t = t + c * 6; else s = s / c;
+  if (x > 2) s = s + x * 3 - t; else t = t + 2;
+  if (x > 3) s = s + x * 4 - t; else t = t + 3;
+  if (x > 4) s = s + x * 5 - t; else t = t + 4;
+  if (c > 1) t = t + c * 3; else s = s / c;
+  if (x > 6) s = s + x * 7 - t; else t = t + 1;
+  if (x > 7) s = s + x * 8 - t; else t = t + 2;
+  if (x > 8) s = s + x * 9 - t; else t = t + 3;
+  if (c > 2) t = t + c * 0; else s = s / c;
+  if (x > 10) s = s + x * 11 - t; else t = t + 0;
+  if (x > 11) s = s + x * 12 - t; else t = t + 1;
+  if (x > 12) s = s + x * 0 - t; else t = t + 2;
+  if (c > 0) t = t + c * 4; else s = s / c;
+  if (x > 14) s = s + x * 2 - t; else t = t + 4;
+  if (x > 15) s = s + x * 3 - t; else t = t + 0;
+  if (x > 16) s = s + x * 4 - t; else t = t + 1;
+  if (c > 1) t = t + c * 1; else s = s / c;
+  if (x > 18) s = s + x * 6 - t; else t = t + 3;
+  if (x > 19) s = s + x * 7 - t; else t = t + 4;
+  if (x > 20) s = s + x * 8 - t; else t = t + 0;
+  if (c > 2) t = t + c * 5; else s = s / c;
+  if (x > 22) s = s + x * 10 - t; else t = t + 2;
+  if (x > 23) s = s + x * 11 - t; else t = t + 3;
+  if (x > 24) s = s + x * 12 - t; else t = t + 4;
+  if (c > 0) t = t + c * 2; else s = s / c;
+  if (x > 26) s = s + x * 1 - t; else t = t + 1;
+  if (x > 27) s = s + x * 2 - t; else t = t + 2;
+  if (x > 28) s = s + x * 3 - t; else t = t + 3;
+  if (c > 1) t = t + c * 6; else s = s / c;
+  if (x > 30) s = s + x * 5 - t; else t = t + 0;
+  if (x > 31) s = s + x * 6 - t; else t = t + 1;
+  if (x > 32) s = s + x * 7 - t; else t = t + 2;
+  if (c > 2) t = t + c * 3; else s = s / c;
+  if (x > 34) s = s + x * 9 - t; else t = t + 4;
+  if (x > 35) s = s + x * 10 - t; else t = t + 0;
+  if (x > 36) s = s + x * 11 - t; else t = t + 1;
+  if (c > 0) t = t + c * 0; else s = s / c;
+  if (x > 38) s = s + x * 0 - t; else t = t + 3;
+  if (x > 39) s = s + x * 1 - t; else t = t + 4;
+  if (x > 40) s = s + x * 2 - t; else t = t + 0;
+  if (c > 1) t = t + c * 4; else s = s / c;
+  if (x > 42) s = s + x * 4 - t; else t = t + 2;
+  if (x > 43) s = s + x * 5 - t; else t = t + 3;
+  if (x > 44) s = s + x * 6 - t; else t = t + 4;
+  if (c > 2) t = t + c * 1; else s = s / c;
+  if (x > 46) s = s + x * 8 - t; else t = t + 1;
+  if (x > 47) s = s + x * 9 - t; else t = t + 2;
+  if (x > 48) s = s + x * 10 - t; else t = t + 3;
+  if (c > 0) t = t + c * 5; else s = s / c;
+  if (x > 0) s = s + x * 12 - t; else t = t + 0;
+  if (x > 1) s = s + x * 0 - t; else t = t + 1;
+  if (x > 2) s = s + x * 1 - t; else t = t + 2;
+  if (c > 1) t = t + c * 2; else s = s / c;
+  if (x > 4) s = s + x * 3 - t; else t = t + 4;
+  if (x > 5) s = s + x * 4 - t; else t = t + 0;
+  if (x > 6) s = s + x * 5 - t; else t = t + 1;
+  if (c > 2) t = t + c * 6; else s = s / c;
+  if (x > 8) s = s + x * 7 - t; else t = t + 3;
+  if (x > 9) s = s + x * 8 - t; else t = t + 4;
+  if (x > 10) s = s + x * 9 - t; else t = t + 0;
+  if (c > 0) t = t + c * 3; else s = s / c;
+  if (x > 12) s = s + x * 11 - t; else t = t + 2;
+  if (x > 13) s = s + x * 12 - t; else t = t + 3;
+  if (x > 14) s = s + x * 0 - t; else t = t + 4;
+  if (c > 1) t = t + c * 0; else s = s / c;
+  if (x > 16) s = s + x * 2 - t; else t = t + 1;
+  if (x > 17) s = s + x * 3 - t; else t = t + 2;
+  if (x > 18) s = s + x * 4 - t; else t = t + 3;
+  if (c > 2) t = t + c * 4; else s = s / c;
+  if (x > 20) s = s + x * 6 - t; else t = t + 0;
+  if (x > 21) s = s + x * 7 - t; else t = t + 1;
+  if (x > 22) s = s + x * 8 - t; else t = t + 2;
+  if (c > 0) t = t + c * 1; else s = s / c;
+  if (x > 24) s = s + x * 10 - t; else t = t + 4;
+  if (x > 25) s = s + x * 11 - t; else t = t + 0;
+  if (x > 26) s = s + x * 12 - t; else t = t + 1;
+  if (c > 1) t = t + c * 5; else s = s / c;
+  if (x > 28) s = s + x * 1 - t; else t = t + 3;
+  if (x > 29) s = s + x * 2 - t; else t = t + 4;
+  if (x > 30) s = s + x * 3 - t; else t = t + 0;
+  if (c > 2) t = t + c * 2; else s = s / c;
+  if (x > 32) s = s + x * 5 - t; else t = t + 2;
+  if (x > 33) s = s + x * 6 - t; else t = t + 3;
+  if (x > 34) s = s + x * 7 - t; else t = t + 4;
+  if (c > 0) t = t + c * 6; else s = s / c;
+  if (x > 36) s = s + x * 9 - t; else t = t + 1;
+  if (x > 37) s = s + x * 10 - t; else t = t + 2;
+  if (x > 38) s = s + x * 11 - t; else t = t + 3;
+  if (c > 1) t = t + c * 3; else s = s / c;
+  if (x > 40) s = s + x * 0 - t; else t = t + 0;
+  if (x > 41) s = s + x * 1 - t; else t = t + 1;
+  if (x > 42) s = s + x * 2 - t; else t = t + 2;
+  if (c > 2) t = t + c * 0; else s = s / c;
+  if (x > 44) s = s + x * 4 - t; else t = t + 4;
+  if (x > 45) s = s + x * 5 - t; else t = t + 0;
+  if (x > 46) s = s + x * 6 - t; else t = t + 1;
+  if (c > 0) t = t + c * 4; else s = s / c;
+  if (x > 48) s = s + x * 8 - t; else t = t + 3;
+  if (x > 49) s = s + x * 9 - t; else t = t + 4;
+  if (x > 0) s = s + x * 10 - t; else t = t + 0;
+  if (c > 1) t = t + c * 1; else s = s / c;
+  if (x > 2) s = s + x * 12 - t; else t = t + 2;
+  if (x > 3) s = s + x * 0 - t; else t = t + 3;
+  if (x > 4) s = s + x * 1 - t; else t = t + 4;
+  if (c > 2) t = t + c * 5; else s = s / c;
+  if (x > 6) s = s + x * 3 - t; else t = t + 1;
+  if (x > 7) s = s + x * 4 - t; else t = t + 2;
+  if (x > 8) s = s + x * 5 - t; else t = t + 3;
+  if (c > 0) t = t + c * 2; else s = s / c;
+  if (x > 10) s = s + x * 7 - t; else t = t + 0;
+  if (x > 11) s = s + x * 8 - t; else t = t + 1;
+  if (x > 12) s = s + x * 9 - t; else t = t + 2;
+  if (c > 1) t = t + c * 6; else s = s / c;
+  if (x > 14) s = s + x * 11 - t; else t = t + 4;
+  if (x > 15) s = s + x * 12 - t; else t = t + 0;
+  if (x > 16) s = s + x * 0 - t; else t = t + 1;
+  if (c > 2) t = t + c * 3; else s = s / c;
+  if (x > 18) s = s + x * 2 - t; else t = t + 3;
+  if (x > 19) s = s + x * 3 - t; else t = t + 4;
+  if (x > 20) s = s + x * 4 - t; else t = t + 0;
+  if (c > 0) t = t + c * 0; else s = s / c;
+  if (x > 22) s = s + x * 6 - t; else t = t + 2;
+  if (x > 23) s = s + x * 7 - t; else t = t + 3;
+  if (x > 24) s = s + x * 8 - t; else t = t + 4;
+  if (c > 1) t = t + c * 4; else s = s / c;
+  if (x > 26) s = s + x * 10 - t; else t = t + 1;
+  if (x > 27) s = s + x * 11 - t; else t = t + 2;
+  if (x > 28) s = s + x * 12 - t; else t = t + 3;
+  if (c > 2) t = t + c * 1; else s = s / c;
+  if (x > 30) s = s + x * 1 - t; else t = t + 0;
+  if (x > 31) s = s + x * 2 - t; else t = t + 1;
+  if (x > 32) s = s + x * 3 - t; else t = t + 2;
+  if (c > 0) t = t + c * 5; else s = s / c;
+  if (x > 34) s = s + x * 5 - t; else t = t + 4;
+  if (x > 35) s = s + x * 6 - t; else t = t + 0;
+  if (x > 36) s = s + x * 7 - t; else t = t + 1;
+  if (c > 1) t = t + c * 2; else s = s / c;
+  if (x > 38) s = s + x * 9 - t; else t = t + 3;
+  if (x > 39) s = s + x * 10 - t; else t = t + 4;
+  if (x > 40) s = s + x * 11 - t; else t = t + 0;
+  if (c > 2) t = t + c * 6; else s = s / c;
+  if (x > 42) s = s + x * 0 - t; else t = t + 2;
+  if (x > 43) s = s + x * 1 - t; else t = t + 3;
+  if (x > 44) s = s + x * 2 - t; else t = t + 4;
+  if (c > 0) t = t + c * 3; else s = s / c;
+  if (x > 46) s = s + x * 4 - t; else t = t + 1;
+  if (x > 47) s = s + x * 5 - t; else t = t + 2;
+  if (x > 48) s = s + x * 6 - t; else t = t + 3;
+  if (c > 1) t = t + c * 0; else s = s / c;
+  if (x > 0) s = s + x * 8 - t; else t = t + 0;
+  if (x > 1) s = s + x * 9 - t; else t = t + 1;
+  if (x > 2) s = s + x * 10 - t; else t = t + 2;
+  if (c > 2) t = t + c * 4; else s = s / c;
+  if (x > 4) s = s + x * 12 - t; else t = t + 4;
+  if (x > 5) s = s + x * 0 - t; else t = t + 0;
+  if (x > 6) s = s + x * 1 - t; else t = t + 1;
+  if (c > 0) t = t + c * 1; else s = s / c;
+  if (x > 8) s = s + x * 3 - t; else t = t + 3;
+  if (x > 9) s = s + x * 4 - t; else t = t + 4;
+  if (x > 10) s = s + x * 5 - t; else t = t + 0;
+  if (c > 1) t = t + c * 5; else s = s / c;
+  if (x > 12) s = s + x * 7 - t; else t = t + 2;
+  if (x > 13) s = s + x * 8 - t; else t = t + 3;
+  if (x > 14) s = s + x * 9 - t; else t = t + 4;
+  if (c > 2) t = t + c * 2; else s = s / c;
+  if (x > 16) s = s + x * 11 - t; else t = t + 1;
+  if (x > 17) s = s + x * 12 - t; else t = t + 2;
+  if (x > 18) s = s + x * 0 - t; else t = t + 3;
+  if (c > 0) t = t + c * 6; else s = s / c;
+  if (x > 20) s = s + x * 2 - t; else t = t + 0;
+  if (x > 21) s = s + x * 3 - t; else t = t + 1;
+  if (x > 22) s = s + x * 4 - t; else t = t + 2;
+  if (c > 1) t = t + c * 3; else s = s / c;
+  if (x > 24) s = s + x * 6 - t; else t = t + 4;
+  if (x > 25) s = s + x * 7 - t; else t = t + 0;
+  if (x > 26) s = s + x * 8 - t; else t = t + 1;
+  if (c > 2) t = t + c * 0; else s = s / c;
+  if (x > 28) s = s + x * 10 - t; else t = t + 3;
+  if (x > 29) s = s + x * 11 - t; else t = t + 4;
+  if (x > 30) s = s + x * 12 - t; else t = t + 0;
+  if (c > 0) t = t + c * 4; else s = s / c;
+  if (x > 32) s = s + x * 1 - t; else t = t + 2;
+  if (x > 33) s = s + x * 2 - t; else t = t + 3;
+  if (x > 34) s = s + x * 3 - t; else t = t + 4;
+  if (c > 1) t = t + c * 1; else s = s / c;
+  if (x > 36) s = s + x * 5 - t; else t = t + 1;
+  if (x > 37) s = s + x * 6 - t; else t = t + 2;
+  if (x > 38) s = s + x * 7 - t; else t = t + 3;
+  if (c > 2) t = t + c * 5; else s = s / c;
+  if (x > 40) s = s + x * 9 - t; else t = t + 0;
+  if (x > 41) s = s + x * 10 - t; else t = t + 1;
+  if (x > 42) s = s + x * 11 - t; else t = t + 2;
+  if (c > 0) t = t + c * 2; else s = s / c;
+  if (x > 44) s = s + x * 0 - t; else t = t + 4;
+  if (x > 45) s = s + x * 1 - t; else t = t + 0;
+  if (x > 46) s = s + x * 2 - t; else t = t + 1;
+  if (c > 1) t = t + c * 6; else s = s / c;
+  if (x > 48) s = s + x * 4 - t; else t = t + 3;
+  if (x > 49) s = s + x * 5 - t; else t = t + 4;
+  if (x > 0) s = s + x * 6 - t; else t = t + 0;
+  if (c > 2) t = t + c * 3; else s = s / c;
+  if (x > 2) s = s + x * 8 - t; else t = t + 2;
+  if (x > 3) s = s + x * 9 - t; else t = t + 3;
+  if (x > 4) s = s + x * 10 - t; else t = t + 4;
+  if (c > 0) t = t + c * 0; else s = s / c;
+  if (x > 6) s = s + x * 12 - t; else t = t + 1;
+  if (x > 7) s = s + x * 0 - t; else t = t + 2;
+  if (x > 8) s = s + x * 1 - t; else t = t + 3;
+  if (c > 1) t = t + c * 4; else s = s / c;
+  if (x > 10) s = s + x * 3 - t; else t = t + 0;
+  if (x > 11) s = s + x * 4 - t; else t = t + 1;
+  if (x > 12) s = s + x * 5 - t; else t = t + 2;
+  if (c > 2) t = t + c * 1; else s = s / c;
+  if (x > 14) s = s + x * 7 - t; else t = t + 4;
+  if (x > 15) s = s + x * 8 - t; else t = t + 0;
+  if (x > 16) s = s + x * 9 - t; else t = t + 1;
+  if (c > 0) t = t + c * 5; else s = s / c;
+  if (x > 18) s = s + x * 11 - t; else t = t + 3;
+  if (x > 19) s = s + x * 12 - t; else t = t + 4;
+  if (x > 20) s = s + x * 0 - t; else t = t + 0;
+  if (c > 1) t = t + c * 2; else s = s / c;
+  if (x > 22) s = s + x * 2 - t; else t = t + 2;
+  if (x > 23) s = s + x * 3 - t; else t = t + 3;
+  if (x > 24) s = s + x * 4 - t; else t = t + 4;
+  if (c > 2) t = t + c * 6; else s = s / c;
+  if (x > 26) s = s + x * 6 - t; else t = t + 1;
+  if (x > 27) s = s + x * 7 - t; else t = t + 2;
+  if (x > 28) s = s + x * 8 - t; else t = t + 3;
+  if (c > 0) t = t + c * 3; else s = s / c;
+  if (x > 30) s = s + x * 10 - t; else t = t + 0;
+  if (x > 31) s = s + x * 11 - t; else t = t + 1;
+  if (x > 32) s = s + x * 12 - t; else t = t + 2;
+  if (c > 1) t = t + c * 0; else s = s / c;
+  if (x > 34) s = s + x * 1 - t; else t = t + 4;
+  if (x > 35) s = s + x * 2 - t; else t = t + 0;
+  if (x > 36) s = s + x * 3 - t; else t = t + 1;
+  if (c > 2) t = t + c * 4; else s = s / c;
+  if (x > 38) s = s + x * 5 - t; else t = t + 3;
+  if (x > 39) s = s + x * 6 - t; else t = t + 4;
+  if (x > 40) s = s + x * 7 - t; else t = t + 0;
+  if (c > 0) t = t + c * 1; else s = s / c;
+  if (x > 42) s = s + x * 9 - t; else t = t + 2;
+  if (x > 43) s = s + x * 10 - t; else t = t + 3;
+  if (x > 44) s = s + x * 11 - t; else t = t + 4;
+  if (c > 1) t = t + c * 5; else s = s / c;
+  if (x > 46) s = s + x * 0 - t; else t = t + 1;
+  if (x > 47) s = s + x * 1 - t; else t = t + 2;
+  if (x > 48) s = s + x * 2 - t; else t = t + 3;
+  if (c > 2) t = t + c * 2; else s = s / c;
+  if (x > 0) s = s + x * 4 - t; else t = t + 0;
+  if (x > 1) s = s + x * 5 - t; else t = t + 1;
+  if (x > 2) s = s + x * 6 - t; else t = t + 2;
+  if (c > 0) t = t + c * 6; else s = s / c;
+  if (x > 4) s = s + x * 8 - t; else t = t + 4;
+  if (x > 5) s = s + x * 9 - t; else t = t + 0;
+  if (x > 6) s = s + x * 10 - t; else t = t + 1;
+  if (c > 1) t = t + c * 3; else s = s / c;
+  if (x > 8) s = s + x * 12 - t; else t = t + 3;
+  if (x > 9) s = s + x * 0 - t; else t = t + 4;
+  if (x > 10) s = s + x * 1 - t; else t = t + 0;
+  if (c > 2) t = t + c * 0; else s = s / c;
+  if (x > 12) s = s + x * 3 - t; else t = t + 2;
+  if (x > 13) s = s + x * 4 - t; else t = t + 3;
+  if (x > 14) s = s + x * 5 - t; else t = t + 4;
+  if (c > 0) t = t + c * 4; else s = s / c;
+  if (x > 16) s = s + x * 7 - t; else t = t + 1;
+  if (x > 17) s = s + x * 8 - t; else t = t + 2;
+  if (x > 18) s = s + x * 9 - t; else t = t + 3;
+  if (c > 1) t = t + c * 1; else s = s / c;
+  if (x > 20) s = s + x * 11 - t; else t = t + 0;
+  if (x > 21) s = s + x * 12 - t; else t = t + 1;
+  if (x > 22) s = s + x * 0 - t; else t = t + 2;
+  if (c > 2) t = t + c * 5; else s = s / c;
+  if (x > 24) s = s + x * 2 - t; else t = t + 4;
+  if (x > 25) s = s + x * 3 - t; else t = t + 0;
+  if (x > 26) s = s + x * 4 - t; else t = t + 1;
+  if (c > 0) t = t + c * 2; else s = s / c;
+  if (x > 28) s = s + x * 6 - t; else t = t + 3;
+  if (x > 29) s = s + x * 7 - t; else t = t + 4;
+  if (x > 30) s = s + x * 8 - t; else t = t + 0;
+  if (c > 1) t = t + c * 6; else s = s / c;
+  if (x > 32) s = s + x * 10 - t; else t = t + 2;
+  if (x > 33) s = s + x * 11 - t; else t = t + 3;
+  if (x > 34) s = s + x * 12 - t; else t = t + 4;
+  if (c > 2) t = t + c * 3; else s = s / c;
+  if (x > 36) s = s + x * 1 - t; else t = t + 1;
+  if (x > 37) s = s + x * 2 - t; else t = t + 2;
+  if (x > 38) s = s + x * 3 - t; else t = t + 3;
+  if (c > 0) t = t + c * 0; else s = s / c;
+  if (x > 40) s = s + x * 5 - t; else t = t + 0;
+  if (x > 41) s = s + x * 6 - t; else t = t + 1;
+  if (x > 42) s = s + x * 7 - t; else t = t + 2;
+  if (c > 1) t = t + c * 4; else s = s / c;
+  if (x > 44) s = s + x * 9 - t; else t = t + 4;
+  if (x > 45) s = s + x * 10 - t; else t = t + 0;
+  if (x > 46) s = s + x * 11 - t; else t = t + 1;
+  if (c > 2) t = t + c * 1; else s = s / c;
+  if (x > 48) s = s + x * 0 - t; else t = t + 3;
+  if (x > 49) s = s + x * 1 - t; else t = t + 4;
+  if (x > 0) s = s + x * 2 - t; else t = t + 0;
+  if (c > 0) t = t + c * 5; else s = s / c;
+  if (x > 2) s = s + x * 4 - t; else t = t + 2;
+  if (x > 3) s = s + x * 5 - t; else t = t + 3;
+  if (x > 4) s = s + x * 6 - t; else t = t + 4;
+  if (c > 1) t = t + c * 2; else s = s / c;
+  if (x > 6) s = s + x * 8 - t; else t = t + 1;
+  if (x > 7) s = s + x * 9 - t; else t = t + 2;
+  if (x > 8) s = s + x * 10 - t; else t = t + 3;
+  if (c > 2) t = t + c * 6; else s = s / c;
+  if (x > 10) s = s + x * 12 - t; else t = t + 0;
+  if (x > 11) s = s + x * 0 - t; else t = t + 1;
+  if (x > 12) s = s + x * 1 - t; else t = t + 2;
+  if (c > 0) t = t + c * 3; else s = s / c;
+  if (x > 14) s = s + x * 3 - t; else t = t + 4;
+  if (x > 15) s = s + x * 4 - t; else t = t + 0;
+  if (x > 16) s = s + x * 5 - t; else t = t + 1;
+  if (c > 1) t = t + c * 0; else s = s / c;
+  if (x > 18) s = s + x * 7 - t; else t = t + 3;
+  if (x > 19) s = s + x * 8 - t; else t = t + 4;
+  if (x > 20) s = s + x * 9 - t; else t = t + 0;
+  if (c > 2) t = t + c * 4; else s = s / c;
+  if (x > 22) s = s + x * 11 - t; else t = t + 2;
+  if (x > 23) s = s + x * 12 - t; else t = t + 3;
+  if (x > 24) s = s + x * 0 - t; else t = t + 4;
+  if (c > 0) t = t + c * 1; else s = s / c;
+  if (x > 26) s = s + x * 2 - t; else t = t + 1;
+  if (x > 27) s = s + x * 3 - t; else t = t + 2;
+  if (x > 28) s = s + x * 4 - t; else t = t + 3;
+  if (c > 1) t = t + c * 5; else s = s / c;
+  if (x > 30) s = s + x * 6 - t; else t = t + 0;
+  if (x > 31) s = s + x * 7 - t; else t = t + 1;
+  if (x > 32) s = s + x * 8 - t; else t = t + 2;
+  if (c > 2) t = t + c * 2; else s = s / c;
+  if (x > 34) s = s + x * 10 - t; else t = t + 4;
+  if (x > 35) s = s + x * 11 - t; else t = t + 0;
+  if (x > 36) s = s + x * 12 - t; else t = t + 1;
+  if (c > 0) t = t + c * 6; else s = s / c;
+  if (x > 38) s = s + x * 1 - t; else t = t + 3;
+  if (x > 39) s = s + x * 2 - t; else t = t + 4;
+  if (x > 40) s = s + x * 3 - t; else t = t + 0;
+  if (c > 1) t = t + c * 3; else s = s / c;
+  if (x > 42) s = s + x * 5 - t; else t = t + 2;
+  if (x > 43) s = s + x * 6 - t; else t = t + 3;
+  if (x > 44) s = s + x * 7 - t; else t = t + 4;
+  if (c > 2) t = t + c * 0; else s = s / c;
+  if (x > 46) s = s + x * 9 - t; else t = t + 1;
+  if (x > 47) s = s + x * 10 - t; else t = t + 2;
+  if (x > 48) s = s + x * 11 - t; else t = t + 3;
+  if (c > 0) t = t + c * 4; else s = s / c;
+  if (x > 0) s = s + x * 0 - t; else t = t + 0;
+  if (x > 1) s = s + x * 1 - t; else t = t + 1;
+  if (x > 2) s = s + x * 2 - t; else t = t + 2;
+  if (c > 1) t = t + c * 1; else s = s / c;
+  if (x > 4) s = s + x * 4 - t; else t = t + 4;
+  if (x > 5) s = s + x * 5 - t; else t = t + 0;
+  if (x > 6) s = s + x * 6 - t; else t = t + 1;
+  if (c > 2) t = t + c * 5; else s = s / c;
+  if (x > 8) s = s + x * 8 - t; else t = t + 3;
+  if (x > 9) s = s + x * 9 - t; else t = t + 4;
+  if (x > 10) s = s + x * 10 - t; else t = t + 0;
+  if (c > 0) t = t + c * 2; else s = s / c;
+  if (x > 12) s = s + x * 12 - t; else t = t + 2;
+  if (x > 13) s = s + x * 0 - t; else t = t + 3;
+  if (x > 14) s = s + x * 1 - t; else t = t + 4;
+  if (c > 1) t = t + c * 6; else s = s / c;
+  if (x > 16) s = s + x * 3 - t; else t = t + 1;
+  if (x > 17) s = s + x * 4 - t; else t = t + 2;
+  if (x > 18) s = s + x * 5 - t; else t = t + 3;
+  if (c > 2) t = t + c * 3; else s = s / c;
+  if (x > 20) s = s + x * 7 - t; else t = t + 0;
+  if (x > 21) s = s + x * 8 - t; else t = t + 1;
+  if (x > 22) s = s + x * 9 - t; else t = t + 2;
+  if (c > 0) t = t + c * 0; else s = s / c;
+  if (x > 24) s = s + x * 11 - t; else t = t + 4;
+  if (x > 25) s = s + x * 12 - t; else t = t + 0;
+  if (x > 26) s = s + x * 0 - t; else t = t + 1;
+  if (c > 1) t = t + c * 4; else s = s / c;
+  if (x > 28) s = s + x * 2 - t; else t = t + 3;
+  if (x > 29) s = s + x * 3 - t; else t = t + 4;
+  if (x > 30) s = s + x * 4 - t; else t = t + 0;
+  if (c > 2) t = t + c * 1; else s = s / c;
+  if (x > 32) s = s + x * 6 - t; else t = t + 2;
+  if (x > 33) s = s + x * 7 - t; else t = t + 3;
+  if (x > 34) s = s + x * 8 - t; else t = t + 4;
+  if (c > 0) t = t + c * 5; else s = s / c;
+  if (x > 36) s = s + x * 10 - t; else t = t + 1;
+  if (x > 37) s = s + x * 11 - t; else t = t + 2;
+  if (x > 38) s = s + x * 12 - t; else t = t + 3;
+  if (c > 1) t = t + c * 2; else s = s / c;
+  if (x > 40) s = s + x * 1 - t; else t = t + 0;
+  if (x > 41) s = s + x * 2 - t; else t = t + 1;
+  if (x > 42) s = s + x * 3 - t; else t = t + 2;
+  if (c > 2) t = t + c * 6; else s = s / c;
+  if (x > 44) s = s + x * 5 - t; else t = t + 4;
+  if (x > 45) s = s + x * 6 - t; else t = t + 0;
+  if (x > 46) s = s + x * 7 - t; else t = t + 1;
+  if (c > 0) t = t + c * 3; else s = s / c;
+  if (x > 48) s = s + x * 9 - t; else t = t + 3;
+  if (x > 49) s = s + x * 10 - t; else t = t + 4;
+  if (x > 0) s = s + x * 11 - t; else t = t + 0;
+  if (c > 1) t = t + c * 0; else s = s / c;
+  if (x > 2) s = s + x * 0 - t; else t = t + 2;
+  if (x > 3) s = s + x * 1 - t; else t = t + 3;
+  if (x > 4) s = s + x * 2 - t; else t = t + 4;
+  if (c > 2) t = t + c * 4; else s = s / c;
+  if (x > 6) s = s + x * 4 - t; else t = t + 1;
+  if (x > 7) s = s + x * 5 - t; else t = t + 2;
+  if (x > 8) s = s + x * 6 - t; else t = t + 3;
+  if (c > 0) t = t + c * 1; else s = s / c;
+  if (x > 10) s = s + x * 8 - t; else t = t + 0;
+  if (x > 11) s = s + x * 9 - t; else t = t + 1;
+  if (x > 12) s = s + x * 10 - t; else t = t + 2;
+  if (c > 1) t = t + c * 5; else s = s / c;
+  if (x > 14) s = s + x * 12 - t; else t = t + 4;
+  if (x > 15) s = s + x * 0 - t; else t = t + 0;
+  if (x > 16) s = s + x * 1 - t; else t = t + 1;
+  if (c > 2) t = t + c * 2; else s = s / c;
+  if (x > 18) s = s + x * 3 - t; else t = t + 3;
+  if (x > 19) s = s + x * 4 - t; else t = t + 4;
+  if (x > 20) s = s + x * 5 - t; else t = t + 0;
+  if (c > 0) t = t + c * 6; else s = s / c;
+  if (x > 22) s = s + x * 7 - t; else t = t + 2;
+  if (x > 23) s = s + x * 8 - t; else t = t + 3;
+  if (x > 24) s = s + x * 9 - t; else t = t + 4;
+  if (c > 1) t = t + c * 3; else s = s / c;
+  if (x > 26) s = s + x * 11 - t; else t = t + 1;
+  if (x > 27) s = s + x * 12 - t; else t = t + 2;
+  if (x > 28) s = s + x * 0 - t; else t = t + 3;
+  if (c > 2) t = t + c * 0; else s = s / c;
+  if (x > 30) s = s + x * 2 - t; else t = t + 0;
+  if (x > 31) s = s + x * 3 - t; else t = t + 1;
+  if (x > 32) s = s + x * 4 - t; else t = t + 2;
+  if (c > 0) t = t + c * 4; else s = s / c;
+  if (x > 34) s = s + x * 6 - t; else t = t + 4;
+  if (x > 35) s = s + x * 7 - t; else t = t + 0;
+  if (x > 36) s = s + x * 8 - t; else t = t + 1;
+  if (c > 1) t = t + c * 1; else s = s / c;
+  if (x > 38) s = s + x * 10 - t; else t = t + 3;
+  if (x > 39) s = s + x * 11 - t; else t = t + 4;
+  if (x > 40) s = s + x * 12 - t; else t = t + 0;
+  if (c > 2) t = t + c * 5; else s = s / c;
+  if (x > 42) s = s + x * 1 - t; else t = t + 2;
+  if (x > 43) s = s + x * 2 - t; else t = t + 3;
+  if (x > 44) s = s + x * 3 - t; else t = t + 4;
+  if (c > 0) t = t + c * 2; else s = s / c;
+  if (x > 46) s = s + x * 5 - t; else t = t + 1;
+  if (x > 47) s = s + x * 6 - t; else t = t + 2;
+  if (x > 48) s = s + x * 7 - t; else t = t + 3;
+  if (c > 1) t = t + c * 6; else s = s / c;
+  if (x > 0) s = s + x * 9 - t; else t = t + 0;
+  if (x > 1) s = s + x * 10 - t; else t = t + 1;
+  if (x > 2) s = s + x * 11 - t; else t = t + 2;
+  if (c > 2) t = t + c * 3; else s = s / c;
+  if (x > 4) s = s + x * 0 - t; else t = t + 4;
+  if (x > 5) s = s + x * 1 - t; else t = t + 0;
+  if (x > 6) s = s + x * 2 - t; else t = t + 1;
+  if (c > 0) t = t + c * 0; else s = s / c;
+  if (x > 8) s = s + x * 4 - t; else t = t + 3;
+  if (x > 9) s = s + x * 5 - t; else t = t + 4;
+  if (x > 10) s = s + x * 6 - t; else t = t + 0;
+  if (c > 1) t = t + c * 4; else s = s / c;
+  if (x > 12) s = s + x * 8 - t; else t = t + 2;
+  if (x > 13) s = s + x * 9 - t; else t = t + 3;
+  if (x > 14) s = s + x * 10 - t; else t = t + 4;
+  if (c > 2) t = t + c * 1; else s = s / c;
+  if (x > 16) s = s + x * 12 - t; else t = t + 1;
+  if (x > 17) s = s + x * 0 - t; else t = t + 2;
+  if (x > 18) s = s + x * 1 - t; else t = t + 3;
+  if (c > 0) t = t + c * 5; else s = s / c;
+  if (x > 20) s = s + x * 3 - t; else t = t + 0;
+  if (x > 21) s = s + x * 4 - t; else t = t + 1;
+  if (x > 22) s = s + x * 5 - t; else t = t + 2;
+  if (c > 1) t = t + c * 2; else s = s / c;
+  if (x > 24) s = s + x * 7 - t; else t = t + 4;
+  if (x > 25) s = s + x * 8 - t; else t = t + 0;
+  if (x > 26) s = s + x * 9 - t; else t = t + 1;
+  if (c > 2) t = t + c * 6; else s = s / c;
+  if (x > 28) s = s + x * 11 - t; else t = t + 3;
+  if (x > 29) s = s + x * 12 - t; else t = t + 4;
+  if (x > 30) s = s + x * 0 - t; else t = t + 0;
+  if (c > 0) t = t + c * 3; else s = s / c;
+  if (x > 32) s = s + x * 2 - t; else t = t + 2;
+  if (x > 33) s = s + x * 3 - t; else t = t + 3;
+  if (x > 34) s = s + x * 4 - t; else t = t + 4;
+  if (c > 1) t = t + c * 0; else s = s / c;
+  if (x > 36) s = s + x * 6 - t; else t = t + 1;
+  if (x > 37) s = s + x * 7 - t; else t = t + 2;
+  if (x > 38) s = s + x * 8 - t; else t = t + 3;
+  if (c > 2) t = t + c * 4; else s = s / c;
+  if (x > 40) s = s + x * 10 - t; else t = t + 0;
+  if (x > 41) s = s + x * 11 - t; else t = t + 1;
+  if (x > 42) s = s + x * 12 - t; else t = t + 2;
+  if (c > 0) t = t + c * 1; else s = s / c;
+  if (x > 44) s = s + x * 1 - t; else t = t + 4;
+  if (x > 45) s = s + x * 2 - t; else t = t + 0;
+  if (x > 46) s = s + x * 3 - t; else t = t + 1;
+  if (c > 1) t = t + c * 5; else s = s / c;
+  if (x > 48) s = s + x * 5 - t; else t = t + 3;
+  if (x > 49) s = s + x * 6 - t; else t = t + 4;
+  if (x > 0) s = s + x * 7 - t; else t = t + 0;
+  if (c > 2) t = t + c * 2; else s = s / c;
+  if (x > 2) s = s + x * 9 - t; else t = t + 2;
+  if (x > 3) s = s + x * 10 - t; else t = t + 3;
+  if (x > 4) s = s + x * 11 - t; else t = t + 4;
+  if (c > 0) t = t + c * 6; else s = s / c;
+  if (x > 6) s = s + x * 0 - t; else t = t + 1;
+  if (x > 7) s = s + x * 1 - t; else t = t + 2;
+  if (x > 8) s = s + x * 2 - t; else t = t + 3;
+  if (c > 1) t = t + c * 3; else s = s / c;
+  if (x > 10) s = s + x * 4 - t; else t = t + 0;
+  if (x > 11) s = s + x * 5 - t; else t = t + 1;
+  if (x > 12) s = s + x * 6 - t; else t = t + 2;
+  if (c > 2) t = t + c * 0; else s = s / c;
+  if (x > 14) s = s + x * 8 - t; else t = t + 4;
+  if (x > 15) s = s + x * 9 - t; else t = t + 0;
+  if (x > 16) s = s + x * 10 - t; else t = t + 1;
+  if (c > 0) t = t + c * 4; else s = s / c;
+  if (x > 18) s = s + x * 12 - t; else t = t + 3;
+  if (x > 19) s = s + x * 0 - t; else t = t + 4;
+  if (x > 20) s = s + x * 1 - t; else t = t + 0;
+  if (c > 1) t = t + c * 1; else s = s / c;
+  if (x > 22) s = s + x * 3 - t; else t = t + 2;
+  if (x > 23) s = s + x * 4 - t; else t = t + 3;
+  if (x > 24) s = s + x * 5 - t; else t = t + 4;
+  if (c > 2) t = t + c * 5; else s = s / c;
+  if (x > 26) s = s + x * 7 - t; else t = t + 1;
+  if (x > 27) s = s + x * 8 - t; else t = t + 2;
+  if (x > 28) s = s + x * 9 - t; else t = t + 3;
+  if (c > 0) t = t + c * 2; else s = s / c;
+  if (x > 30) s = s + x * 11 - t; else t = t + 0;
+  if (x > 31) s = s + x * 12 - t; else t = t + 1;
+  if (x > 32) s = s + x * 0 - t; else t = t + 2;
+  if (c > 1) t = t + c * 6; else s = s / c;
+  if (x > 34) s = s + x * 2 - t; else t = t + 4;
+  if (x > 35) s = s + x * 3 - t; else t = t + 0;
+  if (x > 36) s = s + x * 4 - t; else t = t + 1;
+  if (c > 2) t = t + c * 3; else s = s / c;
+  if (x > 38) s = s + x * 6 - t; else t = t + 3;
+  if (x > 39) s = s + x * 7 - t; else t = t + 4;
+  if (x > 40) s = s + x * 8 - t; else t = t + 0;
+  if (c > 0) t = t + c * 0; else s = s / c;
+  if (x > 42) s = s + x * 10 - t; else t = t + 2;
+  if (x > 43) s = s + x * 11 - t; else t = t + 3;
+  if (x > 44) s = s + x * 12 - t; else t = t + 4;
+  if (c > 1) t = t + c * 4; else s = s / c;
+  if (x > 46) s = s + x * 1 - t; else t = t + 1;
+  if (x > 47) s = s + x * 2 - t; else t = t + 2;
+  if (x > 48) s = s + x * 3 - t; else t = t + 3;
+  if (c > 2) t = t + c * 1; else s = s / c;
+  if (x > 0) s = s + x * 5 - t; else t = t + 0;
+  if (x > 1) s = s + x * 6 - t; else t = t + 1;
+  if (x > 2) s = s + x * 7 - t; else t = t + 2;
+  if (c > 0) t = t + c * 5; else s = s / c;
+  if (x > 4) s = s + x * 9 - t; else t = t + 4;
+  if (x > 5) s = s + x * 10 - t; else t = t + 0;
+  if (x > 6) s = s + x * 11 - t; else t = t + 1;
+  if (c > 1) t = t + c * 2; else s = s / c;
+  if (x > 8) s = s + x * 0 - t; else t = t + 3;
+  if (x > 9) s = s + x * 1 - t; else t = t + 4;
+  if (x > 10) s = s + x * 2 - t; else t = t + 0;
+  if (c > 2) t = t + c * 6; else s = s / c;
+  if (x > 12) s = s + x * 4 - t; else t = t + 2;
+  if (x > 13) s = s + x * 5 - t; else t = t + 3;
+  if (x > 14) s = s + x * 6 - t; else t = t + 4;
+  if (c > 0) t = t + c * 3; else s = s / c;
+  if (x > 16) s = s + x * 8 - t; else t = t + 1;
+  if (x > 17) s = s + x * 9 - t; else t = t + 2;
+  if (x > 18) s = s + x * 10 - t; else t = t + 3;
+  if (c > 1) t = t + c * 0; else s = s / c;
+  if (x > 20) s = s + x * 12 - t; else t = t + 0;
+  if (x > 21) s = s + x * 0 - t; else t = t + 1;
+  if (x > 22) s = s + x * 1 - t; else t = t + 2;
+  if (c > 2) t = t + c * 4; else s = s / c;
+  if (x > 24) s = s + x * 3 - t; else t = t + 4;
+  if (x > 25) s = s + x * 4 - t; else t = t + 0;
+  if (x > 26) s = s + x * 5 - t; else t = t + 1;
+  if (c > 0) t = t + c * 1; else s = s / c;
+  if (x > 28) s = s + x * 7 - t; else t = t + 3;
+  if (x > 29) s = s + x * 8 - t; else t = t + 4;
+  if (x > 30) s = s + x * 9 - t; else t = t + 0;
+  if (c > 1) t = t + c * 5; else s = s / c;
+  if (x > 32) s = s + x * 11 - t; else t = t + 2;
+  if (x > 33) s = s + x * 12 - t; else t = t + 3;
+  if (x > 34) s = s + x * 0 - t; else t = t + 4;
+  if (c > 2) t = t + c * 2; else s = s / c;
+  if (x > 36) s = s + x * 2 - t; else t = t + 1;
+  if (x > 37) s = s + x * 3 - t; else t = t + 2;
+  if (x > 38) s = s + x * 4 - t; else t = t + 3;
+  if (c > 0) t = t + c * 6; else s = s / c;
+  if (x > 40) s = s + x * 6 - t; else t = t + 0;
+  if (x > 41) s = s + x * 7 - t; else t = t + 1;
+  if (x > 42) s = s + x * 8 - t; else t = t + 2;
+  if (c > 1) t = t + c * 3; else s = s / c;
+  if (x > 44) s = s + x * 10 - t; else t = t + 4;
+  if (x > 45) s = s + x * 11 - t; else t = t + 0;
+  if (x > 46) s = s + x * 12 - t; else t = t + 1;
+  if (c > 2) t = t + c * 0; else s = s / c;
+  if (x > 48) s = s + x * 1 - t; else t = t + 3;
+  if (x > 49) s = s + x * 2 - t; else t = t + 4;
+  if (x > 0) s = s + x * 3 - t; else t = t + 0;
+  if (c > 0) t = t + c * 4; else s = s / c;
+  if (x > 2) s = s + x * 5 - t; else t = t + 2;
+  if (x > 3) s = s + x * 6 - t; else t = t + 3;
+  if (x > 4) s = s + x * 7 - t; else t = t + 4;
+  if (c > 1) t = t + c * 1; else s = s / c;
+  if (x > 6) s = s + x * 9 - t; else t = t + 1;
+  if (x > 7) s = s + x * 10 - t; else t = t + 2;
+  if (x > 8) s = s + x * 11 - t; else t = t + 3;
+  if (c > 2) t = t + c * 5; else s = s / c;
+  if (x > 10) s = s + x * 0 - t; else t = t + 0;
+  if (x > 11) s = s + x * 1 - t; else t = t + 1;
+  if (x > 12) s = s + x * 2 - t; else t = t + 2;
+  if (c > 0) t = t + c * 2; else s = s / c;
+  if (x > 14) s = s + x * 4 - t; else t = t + 4;
+  if (x > 15) s = s + x * 5 - t; else t = t + 0;
+  if (x > 16) s = s + x * 6 - t; else t = t + 1;
+  if (c > 1) t = t + c * 6; else s = s / c;
+  if (x > 18) s = s + x * 8 - t; else t = t + 3;
+  if (x > 19) s = s + x * 9 - t; else t = t + 4;
+  if (x > 20) s = s + x * 10 - t; else t = t + 0;
+  if (c > 2) t = t + c * 3; else s = s / c;
+  if (x > 22) s = s + x * 12 - t; else t = t + 2;
+  if (x > 23) s = s + x * 0 - t; else t = t + 3;
+  if (x > 24) s = s + x * 1 - t; else t = t + 4;
+  if (c > 0) t = t + c * 0; else s = s / c;
+  if (x > 26) s = s + x * 3 - t; else t = t + 1;
+  if (x > 27) s = s + x * 4 - t; else t = t + 2;
+  if (x > 28) s = s + x * 5 - t; else t = t + 3;
+  if (c > 1) t = t + c * 4; else s = s / c;
+  if (x > 30) s = s + x * 7 - t; else t = t + 0;
+  if (x > 31) s = s + x * 8 - t; else t = t + 1;
+  if (x > 32) s = s + x * 9 - t; else t = t + 2;
+  if (c > 2) t = t + c * 1; else s = s / c;
+  if (x > 34) s = s + x * 11 - t; else t = t + 4;
+  if (x > 35) s = s + x * 12 - t; else t = t + 0;
+  if (x > 36) s = s + x * 0 - t; else t = t + 1;
+  if (c > 0) t = t + c * 5; else s = s / c;
+  if (x > 38) s = s + x * 2 - t; else t = t + 3;
+  if (x > 39) s = s + x * 3 - t; else t = t + 4;
+  if (x > 40) s = s + x * 4 - t; else t = t + 0;
+  if (c > 1) t = t + c * 2; else s = s / c;
+  if (x > 42) s = s + x * 6 - t; else t = t + 2;
+  if (x > 43) s = s + x * 7 - t; else t = t + 3;
+  if (x > 44) s = s + x * 8 - t; else t = t + 4;
+  if (c > 2) t = t + c * 6; else s = s / c;
+  if (x > 46) s = s + x * 10 - t; else t = t + 1;
+  if (x > 47) s = s + x * 11 - t; else t = t + 2;
+  if (x > 48) s = s + x * 12 - t; else t = t + 3;
+  if (c > 0) t = t + c * 3; else s = s / c;
+  if (x > 0) s = s + x * 1 - t; else t = t + 0;
+  if (x > 1) s = s + x * 2 - t; else t = t + 1;
+  if (x > 2) s = s + x * 3 - t; else t = t + 2;
+  if (c > 1) t = t + c * 0; else s = s / c;
+  if (x > 4) s = s + x * 5 - t; else t = t + 4;
+  if (x > 5) s = s + x * 6 - t; else t = t + 0;
+  if (x > 6) s = s + x * 7 - t; else t = t + 1;
+  if (c > 2) t = t + c * 4; else s = s / c;
+  if (x > 8) s = s + x * 9 - t; else t = t + 3;
+  if (x > 9) s = s + x * 10 - t; else t = t + 4;
+  if (x > 10) s = s + x * 11 - t; else t = t + 0;
+  if (c > 0) t = t + c * 1; else s = s / c;
+  if (x > 12) s = s + x * 0 - t; else t = t + 2;
+  if (x > 13) s = s + x * 1 - t; else t = t + 3;
+  if (x > 14) s = s + x * 2 - t; else t = t + 4;
+  if (c > 1) t = t + c * 5; else s = s / c;
+  if (x > 16) s = s + x * 4 - t; else t = t + 1;
+  if (x > 17) s = s + x * 5 - t; else t = t + 2;
+  if (x > 18) s = s + x * 6 - t; else t = t + 3;
+  if (c > 2) t = t + c * 2; else s = s / c;
+  if (x > 20) s = s + x * 8 - t; else t = t + 0;
+  if (x > 21) s = s + x * 9 - t; else t = t + 1;
+  if (x > 22) s = s + x * 10 - t; else t = t + 2;
+  if (c > 0) t = t + c * 6; else s = s / c;
+  if (x > 24) s = s + x * 12 - t; else t = t + 4;
+  if (x > 25) s = s + x * 0 - t; else t = t + 0;
+  if (x > 26) s = s + x * 1 - t; else t = t + 1;
+  if (c > 1) t = t + c * 3; else s = s / c;
+  if (x > 28) s = s + x * 3 - t; else t = t + 3;
+  if (x > 29) s = s + x * 4 - t; else t = t + 4;
+  if (x > 30) s = s + x * 5 - t; else t = t + 0;
+  if (c > 2) t = t + c * 0; else s = s / c;
+  if (x > 32) s = s + x * 7 - t; else t = t + 2;
+  if (x > 33) s = s + x * 8 - t; else t = t + 3;
+  if (x > 34) s = s + x * 9 - t; else t = t + 4;
+  if (c > 0) t = t + c * 4; else s = s / c;
+  if (x > 36) s = s + x * 11 - t; else t = t + 1;
+  if (x > 37) s = s + x * 12 - t; else t = t + 2;
+  if (x > 38) s = s + x * 0 - t; else t = t + 3;
+  if (c > 1) t = t + c * 1; else s = s / c;
+  if (x > 40) s = s + x * 2 - t; else t = t + 0;
+  if (x > 41) s = s + x * 3 - t; else t = t + 1;
+  if (x > 42) s = s + x * 4 - t; else t = t + 2;
+  if (c > 2) t = t + c * 5; else s = s / c;
+  if (x > 44) s = s + x * 6 - t; else t = t + 4;
+  if (x > 45) s = s + x * 7 - t; else t = t + 0;
+  if (x > 46) s = s + x * 8 - t; else t = t + 1;
+  if (c > 0) t = t + c * 2; else s = s / c;
+  if (x > 48) s = s + x * 10 - t; else t = t + 3;
+  if (x > 49) s = s + x * 11 - t; else t = t + 4;
+  if (x > 0) s = s + x * 12 - t; else t = t + 0;
+  if (c > 1) t = t + c * 6; else s = s / c;
+  if (x > 2) s = s + x * 1 - t; else t = t + 2;
+  if (x > 3) s = s + x * 2 - t; else t = t + 3;
+  if (x > 4) s = s + x * 3 - t; else t = t + 4;
+  if (c > 2) t = t + c * 3; else s = s / c;
+  if (x > 6) s = s + x * 5 - t; else t = t + 1;
+  if (x > 7) s = s + x * 6 - t; else t = t + 2;
+  if (x > 8) s = s + x * 7 - t; else t = t + 3;
+  if (c > 0) t = t + c * 0; else s = s / c;
+  if (x > 10) s = s + x * 9 - t; else t = t + 0;
+  if (x > 11) s = s + x * 10 - t; else t = t + 1;
+  if (x > 12) s = s + x * 11 - t; else t = t + 2;
+  if (c > 1) t = t + c * 4; else s = s / c;
+  if (x > 14) s = s + x * 0 - t; else t = t + 4;
+  if (x > 15) s = s + x * 1 - t; else t = t + 0;
+  if (x > 16) s = s + x * 2 - t; else t = t + 1;
+  if (c > 2) t = t + c * 1; else s = s / c;
+  if (x > 18) s = s + x * 4 - t; else t = t + 3;
+  if (x > 19) s = s + x * 5 - t; else t = t + 4;
+  if (x > 20) s = s + x * 6 - t; else t = t + 0;
+  if (c > 0) t = t + c * 5; else s = s / c;
+  if (x > 22) s = s + x * 8 - t; else t = t + 2;
+  if (x > 23) s = s + x * 9 - t; else t = t + 3;
+  if (x > 24) s = s + x * 10 - t; else t = t + 4;
+  if (c > 1) t = t + c * 2; else s = s / c;
+  if (x > 26) s = s + x * 12 - t; else t = t + 1;
+  if (x > 27) s = s + x * 0 - t; else t = t + 2;
+  if (x > 28) s = s + x * 1 - t; else t = t + 3;
+  if (c > 2) t = t + c * 6; else s = s / c;
+  if (x > 30) s = s + x * 3 - t; else t = t + 0;
+  if (x > 31) s = s + x * 4 - t; else t = t + 1;
+  if (x > 32) s = s + x * 5 - t; else t = t + 2;
+  if (c > 0) t = t + c * 3; else s = s / c;
+  if (x > 34) s = s + x * 7 - t; else t = t + 4;
+  if (x > 35) s = s + x * 8 - t; else t = t + 0;
+  if (x > 36) s = s + x * 9 - t; else t = t + 1;
+  if (c > 1) t = t + c * 0; else s = s / c;
+  if (x > 38) s = s + x * 11 - t; else t = t + 3;
+  if (x > 39) s = s + x * 12 - t; else t = t + 4;
+  if (x > 40) s = s + x * 0 - t; else t = t + 0;
+  if (c > 2) t = t + c * 4; else s = s / c;
+  if (x > 42) s = s + x * 2 - t; else t = t + 2;
+  if (x > 43) s = s + x * 3 - t; else t = t + 3;
+  if (x > 44) s = s + x * 4 - t; else t = t + 4;
+  if (c > 0) t = t + c * 1; else s = s / c;
+  if (x > 46) s = s + x * 6 - t; else t = t + 1;
+  if (x > 47) s = s + x * 7 - t; else t = t + 2;
+  if (x > 48) s = s + x * 8 - t; else t = t + 3;
+  if (c > 1) t = t + c * 5; else s = s / c;
+  if (x > 0) s = s + x * 10 - t; else t = t + 0;
+  if (x > 1) s = s + x * 11 - t; else t = t + 1;
+  if (x > 2) s = s + x * 12 - t; else t = t + 2;
+  if (c > 2) t = t + c * 2; else s = s / c;
+  if (x > 4) s = s + x * 1 - t; else t = t + 4;
+  if (x > 5) s = s + x * 2 - t; else t = t + 0;
+  if (x > 6) s = s + x * 3 - t; else t = t + 1;
+  if (c > 0) t = t + c * 6; else s = s / c;
+  if (x > 8) s = s + x * 5 - t; else t = t + 3;
+  if (x > 9) s = s + x * 6 - t; else t = t + 4;
+  if (x > 10) s = s + x * 7 - t; else t = t + 0;
+  if (c > 1) t = t + c * 3; else s = s / c;
+  if (x > 12) s = s + x * 9 - t; else t = t + 2;
+  if (x > 13) s = s + x * 10 - t; else t = t + 3;
+  if (x > 14) s = s + x * 11 - t; else t = t + 4;
+  if (c > 2) t = t + c * 0; else s = s / c;
+  if (x > 16) s = s + x * 0 - t; else t = t + 1;
+  if (x > 17) s = s + x * 1 - t; else t = t + 2;
+  if (x > 18) s = s + x * 2 - t; else t = t + 3;
+  if (c > 0) t = t + c * 4; else s = s / c;
+  if (x > 20) s = s + x * 4 - t; else t = t + 0;
+  if (x > 21) s = s + x * 5 - t; else t = t + 1;
+  if (x > 22) s = s + x * 6 - t; else t = t + 2;
+  if (c > 1) t = t + c * 1; else s = s / c;
+  if (x > 24) s = s + x * 8 - t; else t = t + 4;
+  if (x > 25) s = s + x * 9 - t; else t = t + 0;
+  if (x > 26) s = s + x * 10 - t; else t = t + 1;
+  if (c > 2) t = t + c * 5; else s = s / c;
+  if (x > 28) s = s + x * 12 - t; else t = t + 3;
+  if (x > 29) s = s + x * 0 - t; else t = t + 4;
+  if (x > 30) s = s + x * 1 - t; else t = t + 0;
+  if (c > 0) t = t + c * 2; else s = s / c;
+  if (x > 32) s = s + x * 3 - t; else t = t + 2;
+  if (x > 33) s = s + x * 4 - t; else t = t + 3;
+  if (x > 34) s = s + x * 5 - t; else t = t + 4;
+  if (c > 1) t = t + c * 6; else s = s / c;
+  if (x > 36) s = s + x * 7 - t; else t = t + 1;
+  if (x > 37) s = s + x * 8 - t; else t = t + 2;
+  if (x > 38) s = s + x * 9 - t; else t = t + 3;
+  if (c > 2) t = t + c * 3; else s = s / c;
+  if (x > 40) s = s + x * 11 - t; else t = t + 0;
+  if (x > 41) s = s + x * 12 - t; else t = t + 1;
+  if (x > 42) s = s + x * 0 - t; else t = t + 2;
+  if (c > 0) t = t + c * 0; else s = s / c;
+  if (x > 44) s = s + x * 2 - t; else t = t + 4;
+  if (x > 45) s = s + x * 3 - t; else t = t + 0;
+  if (x > 46) s = s + x * 4 - t; else t = t + 1;
+  if (c > 1) t = t + c * 4; else s = s / c;
+  if (x > 48) s = s + x * 6 - t; else t = t + 3;
+  if (x > 49) s = s + x * 7 - t; else t = t + 4;
+  if (x > 0) s = s + x * 8 - t; else t = t + 0;
+  if (c > 2) t = t + c * 1; else s = s / c;
+  if (x > 2) s = s + x * 10 - t; else t = t + 2;
+  if (x > 3) s = s + x * 11 - t; else t = t + 3;
+  if (x > 4) s = s + x * 12 - t; else t = t + 4;
+  if (c > 0) t = t + c * 5; else s = s / c;
+  if (x > 6) s = s + x * 1 - t; else t = t + 1;
+  if (x > 7) s = s + x * 2 - t; else t = t + 2;
+  if (x > 8) s = s + x * 3 - t; else t = t + 3;
+  if (c > 1) t = t + c * 2; else s = s / c;
+  if (x > 10) s = s + x * 5 - t; else t = t + 0;
+  if (x > 11) s = s + x * 6 - t; else t = t + 1;
+  if (x > 12) s = s + x * 7 - t; else t = t + 2;
+  if (c > 2) t = t + c * 6; else s = s / c;
+  if (x > 14) s = s + x * 9 - t; else t = t + 4;
+  if (x > 15) s = s + x * 10 - t; else t = t + 0;
+  if (x > 16) s = s + x * 11 - t; else t = t + 1;
+  if (c > 0) t = t + c * 3; else s = s / c;
+  if (x > 18) s = s + x * 0 - t; else t = t + 3;
+  if (x > 19) s = s + x * 1 - t; else t = t + 4;
+  if (x > 20) s = s + x * 2 - t; else t = t + 0;
+  if (c > 1) t = t + c * 0; else s = s / c;
+  if (x > 22) s = s + x * 4 - t; else t = t + 2;
+  if (x > 23) s = s + x * 5 - t; else t = t + 3;
+  if (x > 24) s = s + x * 6 - t; else t = t + 4;
+  if (c > 2) t = t + c * 4; else s = s / c;
+  if (x > 26) s = s + x * 8 - t; else t = t + 1;
+  if (x > 27) s = s + x * 9 - t; else t = t + 2;
+  if (x > 28) s = s + x * 10 - t; else t = t + 3;
+  if (c > 0) t = t + c * 1; else s = s / c;
+  if (x > 30) s = s + x * 12 - t; else t = t + 0;
+  if (x > 31) s = s + x * 0 - t; else t = t + 1;
+  if (x > 32) s = s + x * 1 - t; else t = t + 2;
+  if (c > 1) t = t + c * 5; else s = s / c;
+  if (x > 34) s = s + x * 3 - t; else t = t + 4;
+  if (x > 35) s = s + x * 4 - t; else t = t + 0;
+  if (x > 36) s = s + x * 5 - t; else t = t + 1;
+  if (c > 2) t = t + c * 2; else s = s / c;
+  if (x > 38) s = s + x * 7 - t; else t = t + 3;
+  if (x > 39) s = s + x * 8 - t; else t = t + 4;
+  if (x > 40) s = s + x * 9 - t; else t = t + 0;
+  if (c > 0) t = t + c * 6; else s = s / c;
+  if (x > 42) s = s + x * 11 - t; else t = t + 2;
+  if (x > 43) s = s + x * 12 - t; else t = t + 3;
+  if (x > 44) s = s + x * 0 - t; else t = t + 4;
+  if (c > 1) t = t + c * 3; else s = s / c;
+  if (x > 46) s = s + x * 2 - t; else t = t + 1;
+  if (x > 47) s = s + x * 3 - t; else t = t + 2;
+  if (x > 48) s = s + x * 4 - t; else t = t + 3;
+  if (c > 2) t = t + c * 0; else s = s / c;
+  if (x > 0) s = s + x * 6 - t; else t = t + 0;
+  if (x > 1) s = s + x * 7 - t; else t = t + 1;
+  if (x > 2) s = s + x * 8 - t; else t = t + 2;
+  if (c > 0) t = t + c * 4; else s = s / c;
+  if (x > 4) s = s + x * 10 - t; else t = t + 4;
+  if (x > 5) s = s + x * 11 - t; else t = t + 0;
+  if (x > 6) s = s + x * 12 - t; else t = t + 1;
+  if (c > 1) t = t + c * 1; else s = s / c;
+  if (x > 8) s = s + x * 1 - t; else t = t + 3;
+  if (x > 9) s = s + x * 2 - t; else t = t + 4;
+  if (x > 10) s = s + x * 3 - t; else t = t + 0;
+  if (c > 2) t = t + c * 5; else s = s / c;
+  if (x > 12) s = s + x * 5 - t; else t = t + 2;
+  if (x > 13) s = s + x * 6 - t; else t = t + 3;
+  if (x > 14) s = s + x * 7 - t; else t = t + 4;
+  if (c > 0) t = t + c * 2; else s = s / c;
+  if (x > 16) s = s + x * 9 - t; else t = t + 1;
+  if (x > 17) s = s + x * 10 - t; else t = t + 2;
+  if (x > 18) s = s + x * 11 - t; else t = t + 3;
+  if (c > 1) t = t + c * 6; else s = s / c;
+  if (x > 20) s = s + x * 0 - t; else t = t + 0;
+  if (x > 21) s = s + x * 1 - t; else t = t + 1;
+  if (x > 22) s = s + x * 2 - t; else t = t + 2;
+  if (c > 2) t = t + c * 3; else s = s / c;
+  if (x > 24) s = s + x * 4 - t; else t = t + 4;
+  if (x > 25) s = s + x * 5 - t; else t = t + 0;
+  if (x > 26) s = s + x * 6 - t; else t = t + 1;
+  if (c > 0) t = t + c * 0; else s = s / c;
+  if (x > 28) s = s + x * 8 - t; else t = t + 3;
+  if (x > 29) s = s + x * 9 - t; else t = t + 4;
+  if (x > 30) s = s + x * 10 - t; else t = t + 0;
+  if (c > 1) t = t + c * 4; else s = s / c;
+  if (x > 32) s = s + x * 12 - t; else t = t + 2;
+  if (x > 33) s = s + x * 0 - t; else t = t + 3;
+  if (x > 34) s = s + x * 1 - t; else t = t + 4;
+  if (c > 2) t = t + c * 1; else s = s / c;
+  if (x > 36) s = s + x * 3 - t; else t = t + 1;
+  if (x > 37) s = s + x * 4 - t; else t = t + 2;
+  if (x > 38) s = s + x * 5 - t; else t = t + 3;
+  if (c > 0) t = t + c * 5; else s = s / c;
+  if (x > 40) s = s + x * 7 - t; else t = t + 0;
+  if (x > 41) s = s + x * 8 - t; else t = t + 1;
+  if (x > 42) s = s + x * 9 - t; else t = t + 2;
+  if (c > 1) t = t + c * 2; else s = s / c;
+  if (x > 44) s = s + x * 11 - t; else t = t + 4;
+  if (x > 45) s = s + x * 12 - t; else t = t + 0;
+  if (x > 46) s = s + x * 0 - t; else t = t + 1;
+  if (c > 2) t = t + c * 6; else s = s / c;
+  if (x > 48) s = s + x * 2 - t; else t = t + 3;
+  if (x > 49) s = s + x * 3 - t; else t = t + 4;
+  if (x > 0) s = s + x * 4 - t; else t = t + 0;
+  if (c > 0) t = t + c * 3; else s = s / c;
+  if (x > 2) s = s + x * 6 - t; else t = t + 2;
+  if (x > 3) s = s + x * 7 - t; else t = t + 3;
+  if (x > 4) s = s + x * 8 - t; else t = t + 4;
+  if (c > 1) t = t + c * 0; else s = s / c;
+  if (x > 6) s = s + x * 10 - t; else t = t + 1;
+  if (x > 7) s = s + x * 11 - t; else t = t + 2;
+  if (x > 8) s = s + x * 12 - t; else t = t + 3;
+  if (c > 2) t = t + c * 4; else s = s / c;
+  if (x > 10) s = s + x * 1 - t; else t = t + 0;
+  if (x > 11) s = s + x * 2 - t; else t = t + 1;
+  if (x > 12) s = s + x * 3 - t; else t = t + 2;
+  if (c > 0) t = t + c * 1; else s = s / c;
+  if (x > 14) s = s + x * 5 - t; else t = t + 4;
+  if (x > 15) s = s + x * 6 - t; else t = t + 0;
+  if (x > 16) s = s + x * 7 - t; else t = t + 1;
+  if (c > 1) t = t + c * 5; else s = s / c;
+  if (x > 18) s = s + x * 9 - t; else t = t + 3;
+  if (x > 19) s = s + x * 10 - t; else t = t + 4;
+  if (x > 20) s = s + x * 11 - t; else t = t + 0;
+  if (c > 2) t = t + c * 2; else s = s / c;
+  if (x > 22) s = s + x * 0 - t; else t = t + 2;
+  if (x > 23) s = s + x * 1 - t; else t = t + 3;
+  if (x > 24) s = s + x * 2 - t; else t = t + 4;
+  if (c > 0) t = t + c * 6; else s = s / c;
+  if (x > 26) s = s + x * 4 - t; else t = t + 1;
+  if (x > 27) s = s + x * 5 - t; else t = t + 2;
+  if (x > 28) s = s + x * 6 - t; else t = t + 3;
+  if (c > 1) t = t + c * 3; else s = s / c;
+  if (x > 30) s = s + x * 8 - t; else t = t + 0;
+  if (x > 31) s = s + x * 9 - t; else t = t + 1;
+  if (x > 32) s = s + x * 10 - t; else t = t + 2;
+  if (c > 2) t = t + c * 0; else s = s / c;
+  if (x > 34) s = s + x * 12 - t; else t = t + 4;
+  if (x > 35) s = s + x * 0 - t; else t = t + 0;
+  if (x > 36) s = s + x * 1 - t; else t = t + 1;
+  if (c > 0) t = t + c * 4; else s = s / c;
+  if (x > 38) s = s + x * 3 - t; else t = t + 3;
+  if (x > 39) s = s + x * 4 - t; else t = t + 4;
+  if (x > 40) s = s + x * 5 - t; else t = t + 0;
+  if (c > 1) t = t + c * 1; else s = s / c;
+  if (x > 42) s = s + x * 7 - t; else t = t + 2;
+  if (x > 43) s = s + x * 8 - t; else t = t + 3;
+  if (x > 44) s = s + x * 9 - t; else t = t + 4;
+  if (c > 2) t = t + c * 5; else s = s / c;
+  if (x > 46) s = s + x * 11 - t; else t = t + 1;
+  if (x > 47) s = s + x * 12 - t; else t = t + 2;
+  if (x > 48) s = s + x * 0 - t; else t = t + 3;
+  if (c > 0) t = t + c * 2; else s = s / c;
+  if (x > 0) s = s + x * 2 - t; else t = t + 0;
+  if (x > 1) s = s + x * 3 - t; else t = t + 1;
+  if (x > 2) s = s + x * 4 - t; else t = t + 2;
+  if (c > 1) t = t + c * 6; else s = s / c;
+  if (x > 4) s = s + x * 6 - t; else t = t + 4;
+  if (x > 5) s = s + x * 7 - t; else t = t + 0;
+  if (x > 6) s = s + x * 8 - t; else t = t + 1;
+  if (c > 2) t = t + c * 3; else s = s / c;
+  if (x > 8) s = s + x * 10 - t; else t = t + 3;
+  if (x > 9) s = s + x * 11 - t; else t = t + 4;
+  if (x > 10) s = s + x * 12 - t; else t = t + 0;
+  if (c > 0) t = t + c * 0; else s = s / c;
+  if (x > 12) s = s + x * 1 - t; else t = t + 2;
+  if (x > 13) s = s + x * 2 - t; else t = t + 3;
+  if (x > 14) s = s + x * 3 - t; else t = t + 4;
+  if (c > 1) t = t + c * 4; else s = s / c;
+  if (x > 16) s = s + x * 5 - t; else t = t + 1;
+  if (x > 17) s = s + x * 6 - t; else t = t + 2;
+  if (x > 18) s = s + x * 7 - t; else t = t + 3;
+  if (c > 2) t = t + c * 1; else s = s / c;
+  if (x > 20) s = s + x * 9 - t; else t = t + 0;
+  if (x > 21) s = s + x * 10 - t; else t = t + 1;
+  if (x > 22) s = s + x * 11 - t; else t = t + 2;
+  if (c > 0) t = t + c * 5; else s = s / c;
+  if (x > 24) s = s + x * 0 - t; else t = t + 4;
+  if (x > 25) s = s + x * 1 - t; else t = t + 0;
+  if (x > 26) s = s + x * 2 - t; else t = t + 1;
+  if (c > 1) t = t + c * 2; else s = s / c;
+  if (x > 28) s = s + x * 4 - t; else t = t + 3;
+  if (x > 29) s = s + x * 5 - t; else t = t + 4;
+  if (x > 30) s = s + x * 6 - t; else t = t + 0;
+  if (c > 2) t = t + c * 6; else s = s / c;
+  if (x > 32) s = s + x * 8 - t; else t = t + 2;
+  if (x > 33) s = s + x * 9 - t; else t = t + 3;
+  if (x > 34) s = s + x * 10 - t; else t = t + 4;
+  if (c > 0) t = t + c * 3; else s = s / c;
+  if (x > 36) s = s + x * 12 - t; else t = t + 1;
+  if (x > 37) s = s + x * 0 - t; else t = t + 2;
+  if (x > 38) s = s + x * 1 - t; else t = t + 3;
+  if (c > 1) t = t + c * 0; else s = s / c;
+  if (x > 40) s = s + x * 3 - t; else t = t + 0;
+  if (x > 41) s = s + x * 4 - t; else t = t + 1;
+  if (x > 42) s = s + x * 5 - t; else t = t + 2;
+  if (c > 2) t = t + c * 4; else s = s / c;
+  if (x > 44) s = s + x * 7 - t; else t = t + 4;
+  if (x > 45) s = s + x * 8 - t; else t = t + 0;
+  if (x > 46) s = s + x * 9 - t; else t = t + 1;
+  if (c > 0) t = t + c * 1; else s = s / c;
+  if (x > 48) s = s + x * 11 - t; else t = t + 3;
+  if (x > 49) s = s + x * 12 - t; else t = t + 4;
+  if (x > 0) s = s + x * 0 - t; else t = t + 0;
+  if (c > 1) t = t + c * 5; else s = s / c;
+  if (x > 2) s = s + x * 2 - t; else t = t + 2;
+  if (x > 3) s = s + x * 3 - t; else t = t + 3;
+  if (x > 4) s = s + x * 4 - t; else t = t + 4;
+  if (c > 2) t = t + c * 2; else s = s / c;
+  if (x > 6) s = s + x * 6 - t; else t = t + 1;
+  if (x > 7) s = s + x * 7 - t; else t = t + 2;
+  if (x > 8) s = s + x * 8 - t; else t = t + 3;
+  if (c > 0) t = t + c * 6; else s = s / c;
+  if (x > 10) s = s + x * 10 - t; else t = t + 0;
+  if (x > 11) s = s + x * 11 - t; else t = t + 1;
+  if (x > 12) s = s + x * 12 - t; else t = t + 2;
+  if (c > 1) t = t + c * 3; else s = s / c;
+  if (x > 14) s = s + x * 1 - t; else t = t + 4;
+  if (x > 15) s = s + x * 2 - t; else t = t + 0;
+  if (x > 16) s = s + x * 3 - t; else t = t + 1;
+  if (c > 2) t = t + c * 0; else s = s / c;
+  if (x > 18) s = s + x * 5 - t; else t = t + 3;
+  if (x > 19) s = s + x * 6 - t; else t = t + 4;
+  if (x > 20) s = s + x * 7 - t; else t = t + 0;
+  if (c > 0) t = t + c * 4; else s = s / c;
+  if (x > 22) s = s + x * 9 - t; else t = t + 2;
+  if (x > 23) s = s + x * 10 - t; else t = t + 3;
+  if (x > 24) s = s + x * 11 - t; else t = t + 4;
+  if (c > 1) t = t + c * 1; else s = s / c;
+  if (x > 26) s = s + x * 0 - t; else t = t + 1;
+  if (x > 27) s = s + x * 1 - t; else t = t + 2;
+  if (x > 28) s = s + x * 2 - t; else t = t + 3;
+  if (c > 2) t = t + c * 5; else s = s / c;
+  if (x > 30) s = s + x * 4 - t; else t = t + 0;
+  if (x > 31) s = s + x * 5 - t; else t = t + 1;
+  if (x > 32) s = s + x * 6 - t; else t = t + 2;
+  if (c > 0) t = t + c * 2; else s = s / c;
+  if (x > 34) s = s + x * 8 - t; else t = t + 4;
+  if (x > 35) s = s + x * 9 - t; else t = t + 0;
+  if (x > 36) s = s + x * 10 - t; else t = t + 1;
+  if (c > 1) t = t + c * 6; else s = s / c;
+  if (x > 38) s = s + x * 12 - t; else t = t + 3;
+  if (x > 39) s = s + x * 0 - t; else t = t + 4;
+  if (x > 40) s = s + x * 1 - t; else t = t + 0;
+  if (c > 2) t = t + c * 3; else s = s / c;
+  if (x > 42) s = s + x * 3 - t; else t = t + 2;
+  if (x > 43) s = s + x * 4 - t; else t = t + 3;
+  if (x > 44) s = s + x * 5 - t; else t = t + 4;
+  if (c > 0) t = t + c * 0; else s = s / c;
+  if (x > 46) s = s + x * 7 - t; else t = t + 1;
+  if (x > 47) s = s + x * 8 - t; else t = t + 2;
+  if (x > 48) s = s + x * 9 - t; else t = t + 3;
+  if (c > 1) t = t + c * 4; else s = s / c;
+  if (x > 0) s = s + x * 11 - t; else t = t + 0;
+  if (x > 1) s = s + x * 12 - t; else t = t + 1;
+  if (x > 2) s = s + x * 0 - t; else t = t + 2;
+  if (c > 2) t = t + c * 1; else s = s / c;
+  if (x > 4) s = s + x * 2 - t; else t = t + 4;
+  if (x > 5) s = s + x * 3 - t; else t = t + 0;
+  if (x > 6) s = s + x * 4 - t; else t = t + 1;
+  if (c > 0) t = t + c * 5; else s = s / c;
+  if (x > 8) s = s + x * 6 - t; else t = t + 3;
+  if (x > 9) s = s + x * 7 - t; else t = t + 4;
+  if (x > 10) s = s + x * 8 - t; else t = t + 0;
+  if (c > 1) t = t + c * 2; else s = s / c;
+  if (x > 12) s = s + x * 10 - t; else t = t + 2;
+  if (x > 13) s = s + x * 11 - t; else t = t + 3;
+  if (x > 14) s = s + x * 12 - t; else t = t + 4;
+  if (c > 2) t = t + c * 6; else s = s / c;
+  if (x > 16) s = s + x * 1 - t; else t = t + 1;
+  if (x > 17) s = s + x * 2 - t; else t = t + 2;
+  if (x > 18) s = s + x * 3 - t; else t = t + 3;
+  if (c > 0) t = t + c * 3; else s = s / c;
+  if (x > 20) s = s + x * 5 - t; else t = t + 0;
+  if (x > 21) s = s + x * 6 - t; else t = t + 1;
+  if (x > 22) s = s + x * 7 - t; else t = t + 2;
+  if (c > 1) t = t + c * 0; else s = s / c;
+  if (x > 24) s = s + x * 9 - t; else t = t + 4;
+  if (x > 25) s = s + x * 10 - t; else t = t + 0;
+  if (x > 26) s = s + x * 11 - t; else t = t + 1;
+  if (c > 2) t = t + c * 4; else s = s / c;
+  if (x > 28) s = s + x * 0 - t; else t = t + 3;
+  if (x > 29) s = s + x * 1 - t; else t = t + 4;
+  if (x > 30) s = s + x * 2 - t; else t = t + 0;
+  if (c > 0) t = t + c * 1; else s = s / c;
+  if (x > 32) s = s + x * 4 - t; else t = t + 2;
+  if (x > 33) s = s + x * 5 - t; else t = t + 3;
+  if (x > 34) s = s + x * 6 - t; else t = t + 4;
+  if (c > 1) t = t + c * 5; else s = s / c;
+  if (x > 36) s = s + x * 8 - t; else t = t + 1;
+  if (x > 37) s = s + x * 9 - t; else t = t + 2;
+  if (x > 38) s = s + x * 10 - t; else t = t + 3;
+  if (c > 2) t = t + c * 2; else s = s / c;
+  if (x > 40) s = s + x * 12 - t; else t = t + 0;
+  if (x > 41) s = s + x * 0 - t; else t = t + 1;
+  if (x > 42) s = s + x * 1 - t; else t = t + 2;
+  if (c > 0) t = t + c * 6; else s = s / c;
+  if (x > 44) s = s + x * 3 - t; else t = t + 4;
+  if (x > 45) s = s + x * 4 - t; else t = t + 0;
+  if (x > 46) s = s + x * 5 - t; else t = t + 1;
+  if (c > 1) t = t + c * 3; else s = s / c;
+  if (x > 48) s = s + x * 7 - t; else t = t + 3;
+  if (x > 49) s = s + x * 8 - t; else t = t + 4;
+  if (x > 0) s = s + x * 9 - t; else t = t + 0;
+  if (c > 2) t = t + c * 0; else s = s / c;
+  if (x > 2) s = s + x * 11 - t; else t = t + 2;
+  if (x > 3) s = s + x * 12 - t; else t = t + 3;
+  if (x > 4) s = s + x * 0 - t; else t = t + 4;
+  if (c > 0) t = t + c * 4; else s = s / c;
+  if (x > 6) s = s + x * 2 - t; else t = t + 1;
+  if (x > 7) s = s + x * 3 - t; else t = t + 2;
+  if (x > 8) s = s + x * 4 - t; else t = t + 3;
+  if (c > 1) t = t + c * 1; else s = s / c;
+  if (x > 10) s = s + x * 6 - t; else t = t + 0;
+  if (x > 11) s = s + x * 7 - t; else t = t + 1;
+  if (x > 12) s = s + x * 8 - t; else t = t + 2;
+  if (c > 2) t = t + c * 5; else s = s / c;
+  if (x > 14) s = s + x * 10 - t; else t = t + 4;
+  if (x > 15) s = s + x * 11 - t; else t = t + 0;
+  if (x > 16) s = s + x * 12 - t; else t = t + 1;
+  if (c > 0) t = t + c * 2; else s = s / c;
+  if (x > 18) s = s + x * 1 - t; else t = t + 3;
+  if (x > 19) s = s + x * 2 - t; else t = t + 4;
+  if (x > 20) s = s + x * 3 - t; else t = t + 0;
+  if (c > 1) t = t + c * 6; else s = s / c;
+  if (x > 22) s = s + x * 5 - t; else t = t + 2;
+  if (x > 23) s = s + x * 6 - t; else t = t + 3;
+  if (x > 24) s = s + x * 7 - t; else t = t + 4;
+  if (c > 2) t = t + c * 3; else s = s / c;
+  if (x > 26) s = s + x * 9 - t; else t = t + 1;
+  if (x > 27) s = s + x * 10 - t; else t = t + 2;
+  if (x > 28) s = s + x * 11 - t; else t = t + 3;
+  if (c > 0) t = t + c * 0; else s = s / c;
+  if (x > 30) s = s + x * 0 - t; else t = t + 0;
+  if (x > 31) s = s + x * 1 - t; else t = t + 1;
+  if (x > 32) s = s + x * 2 - t; else t = t + 2;
+  if (c > 1) t = t + c * 4; else s = s / c;
+  if (x > 34) s = s + x * 4 - t; else t = t + 4;
+  if (x > 35) s = s + x * 5 - t; else t = t + 0;
+  if (x > 36) s = s + x * 6 - t; else t = t + 1;
+  if (c > 2) t = t + c * 1; else s = s / c;
+  if (x > 38) s = s + x * 8 - t; else t = t + 3;
+  if (x > 39) s = s + x * 9 - t; else t = t + 4;
+  if (x > 40) s = s + x * 10 - t; else t = t + 0;
+  if (c > 0) t = t + c * 5; else s = s / c;
+  if (x > 42) s = s + x * 12 - t; else t = t + 2;
+  if (x > 43) s = s + x * 0 - t; else t = t + 3;
+  if (x > 44) s = s + x * 1 - t; else t = t + 4;
+  if (c > 1) t = t + c * 2; else s = s / c;
+  if (x > 46) s = s + x * 3 - t; else t = t + 1;
+  if (x > 47) s = s + x * 4 - t; else t = t + 2;
+  if (x > 48) s = s + x * 5 - t; else t = t + 3;
+  if (c > 2) t = t + c * 6; else s = s / c;
+  if (x > 0) s = s + x * 7 - t; else t = t + 0;
+  if (x > 1) s = s + x * 8 - t; else t = t + 1;
+  if (x > 2) s = s + x * 9 - t; else t = t + 2;
+  if (c > 0) t = t + c * 3; else s = s / c;
+  if (x > 4) s = s + x * 11 - t; else t = t + 4;
+  if (x > 5) s = s + x * 12 - t; else t = t + 0;
+  if (x > 6) s = s + x * 0 - t; else t = t + 1;
+  if (c > 1) t = t + c * 0; else s = s / c;
+  if (x > 8) s = s + x * 2 - t; else t = t + 3;
+  if (x > 9) s = s + x * 3 - t; else t = t + 4;
+  if (x > 10) s = s + x * 4 - t; else t = t + 0;
+  if (c > 2) t = t + c * 4; else s = s / c;
+  if (x > 12) s = s + x * 6 - t; else t = t + 2;
+  if (x > 13) s = s + x * 7 - t; else t = t + 3;
+  if (x > 14) s = s + x * 8 - t; else t = t + 4;
+  if (c > 0) t = t + c * 1; else s = s / c;
+  if (x > 16) s = s + x * 10 - t; else t = t + 1;
+  if (x > 17) s = s + x * 11 - t; else t = t + 2;
+  if (x > 18) s = s + x * 12 - t; else t = t + 3;
+  if (c > 1) t = t + c * 5; else s = s / c;
+  if (x > 20) s = s + x * 1 - t; else t = t + 0;
+  if (x > 21) s = s + x * 2 - t; else t = t + 1;
+  if (x > 22) s = s + x * 3 - t; else t = t + 2;
+  if (c > 2) t = t + c * 2; else s = s / c;
+  if (x > 24) s = s + x * 5 - t; else t = t + 4;
+  if (x > 25) s = s + x * 6 - t; else t = t + 0;
+  if (x > 26) s = s + x * 7 - t; else t = t + 1;
+  if (c > 0) t = t + c * 6; else s = s / c;
+  if (x > 28) s = s + x * 9 - t; else t = t + 3;
+  if (x > 29) s = s + x * 10 - t; else t = t + 4;
+  if (x > 30) s = s + x * 11 - t; else t = t + 0;
+  if (c > 1) t = t + c * 3; else s = s / c;
+  if (x > 32) s = s + x * 0 - t; else t = t + 2;
+  if (x > 33) s = s + x * 1 - t; else t = t + 3;
+  if (x > 34) s = s + x * 2 - t; else t = t + 4;
+  if (c > 2) t = t + c * 0; else s = s / c;
+  if (x > 36) s = s + x * 4 - t; else t = t + 1;
+  if (x > 37) s = s + x * 5 - t; else t = t + 2;
+  if (x > 38) s = s + x * 6 - t; else t = t + 3;
+  if (c > 0) t = t + c * 4; else s = s / c;
+  if (x > 40) s = s + x * 8 - t; else t = t + 0;
+  if (x > 41) s = s + x * 9 - t; else t = t + 1;
+  if (x > 42) s = s + x * 10 - t; else t = t + 2;
+  if (c > 1) t = t + c * 1; else s = s / c;
+  if (x > 44) s = s + x * 12 - t; else t = t + 4;
+  if (x > 45) s = s + x * 0 - t; else t = t + 0;
+  if (x > 46) s = s + x * 1 - t; else t = t + 1;
+  if (c > 2) t = t + c * 5; else s = s / c;
+  if (x > 48) s = s + x * 3 - t; else t = t + 3;
+  if (x > 49) s = s + x * 4 - t; else t = t + 4;
+  if (x > 0) s = s + x * 5 - t; else t = t + 0;
+  if (c > 0) t = t + c * 2; else s = s / c;
+  if (x > 2) s = s + x * 7 - t; else t = t + 2;
+  if (x > 3) s = s + x * 8 - t; else t = t + 3;
+  if (x > 4) s = s + x * 9 - t; else t = t + 4;
+  if (c > 1) t = t + c * 6; else s = s / c;
+  if (x > 6) s = s + x * 11 - t; else t = t + 1;
+  if (x > 7) s = s + x * 12 - t; else t = t + 2;
+  if (x > 8) s = s + x * 0 - t; else t = t + 3;
+  if (c > 2) t = t + c * 3; else s = s / c;
+  if (x > 10) s = s + x * 2 - t; else t = t + 0;
+  if (x > 11) s = s + x * 3 - t; else t = t + 1;
+  if (x > 12) s = s + x * 4 - t; else t = t + 2;
+  if (c > 0) t = t + c * 0; else s = s / c;
+  if (x > 14) s = s + x * 6 - t; else t = t + 4;
+  if (x > 15) s = s + x * 7 - t; else t = t + 0;
+  if (x > 16) s = s + x * 8 - t; else t = t + 1;
+  if (c > 1) t = t + c * 4; else s = s / c;
+  if (x > 18) s = s + x * 10 - t; else t = t + 3;
+  if (x > 19) s = s + x * 11 - t; else t = t + 4;
+  if (x > 20) s = s + x * 12 - t; else t = t + 0;
+  if (c > 2) t = t + c * 1; else s = s / c;
+  if (x > 22) s = s + x * 1 - t; else t = t + 2;
+  if (x > 23) s = s + x * 2 - t; else t = t + 3;
+  if (x > 24) s = s + x * 3 - t; else t = t + 4;
+  if (c > 0) t = t + c * 5; else s = s / c;
+  if (x > 26) s = s + x * 5 - t; else t = t + 1;
+  if (x > 27) s = s + x * 6 - t; else t = t + 2;
+  if (x > 28) s = s + x * 7 - t; else t = t + 3;
+  if (c > 1) t = t + c * 2; else s = s / c;
+  if (x > 30) s = s + x * 9 - t; else t = t + 0;
+  if (x > 31) s = s + x * 10 - t; else t = t + 1;
+  if (x > 32) s = s + x * 11 - t; else t = t + 2;
+  if (c > 2) t = t + c * 6; else s = s / c;
+  if (x > 34) s = s + x * 0 - t; else t = t + 4;
+  if (x > 35) s = s + x * 1 - t; else t = t + 0;
+  if (x > 36) s = s + x * 2 - t; else t = t + 1;
+  if (c > 0) t = t + c * 3; else s = s / c;
+  if (x > 38) s = s + x * 4 - t; else t = t + 3;
+  if (x > 39) s = s + x * 5 - t; else t = t + 4;
+  if (x > 40) s = s + x * 6 - t; else t = t + 0;
+  if (c > 1) t = t + c * 0; else s = s / c;
+  if (x > 42) s = s + x * 8 - t; else t = t + 2;
+  if (x > 43) s = s + x * 9 - t; else t = t + 3;
+  if (x > 44) s = s + x * 10 - t; else t = t + 4;
+  if (c > 2) t = t + c * 4; else s = s / c;
+  if (x > 46) s = s + x * 12 - t; else t = t + 1;
+  if (x > 47) s = s + x * 0 - t; else t = t + 2;
+  if (x > 48) s = s + x * 1 - t; else t = t + 3;
+  if (c > 0) t = t + c * 1; else s = s / c;
+  if (x > 0) s = s + x * 3 - t; else t = t + 0;
+  if (x > 1) s = s + x * 4 - t; else t = t + 1;
+  if (x > 2) s = s + x * 5 - t; else t = t + 2;
+  if (c > 1) t = t + c * 5; else s = s / c;
+  if (x > 4) s = s + x * 7 - t; else t = t + 4;
+  if (x > 5) s = s + x * 8 - t; else t = t + 0;
+  if (x > 6) s = s + x * 9 - t; else t = t + 1;
+  if (c > 2) t = t + c * 2; else s = s / c;
+  if (x > 8) s = s + x * 11 - t; else t = t + 3;
+  if (x > 9) s = s + x * 12 - t; else t = t + 4;
+  if (x > 10) s = s + x * 0 - t; else t = t + 0;
+  if (c > 0) t = t + c * 6; else s = s / c;
+  if (x > 12) s = s + x * 2 - t; else t = t + 2;
+  if (x > 13) s = s + x * 3 - t; else t = t + 3;
+  if (x > 14) s = s + x * 4 - t; else t = t + 4;
+  if (c > 1) t = t + c * 3; else s = s / c;
+  if (x > 16) s = s + x * 6 - t; else t = t + 1;
+  if (x > 17) s = s + x * 7 - t; else t = t + 2;
+  if (x > 18) s = s + x * 8 - t; else t = t + 3;
+  if (c > 2) t = t + c * 0; else s = s / c;
+  if (x > 20) s = s + x * 10 - t; else t = t + 0;
+  if (x > 21) s = s + x * 11 - t; else t = t + 1;
+  if (x > 22) s = s + x * 12 - t; else t = t + 2;
+  if (c > 0) t = t + c * 4; else s = s / c;
+  if (x > 24) s = s + x * 1 - t; else t = t + 4;
+  if (x > 25) s = s + x * 2 - t; else t = t + 0;
+  if (x > 26) s = s + x * 3 - t; else t = t + 1;
+  if (c > 1) t = t + c * 1; else s = s / c;
+  if (x > 28) s = s + x * 5 - t; else t = t + 3;
+  if (x > 29) s = s + x * 6 - t; else t = t + 4;
+  if (x > 30) s = s + x * 7 - t; else t = t + 0;
+  if (c > 2) t = t + c * 5; else s = s / c;
+  if (x > 32) s = s + x * 9 - t; else t = t + 2;
+  if (x > 33) s = s + x * 10 - t; else t = t + 3;
+  if (x > 34) s = s + x * 11 - t; else t = t + 4;
+  if (c > 0) t = t + c * 2; else s = s / c;
+  if (x > 36) s = s + x * 0 - t; else t = t + 1;
+  if (x > 37) s = s + x * 1 - t; else t = t + 2;
+  if (x > 38) s = s + x * 2 - t; else t = t + 3;
+  if (c > 1) t = t + c * 6; else s = s / c;
+  if (x > 40) s = s + x * 4 - t; else t = t + 0;
+  if (x > 41) s = s + x * 5 - t; else t = t + 1;
+  if (x > 42) s = s + x * 6 - t; else t = t + 2;
+  if (c > 2) t = t + c * 3; else s = s / c;
+  if (x > 44) s = s + x * 8 - t; else t = t + 4;
+  if (x > 45) s = s + x * 9 - t; else t = t + 0;
+  if (x > 46) s = s + x * 10 - t; else t = t + 1;
+  if (c > 0) t = t + c * 0; else s = s / c;
+  if (x > 48) s = s + x * 12 - t; else t = t + 3;
+  if (x > 49) s = s + x * 0 - t; else t = t + 4;
+  if (x > 0) s = s + x * 1 - t; else t = t + 0;
+  if (c > 1) t = t + c * 4; else s = s / c;
+  if (x > 2) s = s + x * 3 - t; else t = t + 2;
+  if (x > 3) s = s + x * 4 - t; else t = t + 3;
+  if (x > 4) s = s + x * 5 - t; else t = t + 4;
+  if (c > 2) t = t + c * 1; else s = s / c;
+  if (x > 6) s = s + x * 7 - t; else t = t + 1;
+  if (x > 7) s = s + x * 8 - t; else t = t + 2;
+  if (x > 8) s = s + x * 9 - t; else t = t + 3;
+  if (c > 0) t = t + c * 5; else s = s / c;
+  if (x > 10) s = s + x * 11 - t; else t = t + 0;
+  if (x > 11) s = s + x * 12 - t; else t = t + 1;
+  if (x > 12) s = s + x * 0 - t; else t = t + 2;
+  if (c > 1) t = t + c * 2; else s = s / c;
+  if (x > 14) s = s + x * 2 - t; else t = t + 4;
+  if (x > 15) s = s + x * 3 - t; else t = t + 0;
+  if (x > 16) s = s + x * 4 - t; else t = t + 1;
+  if (c > 2) t = t + c * 6; else s = s / c;
+  if (x > 18) s = s + x * 6 - t; else t = t + 3;
+  if (x > 19) s = s + x * 7 - t; else t = t + 4;
+  if (x > 20) s = s + x * 8 - t; else t = t + 0;
+  if (c > 0) t = t + c * 3; else s = s / c;
+  if (x > 22) s = s + x * 10 - t; else t = t + 2;
+  if (x > 23) s = s + x * 11 - t; else t = t + 3;
+  if (x > 24) s = s + x * 12 - t; else t = t + 4;
+  if (c > 1) t = t + c * 0; else s = s / c;
+  if (x > 26) s = s + x * 1 - t; else t = t + 1;
+  if (x > 27) s = s + x * 2 - t; else t = t + 2;
+  if (x > 28) s = s + x * 3 - t; else t = t + 3;
+  if (c > 2) t = t + c * 4; else s = s / c;
+  if (x > 30) s = s + x * 5 - t; else t = t + 0;
+  if (x > 31) s = s + x * 6 - t; else t = t + 1;
+  if (x > 32) s = s + x * 7 - t; else t = t + 2;
+  if (c > 0) t = t + c * 1; else s = s / c;
+  if (x > 34) s = s + x * 9 - t; else t = t + 4;
+  if (x > 35) s = s + x * 10 - t; else t = t + 0;
+  if (x > 36) s = s + x * 11 - t; else t = t + 1;
+  if (c > 1) t = t + c * 5; else s = s / c;
+  if (x > 38) s = s + x * 0 - t; else t = t + 3;
+  if (x > 39) s = s + x * 1 - t; else t = t + 4;
+  if (x > 40) s = s + x * 2 - t; else t = t + 0;
+  if (c > 2) t = t + c * 2; else s = s / c;
+  if (x > 42) s = s + x * 4 - t; else t = t + 2;
+  if (x > 43) s = s + x * 5 - t; else t = t + 3;
+  if (x > 44) s = s + x * 6 - t; else t = t + 4;
+  if (c > 0) t = t + c * 6; else s = s / c;
+  if (x > 46) s = s + x * 8 - t; else t = t + 1;
+  if (x > 47) s = s + x * 9 - t; else t = t + 2;
+  if (x > 48) s = s + x * 10 - t; else t = t + 3;
+  if (c > 1) t = t + c * 3; else s = s / c;
+  if (x > 0) s = s + x * 12 - t; else t = t + 0;
+  if (x > 1) s = s + x * 0 - t; else t = t + 1;
+  if (x > 2) s = s + x * 1 - t; else t = t + 2;
+  if (c > 2) t = t + c * 0; else s = s / c;
+  if (x > 4) s = s + x * 3 - t; else t = t + 4;
+  if (x > 5) s = s + x * 4 - t; else t = t + 0;
+  if (x > 6) s = s + x * 5 - t; else t = t + 1;
+  if (c > 0) t = t + c * 4; else s = s / c;
+  if (x > 8) s = s + x * 7 - t; else t = t + 3;
+  if (x > 9) s = s + x * 8 - t; else t = t + 4;
+  if (x > 10) s = s + x * 9 - t; else t = t + 0;
+  if (c > 1) t = t + c * 1; else s = s / c;
+  if (x > 12) s = s + x * 11 - t; else t = t + 2;
+  if (x > 13) s = s + x * 12 - t; else t = t + 3;
+  if (x > 14) s = s + x * 0 - t; else t = t + 4;
+  if (c > 2) t = t + c * 5; else s = s / c;
+  if (x > 16) s = s + x * 2 - t; else t = t + 1;
+  if (x > 17) s = s + x * 3 - t; else t = t + 2;
+  if (x > 18) s = s + x * 4 - t; else t = t + 3;
+  if (c > 0) t = t + c * 2; else s = s / c;
+  if (x > 20) s = s + x * 6 - t; else t = t + 0;
+  if (x > 21) s = s + x * 7 - t; else t = t + 1;
+  if (x > 22) s = s + x * 8 - t; else t = t + 2;
+  if (c > 1) t = t + c * 6; else s = s / c;
+  if (x > 24) s = s + x * 10 - t; else t = t + 4;
+  if (x > 25) s = s + x * 11 - t; else t = t + 0;
+  if (x > 26) s = s + x * 12 - t; else t = t + 1;
+  if (c > 2) t = t + c * 3; else s = s / c;
+  if (x > 28) s = s + x * 1 - t; else t = t + 3;
+  if (x > 29) s = s + x * 2 - t; else t = t + 4;
+  if (x > 30) s = s + x * 3 - t; else t = t + 0;
+  if (c > 0) t = t + c * 0; else s = s / c;
+  if (x > 32) s = s + x * 5 - t; else t = t + 2;
+  if (x > 33) s = s + x * 6 - t; else t = t + 3;
+  if (x > 34) s = s + x * 7 - t; else t = t + 4;
+  if (c > 1) t = t + c * 4; else s = s / c;
+  if (x > 36) s = s + x * 9 - t; else t = t + 1;
+  if (x > 37) s = s + x * 10 - t; else t = t + 2;
+  if (x > 38) s = s + x * 11 - t; else t = t + 3;
+  if (c > 2) t = t + c * 1; else s = s / c;
+  if (x > 40) s = s + x * 0 - t; else t = t + 0;
+  if (x > 41) s = s + x * 1 - t; else t = t + 1;
+  if (x > 42) s = s + x * 2 - t; else t = t + 2;
+  if (c > 0) t = t + c * 5; else s = s / c;
+  if (x > 44) s = s + x * 4 - t; else t = t + 4;
+  if (x > 45) s = s + x * 5 - t; else t = t + 0;
+  if (x > 46) s = s + x * 6 - t; else t = t + 1;
+  if (c > 1) t = t + c * 2; else s = s / c;
+  if (x > 48) s = s + x * 8 - t; else t = t + 3;
+  if (x > 49) s = s + x * 9 - t; else t = t + 4;
+  if (x > 0) s = s + x * 10 - t; else t = t + 0;
+  if (c > 2) t = t + c * 6; else s = s / c;
+  if (x > 2) s = s + x * 12 - t; else t = t + 2;
+  if (x > 3) s = s + x * 0 - t; else t = t + 3;
+  if (x > 4) s = s + x * 1 - t; else t = t + 4;
+  if (c > 0) t = t + c * 3; else s = s / c;
+  if (x > 6) s = s + x * 3 - t; else t = t + 1;
+  if (x > 7) s = s + x * 4 - t; else t = t + 2;
+  if (x > 8) s = s + x * 5 - t; else t = t + 3;
+  if (c > 1) t = t + c * 0; else s = s / c;
+  if (x > 10) s = s + x * 7 - t; else t = t + 0;
+  if (x > 11) s = s + x * 8 - t; else t = t + 1;
+  if (x > 12) s = s + x * 9 - t; else t = t + 2;
+  if (c > 2) t = t + c * 4; else s = s / c;
+  if (x > 14) s = s + x * 11 - t; else t = t + 4;
+  if (x > 15) s = s + x * 12 - t; else t = t + 0;
+  if (x > 16) s = s + x * 0 - t; else t = t + 1;
+  if (c > 0) t = t + c * 1; else s = s / c;
+  if (x > 18) s = s + x * 2 - t; else t = t + 3;
+  if (x > 19) s = s + x * 3 - t; else t = t + 4;
+  if (x > 20) s = s + x * 4 - t; else t = t + 0;
+  if (c > 1) t = t + c * 5; else s = s / c;
+  if (x > 22) s = s + x * 6 - t; else t = t + 2;
+  if (x > 23) s = s + x * 7 - t; else t = t + 3;
+  if (x > 24) s = s + x * 8 - t; else t = t + 4;
+  if (c > 2) t = t + c * 2; else s = s / c;
+  if (x > 26) s = s + x * 10 - t; else t = t + 1;
+  if (x > 27) s = s + x * 11 - t; else t = t + 2;
+  if (x > 28) s = s + x * 12 - t; else t = t + 3;
+  if (c > 0) t = t + c * 6; else s = s / c;
+  if (x > 30) s = s + x * 1 - t; else t = t + 0;
+  if (x > 31) s = s + x * 2 - t; else t = t + 1;
+  if (x > 32) s = s + x * 3 - t; else t = t + 2;
+  if (c > 1) t = t + c * 3; else s = s / c;
+  if (x > 34) s = s + x * 5 - t; else t = t + 4;
+  if (x > 35) s = s + x * 6 - t; else t = t + 0;
+  if (x > 36) s = s + x * 7 - t; else t = t + 1;
+  if (c > 2) t = t + c * 0; else s = s / c;
+  if (x > 38) s = s + x * 9 - t; else t = t + 3;
+  if (x > 39) s = s + x * 10 - t; else t = t + 4;
+  if (x > 40) s = s + x * 11 - t; else t = t + 0;
+  if (c > 0) t = t + c * 4; else s = s / c;
+  if (x > 42) s = s + x * 0 - t; else t = t + 2;
+  if (x > 43) s = s + x * 1 - t; else t = t + 3;
+  if (x > 44) s = s + x * 2 - t; else t = t + 4;
+  if (c > 1) t = t + c * 1; else s = s / c;
+  if (x > 46) s = s + x * 4 - t; else t = t + 1;
+  if (x > 47) s = s + x * 5 - t; else t = t + 2;
+  if (x > 48) s = s + x * 6 - t; else t = t + 3;
+  if (c > 2) t = t + c * 5; else s = s / c;
+  if (x > 0) s = s + x * 8 - t; else t = t + 0;
+  if (x > 1) s = s + x * 9 - t; else t = t + 1;
+  if (x > 2) s = s + x * 10 - t; else t = t + 2;
+  if (c > 0) t = t + c * 2; else s = s / c;
+  if (x > 4) s = s + x * 12 - t; else t = t + 4;
+  if (x > 5) s = s + x * 0 - t; else t = t + 0;
+  if (x > 6) s = s + x * 1 - t; else t = t + 1;
+  if (c > 1) t = t + c * 6; else s = s / c;
+  if (x > 8) s = s + x * 3 - t; else t = t + 3;
+  if (x > 9) s = s + x * 4 - t; else t = t + 4;
+  if (x > 10) s = s + x * 5 - t; else t = t + 0;
+  if (c > 2) t = t + c * 3; else s = s / c;
+  if (x > 12) s = s + x * 7 - t; else t = t + 2;
+  if (x > 13) s = s + x * 8 - t; else t = t + 3;
+  if (x > 14) s = s + x * 9 - t; else t = t + 4;
+  if (c > 0) t = t + c * 0; else s = s / c;
+  if (x > 16) s = s + x * 11 - t; else t = t + 1;
+  if (x > 17) s = s + x * 12 - t; else t = t + 2;
+  if (x > 18) s = s + x * 0 - t; else t = t + 3;
+  if (c > 1) t = t + c * 4; else s = s / c;
+  if (x > 20) s = s + x * 2 - t; else t = t + 0;
+  if (x > 21) s = s + x * 3 - t; else t = t + 1;
+  if (x > 22) s = s + x * 4 - t; else t = t + 2;
+  if (c > 2) t = t + c * 1; else s = s / c;
+  if (x > 24) s = s + x * 6 - t; else t = t + 4;
+  if (x > 25) s = s + x * 7 - t; else t = t + 0;
+  if (x > 26) s = s + x * 8 - t; else t = t + 1;
+  if (c > 0) t = t + c * 5; else s = s / c;
+  if (x > 28) s = s + x * 10 - t; else t = t + 3;
+  if (x > 29) s = s + x * 11 - t; else t = t + 4;
+  if (x > 30) s = s + x * 12 - t; else t = t + 0;
+  if (c > 1) t = t + c * 2; else s = s / c;
+  if (x > 32) s = s + x * 1 - t; else t = t + 2;
+  if (x > 33) s = s + x * 2 - t; else t = t + 3;
+  if (x > 34) s = s + x * 3 - t; else t = t + 4;
+  if (c > 2) t = t + c * 6; else s = s / c;
+  if (x > 36) s = s + x * 5 - t; else t = t + 1;
+  if (x > 37) s = s + x * 6 - t; else t = t + 2;
+  if (x > 38) s = s + x * 7 - t; else t = t + 3;
+  if (c > 0) t = t + c * 3; else s = s / c;
+  if (x > 40) s = s + x * 9 - t; else t = t + 0;
+  if (x > 41) s = s + x * 10 - t; else t = t + 1;
+  if (x > 42) s = s + x * 11 - t; else t = t + 2;
+  if (c > 1) t = t + c * 0; else s = s / c;
+  if (x > 44) s = s + x * 0 - t; else t = t + 4;
+  if (x > 45) s = s + x * 1 - t; else t = t + 0;
+  if (x > 46) s = s + x * 2 - t; else t = t + 1;
+  if (c > 2) t = t + c * 4; else s = s / c;
+  if (x > 48) s = s + x * 4 - t; else t = t + 3;
+  if (x > 49) s = s + x * 5 - t; else t = t + 4;
+  if (x > 0) s = s + x * 6 - t; else t = t + 0;
+  if (c > 0) t = t + c * 1; else s = s / c;
+  if (x > 2) s = s + x * 8 - t; else t = t + 2;
+  if (x > 3) s = s + x * 9 - t; else t = t + 3;
+  if (x > 4) s = s + x * 10 - t; else t = t + 4;
+  if (c > 1) t = t + c * 5; else s = s / c;
+  if (x > 6) s = s + x * 12 - t; else t = t + 1;
+  if (x > 7) s = s + x * 0 - t; else t = t + 2;
+  if (x > 8) s = s + x * 1 - t; else t = t + 3;
+  if (c > 2) t = t + c * 2; else s = s / c;
+  if (x > 10) s = s + x * 3 - t; else t = t + 0;
+  if (x > 11) s = s + x * 4 - t; else t = t + 1;
+  if (x > 12) s = s + x * 5 - t; else t = t + 2;
+  if (c > 0) t = t + c * 6; else s = s / c;
+  if (x > 14) s = s + x * 7 - t; else t = t + 4;
+  if (x > 15) s = s + x * 8 - t; else t = t + 0;
+  if (x > 16) s = s + x * 9 - t; else t = t + 1;
+  if (c > 1) t = t + c * 3; else s = s / c;
+  if (x > 18) s = s + x * 11 - t; else t = t + 3;
+  if (x > 19) s = s + x * 12 - t; else t = t + 4;
+  if (x > 20) s = s + x * 0 - t; else t = t + 0;
+  if (c > 2) t = t + c * 0; else s = s / c;
+  if (x > 22) s = s + x * 2 - t; else t = t + 2;
+  if (x > 23) s = s + x * 3 - t; else t = t + 3;
+  if (x > 24) s = s + x * 4 - t; else t = t + 4;
+  if (c > 0) t = t + c * 4; else s = s / c;
+  if (x > 26) s = s + x * 6 - t; else t = t + 1;
+  if (x > 27) s = s + x * 7 - t; else t = t + 2;
+  if (x > 28) s = s + x * 8 - t; else t = t + 3;
+  if (c > 1) t = t + c * 1; else s = s / c;
+  if (x > 30) s = s + x * 10 - t; else t = t + 0;
+  if (x > 31) s = s + x * 11 - t; else t = t + 1;
+  if (x > 32) s = s + x * 12 - t; else t = t + 2;
+  if (c > 2) t = t + c * 5; else s = s / c;
+  if (x > 34) s = s + x * 1 - t; else t = t + 4;
+  if (x > 35) s = s + x * 2 - t; else t = t + 0;
+  if (x > 36) s = s + x * 3 - t; else t = t + 1;
+  if (c > 0) t = t + c * 2; else s = s / c;
+  if (x > 38) s = s + x * 5 - t; else t = t + 3;
+  if (x > 39) s = s + x * 6 - t; else t = t + 4;
+  if (x > 40) s = s + x * 7 - t; else t = t + 0;
+  if (c > 1) t = t + c * 6; else s = s / c;
+  if (x > 42) s = s + x * 9 - t; else t = t + 2;
+  if (x > 43) s = s + x * 10 - t; else t = t + 3;
+  if (x > 44) s = s + x * 11 - t; else t = t + 4;
+  if (c > 2) t = t + c * 3; else s = s / c;
+  if (x > 46) s = s + x * 0 - t; else t = t + 1;
+  if (x > 47) s = s + x * 1 - t; else t = t + 2;
+  if (x > 48) s = s + x * 2 - t; else t = t + 3;
+  if (c > 0) t = t + c * 0; else s = s / c;
+  if (x > 0) s = s + x * 4 - t; else t = t + 0;
+  if (x > 1) s = s + x * 5 - t; else t = t + 1;
+  if (x > 2) s = s + x * 6 - t; else t = t + 2;
+  if (c > 1) t = t + c * 4; else s = s / c;
+  if (x > 4) s = s + x * 8 - t; else t = t + 4;
+  if (x > 5) s = s + x * 9 - t; else t = t + 0;
+  if (x > 6) s = s + x * 10 - t; else t = t + 1;
+  if (c > 2) t = t + c * 1; else s = s / c;
+  if (x > 8) s = s + x * 12 - t; else t = t + 3;
+  if (x > 9) s = s + x * 0 - t; else t = t + 4;
+  if (x > 10) s = s + x * 1 - t; else t = t + 0;
+  if (c > 0) t = t + c * 5; else s = s / c;
+  if (x > 12) s = s + x * 3 - t; else t = t + 2;
+  if (x > 13) s = s + x * 4 - t; else t = t + 3;
+  if (x > 14) s = s + x * 5 - t; else t = t + 4;
+  if (c > 1) t = t + c * 2; else s = s / c;
+  if (x > 16) s = s + x * 7 - t; else t = t + 1;
+  if (x > 17) s = s + x * 8 - t; else t = t + 2;
+  if (x > 18) s = s + x * 9 - t; else t = t + 3;
+  if (c > 2) t = t + c * 6; else s = s / c;
+  if (x > 20) s = s + x * 11 - t; else t = t + 0;
+  if (x > 21) s = s + x * 12 - t; else t = t + 1;
+  if (x > 22) s = s + x * 0 - t; else t = t + 2;
+  if (c > 0) t = t + c * 3; else s = s / c;
+  if (x > 24) s = s + x * 2 - t; else t = t + 4;
+  if (x > 25) s = s + x * 3 - t; else t = t + 0;
+  if (x > 26) s = s + x * 4 - t; else t = t + 1;
+  if (c > 1) t = t + c * 0; else s = s / c;
+  if (x > 28) s = s + x * 6 - t; else t = t + 3;
+  if (x > 29) s = s + x * 7 - t; else t = t + 4;
+  if (x > 30) s = s + x * 8 - t; else t = t + 0;
+  if (c > 2) t = t + c * 4; else s = s / c;
+  if (x > 32) s = s + x * 10 - t; else t = t + 2;
+  if (x > 33) s = s + x * 11 - t; else t = t + 3;
+  if (x > 34) s = s + x * 12 - t; else t = t + 4;
+  if (c > 0) t = t + c * 1; else s = s / c;
+  if (x > 36) s = s + x * 1 - t; else t = t + 1;
+  if (x > 37) s = s + x * 2 - t; else t = t + 2;
+  if (x > 38) s = s + x * 3 - t; else t = t + 3;
+  if (c > 1) t = t + c * 5; else s = s / c;
+  if (x > 40) s = s + x * 5 - t; else t = t + 0;
+  if (x > 41) s = s + x * 6 - t; else t = t + 1;
+  if (x > 42) s = s + x * 7 - t; else t = t + 2;
+  if (c > 2) t = t + c * 2; else s = s / c;
+  if (x > 44) s = s + x * 9 - t; else t = t + 4;
+  if (x > 45) s = s + x * 10 - t; else t = t + 0;
+  if (x > 46) s = s + x * 11 - t; else t = t + 1;
+  if (c > 0) t = t + c * 6; else s = s / c;
+  if (x > 48) s = s + x * 0 - t; else t = t + 3;
+  if (x > 49) s = s + x * 1 - t; else t = t + 4;
+  if (x > 0) s = s + x * 2 - t; else t = t + 0;
+  if (c > 1) t = t + c * 3; else s = s / c;
+  if (x > 2) s = s + x * 4 - t; else t = t + 2;
+  if (x > 3) s = s + x * 5 - t; else t = t + 3;
+  if (x > 4) s = s + x * 6 - t; else t = t + 4;
+  if (c > 2) t = t + c * 0; else s = s / c;
+  if (x > 6) s = s + x * 8 - t; else t = t + 1;
+  if (x > 7) s = s + x * 9 - t; else t = t + 2;
+  if (x > 8) s = s + x * 10 - t; else t = t + 3;
+  if (c > 0) t = t + c * 4; else s = s / c;
+  if (x > 10) s = s + x * 12 - t; else t = t + 0;
+  if (x > 11) s = s + x * 0 - t; else t = t + 1;
+  if (x > 12) s = s + x * 1 - t; else t = t + 2;
+  if (c > 1) t = t + c * 1; else s = s / c;
+  if (x > 14) s = s + x * 3 - t; else t = t + 4;
+  if (x > 15) s = s + x * 4 - t; else t = t + 0;
+  if (x > 16) s = s + x * 5 - t; else t = t + 1;
+  if (c > 2) t = t + c * 5; else s = s / c;
+  if (x > 18) s = s + x * 7 - t; else t = t + 3;
+  if (x > 19) s = s + x * 8 - t; else t = t + 4;
+  if (x > 20) s = s + x * 9 - t; else t = t + 0;
+  if (c > 0) t = t + c * 2; else s = s / c;
+  if (x > 22) s = s + x * 11 - t; else t = t + 2;
+  if (x > 23) s = s + x * 12 - t; else t = t + 3;
+  if (x > 24) s = s + x * 0 - t; else t = t + 4;
+  if (c > 1) t = t + c * 6; else s = s / c;
+  if (x > 26) s = s + x * 2 - t; else t = t + 1;
+  if (x > 27) s = s + x * 3 - t; else t = t + 2;
+  if (x > 28) s = s + x * 4 - t; else t = t + 3;
+  if (c > 2) t = t + c * 3; else s = s / c;
+  if (x > 30) s = s + x * 6 - t; else t = t + 0;
+  if (x > 31) s = s + x * 7 - t; else t = t + 1;
+  if (x > 32) s = s + x * 8 - t; else t = t + 2;
+  if (c > 0) t = t + c * 0; else s = s / c;
+  if (x > 34) s = s + x * 10 - t; else t = t + 4;
+  if (x > 35) s = s + x * 11 - t; else t = t + 0;
+  if (x > 36) s = s + x * 12 - t; else t = t + 1;
+  if (c > 1) t = t + c * 4; else s = s / c;
+  if (x > 38) s = s + x * 1 - t; else t = t + 3;
+  if (x > 39) s = s + x * 2 - t; else t = t + 4;
+  if (x > 40) s = s + x * 3 - t; else t = t + 0;
+  if (c > 2) t = t + c * 1; else s = s / c;
+  if (x > 42) s = s + x * 5 - t; else t = t + 2;
+  if (x > 43) s = s + x * 6 - t; else t = t + 3;
+  if (x > 44) s = s + x * 7 - t; else t = t + 4;
+  if (c > 0) t = t + c * 5; else s = s / c;
+  if (x > 46) s = s + x * 9 - t; else t = t + 1;
+  if (x > 47) s = s + x * 10 - t; else t = t + 2;
+  if (x > 48) s = s + x * 11 - t; else t = t + 3;
+  if (c > 1) t = t + c * 2; else s = s / c;
+  if (x > 0) s = s + x * 0 - t; else t = t + 0;
+  if (x > 1) s = s + x * 1 - t; else t = t + 1;
+  if (x > 2) s = s + x * 2 - t; else t = t + 2;
+  if (c > 2) t = t + c * 6; else s = s / c;
+  if (x > 4) s = s + x * 4 - t; else t = t + 4;
+  if (x > 5) s = s + x * 5 - t; else t = t + 0;
+  if (x > 6) s = s + x * 6 - t; else t = t + 1;
+  if (c > 0) t = t + c * 3; else s = s / c;
+  if (x > 8) s = s + x * 8 - t; else t = t + 3;
+  if (x > 9) s = s + x * 9 - t; else t = t + 4;
+  if (x > 10) s = s + x * 10 - t; else t = t + 0;
+  if (c > 1) t = t + c * 0; else s = s / c;
+  if (x > 12) s = s + x * 12 - t; else t = t + 2;
+  if (x > 13) s = s + x * 0 - t; else t = t + 3;
+  if (x > 14) s = s + x * 1 - t; else t = t + 4;
+  if (c > 2) t = t + c * 4; else s = s / c;
+  if (x > 16) s = s + x * 3 - t; else t = t + 1;
+  if (x > 17) s = s + x * 4 - t; else t = t + 2;
+  if (x > 18) s = s + x * 5 - t; else t = t + 3;
+  if (c > 0) t = t + c * 1; else s = s / c;
+  if (x > 20) s = s + x * 7 - t; else t = t + 0;
+  if (x > 21) s = s + x * 8 - t; else t = t + 1;
+  if (x > 22) s = s + x * 9 - t; else t = t + 2;
+  if (c > 1) t = t + c * 5; else s = s / c;
+  if (x > 24) s = s + x * 11 - t; else t = t + 4;
+  if (x > 25) s = s + x * 12 - t; else t = t + 0;
+  if (x > 26) s = s + x * 0 - t; else t = t + 1;
+  if (c > 2) t = t + c * 2; else s = s / c;
+  if (x > 28) s = s + x * 2 - t; else t = t + 3;
+  if (x > 29) s = s + x * 3 - t; else t = t + 4;
+  if (x > 30) s = s + x * 4 - t; else t = t + 0;
+  if (c > 0) t = t + c * 6; else s = s / c;
+  if (x > 32) s = s + x * 6 - t; else t = t + 2;
+  if (x > 33) s = s + x * 7 - t; else t = t + 3;
+  if (x > 34) s = s + x * 8 - t; else t = t + 4;
+  if (c > 1) t = t + c * 3; else s = s / c;
+  if (x > 36) s = s + x * 10 - t; else t = t + 1;
+  if (x > 37) s = s + x * 11 - t; else t = t + 2;
+  if (x > 38) s = s + x * 12 - t; else t = t + 3;
+  if (c > 2) t = t + c * 0; else s = s / c;
+  if (x > 40) s = s + x * 1 - t; else t = t + 0;
+  if (x > 41) s = s + x * 2 - t; else t = t + 1;
+  if (x > 42) s = s + x * 3 - t; else t = t + 2;
+  if (c > 0) t = t + c * 4; else s = s / c;
+  if (x > 44) s = s + x * 5 - t; else t = t + 4;
+  if (x > 45) s = s + x * 6 - t; else t = t + 0;
+  if (x > 46) s = s + x * 7 - t; else t = t + 1;
+  if (c > 1) t = t + c * 1; else s = s / c;
+  if (x > 48) s = s + x * 9 - t; else t = t + 3;
+  if (x > 49) s = s + x * 10 - t; else t = t + 4;
+  if (x > 0) s = s + x * 11 - t; else t = t + 0;
+  if (c > 2) t = t + c * 5; else s = s / c;
+  if (x > 2) s = s + x * 0 - t; else t = t + 2;
+  if (x > 3) s = s + x * 1 - t; else t = t + 3;
+  if (x > 4) s = s + x * 2 - t; else t = t + 4;
+  if (c > 0) t = t + c * 2; else s = s / c;
+  if (x > 6) s = s + x * 4 - t; else t = t + 1;
+  if (x > 7) s = s + x * 5 - t; else t = t + 2;
+  if (x > 8) s = s + x * 6 - t; else t = t + 3;
+  if (c > 1) t = t + c * 6; else s = s / c;
+  if (x > 10) s = s + x * 8 - t; else t = t + 0;
+  if (x > 11) s = s + x * 9 - t; else t = t + 1;
+  if (x > 12) s = s + x * 10 - t; else t = t + 2;
+  if (c > 2) t = t + c * 3; else s = s / c;
+  if (x > 14) s = s + x * 12 - t; else t = t + 4;
+  if (x > 15) s = s + x * 0 - t; else t = t + 0;
+  if (x > 16) s = s + x * 1 - t; else t = t + 1;
+  if (c > 0) t = t + c * 0; else s = s / c;
+  if (x > 18) s = s + x * 3 - t; else t = t + 3;
+  if (x > 19) s = s + x * 4 - t; else t = t + 4;
+  if (x > 20) s = s + x * 5 - t; else t = t + 0;
+  if (c > 1) t = t + c * 4; else s = s / c;
+  if (x > 22) s = s + x * 7 - t; else t = t + 2;
+  if (x > 23) s = s + x * 8 - t; else t = t + 3;
+  if (x > 24) s = s + x * 9 - t; else t = t + 4;
+  if (c > 2) t = t + c * 1; else s = s / c;
+  if (x > 26) s = s + x * 11 - t; else t = t + 1;
+  if (x > 27) s = s + x * 12 - t; else t = t + 2;
+  if (x > 28) s = s + x * 0 - t; else t = t + 3;
+  if (c > 0) t = t + c * 5; else s = s / c;
+  if (x > 30) s = s + x * 2 - t; else t = t + 0;
+  if (x > 31) s = s + x * 3 - t; else t = t + 1;
+  if (x > 32) s = s + x * 4 - t; else t = t + 2;
+  if (c > 1) t = t + c * 2; else s = s / c;
+  if (x > 34) s = s + x * 6 - t; else t = t + 4;
+  if (x > 35) s = s + x * 7 - t; else t = t + 0;
+  if (x > 36) s = s + x * 8 - t; else t = t + 1;
+  if (c > 2) t = t + c * 6; else s = s / c;
+  if (x > 38) s = s + x * 10 - t; else t = t + 3;
+  if (x > 39) s = s + x * 11 - t; else t = t + 4;
+  if (x > 40) s = s + x * 12 - t; else t = t + 0;
+  if (c > 0) t = t + c * 3; else s = s / c;
+  if (x > 42) s = s + x * 1 - t; else t = t + 2;
+  if (x > 43) s = s + x * 2 - t; else t = t + 3;
+  if (x > 44) s = s + x * 3 - t; else t = t + 4;
+  if (c > 1) t = t + c * 0; else s = s / c;
+  if (x > 46) s = s + x * 5 - t; else t = t + 1;
+  if (x > 47) s = s + x * 6 - t; else t = t + 2;
+  if (x > 48) s = s + x * 7 - t; else t = t + 3;
+  if (c > 2) t = t + c * 4; else s = s / c;
+  if (x > 0) s = s + x * 9 - t; else t = t + 0;
+  if (x > 1) s = s + x * 10 - t; else t = t + 1;
+  if (x > 2) s = s + x * 11 - t; else t = t + 2;
+  if (c > 0) t = t + c * 1; else s = s / c;
+  if (x > 4) s = s + x * 0 - t; else t = t + 4;
+  if (x > 5) s = s + x * 1 - t; else t = t + 0;
+  if (x > 6) s = s + x * 2 - t; else t = t + 1;
+  if (c > 1) t = t + c * 5; else s = s / c;
+  if (x > 8) s = s + x * 4 - t; else t = t + 3;
+  if (x > 9) s = s + x * 5 - t; else t = t + 4;
+  if (x > 10) s = s + x * 6 - t; else t = t + 0;
+  if (c > 2) t = t + c * 2; else s = s / c;
+  if (x > 12) s = s + x * 8 - t; else t = t + 2;
+  if (x > 13) s = s + x * 9 - t; else t = t + 3;
+  if (x > 14) s = s + x * 10 - t; else t = t + 4;
+  if (c > 0) t = t + c * 6; else s = s / c;
+  if (x > 16) s = s + x * 12 - t; else t = t + 1;
+  if (x > 17) s = s + x * 0 - t; else t = t + 2;
+  if (x > 18) s = s + x * 1 - t; else t = t + 3;
+  if (c > 1) t = t + c * 3; else s = s / c;
+  if (x > 20) s = s + x * 3 - t; else t = t + 0;
+  if (x > 21) s = s + x * 4 - t; else t = t + 1;
+  if (x > 22) s = s + x * 5 - t; else t = t + 2;
+  if (c > 2) t = t + c * 0; else s = s / c;
+  if (x > 24) s = s + x * 7 - t; else t = t + 4;
+  if (x > 25) s = s + x * 8 - t; else t = t + 0;
+  if (x > 26) s = s + x * 9 - t; else t = t + 1;
+  if (c > 0) t = t + c * 4; else s = s / c;
+  if (x > 28) s = s + x * 11 - t; else t = t + 3;
+  if (x > 29) s = s + x * 12 - t; else t = t + 4;
+  if (x > 30) s = s + x * 0 - t; else t = t + 0;
+  if (c > 1) t = t + c * 1; else s = s / c;
+  if (x > 32) s = s + x * 2 - t; else t = t + 2;
+  if (x > 33) s = s + x * 3 - t; else t = t + 3;
+  if (x > 34) s = s + x * 4 - t; else t = t + 4;
+  if (c > 2) t = t + c * 5; else s = s / c;
+  if (x > 36) s = s + x * 6 - t; else t = t + 1;
+  if (x > 37) s = s + x * 7 - t; else t = t + 2;
+  if (x > 38) s = s + x * 8 - t; else t = t + 3;
+  if (c > 0) t = t + c * 2; else s = s / c;
+  if (x > 40) s = s + x * 10 - t; else t = t + 0;
+  if (x > 41) s = s + x * 11 - t; else t = t + 1;
+  if (x > 42) s = s + x * 12 - t; else t = t + 2;
+  if (c > 1) t = t + c * 6; else s = s / c;
+  if (x > 44) s = s + x * 1 - t; else t = t + 4;
+  if (x > 45) s = s + x * 2 - t; else t = t + 0;
+  if (x > 46) s = s + x * 3 - t; else t = t + 1;
+  if (c > 2) t = t + c * 3; else s = s / c;
+  if (x > 48) s = s + x * 5 - t; else t = t + 3;
+  if (x > 49) s = s + x * 6 - t; else t = t + 4;
+  if (x > 0) s = s + x * 7 - t; else t = t + 0;
+  if (c > 0) t = t + c * 0; else s = s / c;
+  if (x > 2) s = s + x * 9 - t; else t = t + 2;
+  if (x > 3) s = s + x * 10 - t; else t = t + 3;
+  if (x > 4) s = s + x * 11 - t; else t = t + 4;
+  if (c > 1) t = t + c * 4; else s = s / c;
+  if (x > 6) s = s + x * 0 - t; else t = t + 1;
+  if (x > 7) s = s + x * 1 - t; else t = t + 2;
+  if (x > 8) s = s + x * 2 - t; else t = t + 3;
+  if (c > 2) t = t + c * 1; else s = s / c;
+  if (x > 10) s = s + x * 4 - t; else t = t + 0;
+  if (x > 11) s = s + x * 5 - t; else t = t + 1;
+  if (x > 12) s = s + x * 6 - t; else t = t + 2;
+  if (c > 0) t = t + c * 5; else s = s / c;
+  if (x > 14) s = s + x * 8 - t; else t = t + 4;
+  if (x > 15) s = s + x * 9 - t; else t = t + 0;
+  if (x > 16) s = s + x * 10 - t; else t = t + 1;
+  if (c > 1) t = t + c * 2; else s = s / c;
+  if (x > 18) s = s + x * 12 - t; else t = t + 3;
+  if (x > 19) s = s + x * 0 - t; else t = t + 4;
+  if (x > 20) s = s + x * 1 - t; else t = t + 0;
+  if (c > 2) t = t + c * 6; else s = s / c;
+  if (x > 22) s = s + x * 3 - t; else t = t + 2;
+  if (x > 23) s = s + x * 4 - t; else t = t + 3;
+  if (x > 24) s = s + x * 5 - t; else t = t + 4;
+  if (c > 0) t = t + c * 3; else s = s / c;
+  if (x > 26) s = s + x * 7 - t; else t = t + 1;
+  if (x > 27) s = s + x * 8 - t; else t = t + 2;
+  if (x > 28) s = s + x * 9 - t; else t = t + 3;
+  if (c > 1) t = t + c * 0; else s = s / c;
+  if (x > 30) s = s + x * 11 - t; else t = t + 0;
+  if (x > 31) s = s + x * 12 - t; else t = t + 1;
+  if (x > 32) s = s + x * 0 - t; else t = t + 2;
+  if (c > 2) t = t + c * 4; else s = s / c;
+  if (x > 34) s = s + x * 2 - t; else t = t + 4;
+  if (x > 35) s = s + x * 3 - t; else t = t + 0;
+  if (x > 36) s = s + x * 4 - t; else t = t + 1;
+  if (c > 0) t = t + c * 1; else s = s / c;
+  if (x > 38) s = s + x * 6 - t; else t = t + 3;
+  if (x > 39) s = s + x * 7 - t; else t = t + 4;
+  if (x > 40) s = s + x * 8 - t; else t = t + 0;
+  if (c > 1) t = t + c * 5; else s = s / c;
+  if (x > 42) s = s + x * 10 - t; else t = t + 2;
+  if (x > 43) s = s + x * 11 - t; else t = t + 3;
+  if (x > 44) s = s + x * 12 - t; else t = t + 4;
+  if (c > 2) t = t + c * 2; else s = s / c;
+  if (x > 46) s = s + x * 1 - t; else t = t + 1;
+  if (x > 47) s = s + x * 2 - t; else t = t + 2;
+  if (x > 48) s = s + x * 3 - t; else t = t + 3;
+  if (c > 0) t = t + c * 6; else s = s / c;
+  if (x > 0) s = s + x * 5 - t; else t = t + 0;
+  if (x > 1) s = s + x * 6 - t; else t = t + 1;
+  if (x > 2) s = s + x * 7 - t; else t = t + 2;
+  if (c > 1) t = t + c * 3; else s = s / c;
+  if (x > 4) s = s + x * 9 - t; else t = t + 4;
+  if (x > 5) s = s + x * 10 - t; else t = t + 0;
+  if (x > 6) s = s + x * 11 - t; else t = t + 1;
+  if (c > 2) t = t + c * 0; else s = s / c;
+  if (x > 8) s = s + x * 0 - t; else t = t + 3;
+  if (x > 9) s = s + x * 1 - t; else t = t + 4;
+  if (x > 10) s = s + x * 2 - t; else t = t + 0;
+  if (c > 0) t = t + c * 4; else s = s / c;
+  if (x > 12) s = s + x * 4 - t; else t = t + 2;
+  if (x > 13) s = s + x * 5 - t; else t = t + 3;
+  if (x > 14) s = s + x * 6 - t; else t = t + 4;
+  if (c > 1) t = t + c * 1; else s = s / c;
+  if (x > 16) s = s + x * 8 - t; else t = t + 1;
+  if (x > 17) s = s + x * 9 - t; else t = t + 2;
+  if (x > 18) s = s + x * 10 - t; else t = t + 3;
+  if (c > 2) t = t + c * 5; else s = s / c;
+  if (x > 20) s = s + x * 12 - t; else t = t + 0;
+  if (x > 21) s = s + x * 0 - t; else t = t + 1;
+  if (x > 22) s = s + x * 1 - t; else t = t + 2;
+  if (c > 0) t = t + c * 2; else s = s / c;
+  if (x > 24) s = s + x * 3 - t; else t = t + 4;
+  if (x > 25) s = s + x * 4 - t; else t = t + 0;
+  if (x > 26) s = s + x * 5 - t; else t = t + 1;
+  if (c > 1) t = t + c * 6; else s = s / c;
+  if (x > 28) s = s + x * 7 - t; else t = t + 3;
+  if (x > 29) s = s + x * 8 - t; else t = t + 4;
+  if (x > 30) s = s + x * 9 - t; else t = t + 0;
+  if (c > 2) t = t + c * 3; else s = s / c;
+  if (x > 32) s = s + x * 11 - t; else t = t + 2;
+  if (x > 33) s = s + x * 12 - t; else t = t + 3;
+  if (x > 34) s = s + x * 0 - t; else t = t + 4;
+  if (c > 0) t = t + c * 0; else s = s / c;
+  if (x > 36) s = s + x * 2 - t; else t = t + 1;
+  if (x > 37) s = s + x * 3 - t; else t = t + 2;
+  if (x > 38) s = s + x * 4 - t; else t = t + 3;
+  if (c > 1) t = t + c * 4; else s = s / c;
+  if (x > 40) s = s + x * 6 - t; else t = t + 0;
+  if (x > 41) s = s + x * 7 - t; else t = t + 1;
+  if (x > 42) s = s + x * 8 - t; else t = t + 2;
+  if (c > 2) t = t + c * 1; else s = s / c;
+  if (x > 44) s = s + x * 10 - t; else t = t + 4;
+  if (x > 45) s = s + x * 11 - t; else t = t + 0;
+  if (x > 46) s = s + x * 12 - t; else t = t + 1;
+  if (c > 0) t = t + c * 5; else s = s / c;
+  if (x > 48) s = s + x * 1 - t; else t = t + 3;
+  if (x > 49) s = s + x * 2 - t; else t = t + 4;
+  if (x > 0) s = s + x * 3 - t; else t = t + 0;
+  if (c > 1) t = t + c * 2; else s = s / c;
+  if (x > 2) s = s + x * 5 - t; else t = t + 2;
+  if (x > 3) s = s + x * 6 - t; else t = t + 3;
+  if (x > 4) s = s + x * 7 - t; else t = t + 4;
+  if (c > 2) t = t + c * 6; else s = s / c;
+  if (x > 6) s = s + x * 9 - t; else t = t + 1;
+  if (x > 7) s = s + x * 10 - t; else t = t + 2;
+  if (x > 8) s = s + x * 11 - t; else t = t + 3;
+  if (c > 0) t = t + c * 3; else s = s / c;
+  if (x > 10) s = s + x * 0 - t; else t = t + 0;
+  if (x > 11) s = s + x * 1 - t; else t = t + 1;
+  if (x > 12) s = s + x * 2 - t; else t = t + 2;
+  if (c > 1) t = t + c * 0; else s = s / c;
+  if (x > 14) s = s + x * 4 - t; else t = t + 4;
+  if (x > 15) s = s + x * 5 - t; else t = t + 0;
+  if (x > 16) s = s + x * 6 - t; else t = t + 1;
+  if (c > 2) t = t + c * 4; else s = s / c;
+  if (x > 18) s = s + x * 8 - t; else t = t + 3;
+  if (x > 19) s = s + x * 9 - t; else t = t + 4;
+  if (x > 20) s = s + x * 10 - t; else t = t + 0;
+  if (c > 0) t = t + c * 1; else s = s / c;
+  if (x > 22) s = s + x * 12 - t; else t = t + 2;
+  if (x > 23) s = s + x * 0 - t; else t = t + 3;
+  if (x > 24) s = s + x * 1 - t; else t = t + 4;
+  if (c > 1) t = t + c * 5; else s = s / c;
+  if (x > 26) s = s + x * 3 - t; else t = t + 1;
+  if (x > 27) s = s + x * 4 - t; else t = t + 2;
+  if (x > 28) s = s + x * 5 - t; else t = t + 3;
+  if (c > 2) t = t + c * 2; else s = s / c;
+  if (x > 30) s = s + x * 7 - t; else t = t + 0;
+  if (x > 31) s = s + x * 8 - t; else t = t + 1;
+  if (x > 32) s = s + x * 9 - t; else t = t + 2;
+  if (c > 0) t = t + c * 6; else s = s / c;
+  if (x > 34) s = s + x * 11 - t; else t = t + 4;
+  if (x > 35) s = s + x * 12 - t; else t = t + 0;
+  if (x > 36) s = s + x * 0 - t; else t = t + 1;
+  if (c > 1) t = t + c * 3; else s = s / c;
+  if (x > 38) s = s + x * 2 - t; else t = t + 3;
+  if (x > 39) s = s + x * 3 - t; else t = t + 4;
+  if (x > 40) s = s + x * 4 - t; else t = t + 0;
+  if (c > 2) t = t + c * 0; else s = s / c;
+  if (x > 42) s = s + x * 6 - t; else t = t + 2;
+  if (x > 43) s = s + x * 7 - t; else t = t + 3;
+  if (x > 44) s = s + x * 8 - t; else t = t + 4;
+  if (c > 0) t = t + c * 4; else s = s / c;
+  if (x > 46) s = s + x * 10 - t; else t = t + 1;
+  if (x > 47) s = s + x * 11 - t; else t = t + 2;
+  if (x > 48) s = s + x * 12 - t; else t = t + 3;
+  if (c > 1) t = t + c * 1; else s = s / c;
+  if (x > 0) s = s + x * 1 - t; else t = t + 0;
+  if (x > 1) s = s + x * 2 - t; else t = t + 1;
+  if (x > 2) s = s + x * 3 - t; else t = t + 2;
+  if (c > 2) t = t + c * 5; else s = s / c;
+  if (x > 4) s = s + x * 5 - t; else t = t + 4;
+  if (x > 5) s = s + x * 6 - t; else t = t + 0;
+  if (x > 6) s = s + x * 7 - t; else t = t + 1;
+  if (c > 0) t = t + c * 2; else s = s / c;
+  if (x > 8) s = s + x * 9 - t; else t = t + 3;
+  if (x > 9) s = s + x * 10 - t; else t = t + 4;
+  if (x > 10) s = s + x * 11 - t; else t = t + 0;
+  if (c > 1) t = t + c * 6; else s = s / c;
+  if (x > 12) s = s + x * 0 - t; else t = t + 2;
+  if (x > 13) s = s + x * 1 - t; else t = t + 3;
+  if (x > 14) s = s + x * 2 - t; else t = t + 4;
+  if (c > 2) t = t + c * 3; else s = s / c;
+  if (x > 16) s = s + x * 4 - t; else t = t + 1;
+  if (x > 17) s = s + x * 5 - t; else t = t + 2;
+  if (x > 18) s = s + x * 6 - t; else t = t + 3;
+  if (c > 0) t = t + c * 0; else s = s / c;
+  if (x > 20) s = s + x * 8 - t; else t = t + 0;
+  if (x > 21) s = s + x * 9 - t; else t = t + 1;
+  if (x > 22) s = s + x * 10 - t; else t = t + 2;
+  if (c > 1) t = t + c * 4; else s = s / c;
+  if (x > 24) s = s + x * 12 - t; else t = t + 4;
+  if (x > 25) s = s + x * 0 - t; else t = t + 0;
+  if (x > 26) s = s + x * 1 - t; else t = t + 1;
+  if (c > 2) t = t + c * 1; else s = s / c;
+  if (x > 28) s = s + x * 3 - t; else t = t + 3;
+  if (x > 29) s = s + x * 4 - t; else t = t + 4;
+  if (x > 30) s = s + x * 5 - t; else t = t + 0;
+  if (c > 0) t = t + c * 5; else s = s / c;
+  if (x > 32) s = s + x * 7 - t; else t = t + 2;
+  if (x > 33) s = s + x * 8 - t; else t = t + 3;
+  if (x > 34) s = s + x * 9 - t; else t = t + 4;
+  if (c > 1) t = t + c * 2; else s = s / c;
+  if (x > 36) s = s + x * 11 - t; else t = t + 1;
+  if (x > 37) s = s + x * 12 - t; else t = t + 2;
+  if (x > 38) s = s + x * 0 - t; else t = t + 3;
+  if (c > 2) t = t + c * 6; else s = s / c;
+  if (x > 40) s = s + x * 2 - t; else t = t + 0;
+  if (x > 41) s = s + x * 3 - t; else t = t + 1;
+  if (x > 42) s = s + x * 4 - t; else t = t + 2;
+  if (c > 0) t = t + c * 3; else s = s / c;
+  if (x > 44) s = s + x * 6 - t; else t = t + 4;
+  if (x > 45) s = s + x * 7 - t; else t = t + 0;
+  if (x > 46) s = s + x * 8 - t; else t = t + 1;
+  if (c > 1) t = t + c * 0; else s = s / c;
+  if (x > 48) s = s + x * 10 - t; else t = t + 3;
+  if (x > 49) s = s + x * 11 - t; else t = t + 4;
+  if (x > 0) s = s + x * 12 - t; else t = t + 0;
+  if (c > 2) t = t + c * 4; else s = s / c;
+  if (x > 2) s = s + x * 1 - t; else t = t + 2;
+  if (x > 3) s = s + x * 2 - t; else t = t + 3;
+  if (x > 4) s = s + x * 3 - t; else t = t + 4;
+  if (c > 0) t = t + c * 1; else s = s / c;
+  if (x > 6) s = s + x * 5 - t; else t = t + 1;
+  if (x > 7) s = s + x * 6 - t; else t = t + 2;
+  if (x > 8) s = s + x * 7 - t; else t = t + 3;
+  if (c > 1) t = t + c * 5; else s = s / c;
+  if (x > 10) s = s + x * 9 - t; else t = t + 0;
+  if (x > 11) s = s + x * 10 - t; else t = t + 1;
+  if (x > 12) s = s + x * 11 - t; else t = t + 2;
+  if (c > 2) t = t + c * 2; else s = s / c;
+  if (x > 14) s = s + x * 0 - t; else t = t + 4;
+  if (x > 15) s = s + x * 1 - t; else t = t + 0;
+  if (x > 16) s = s + x * 2 - t; else t = t + 1;
+  if (c > 0) t = t + c * 6; else s = s / c;
+  if (x > 18) s = s + x * 4 - t; else t = t + 3;
+  if (x > 19) s = s + x * 5 - t; else t = t + 4;
+  if (x > 20) s = s + x * 6 - t; else t = t + 0;
+  if (c > 1) t = t + c * 3; else s = s / c;
+  if (x > 22) s = s + x * 8 - t; else t = t + 2;
+  if (x > 23) s = s + x * 9 - t; else t = t + 3;
+  if (x > 24) s = s + x * 10 - t; else t = t + 4;
+  if (c > 2) t = t + c * 0; else s = s / c;
+  if (x > 26) s = s + x * 12 - t; else t = t + 1;
+  if (x > 27) s = s + x * 0 - t; else t = t + 2;
+  if (x > 28) s = s + x * 1 - t; else t = t + 3;
+  if (c > 0) t = t + c * 4; else s = s / c;
+  if (x > 30) s = s + x * 3 - t; else t = t + 0;
+  if (x > 31) s = s + x * 4 - t; else t = t + 1;
+  if (x > 32) s = s + x * 5 - t; else t = t + 2;
+  if (c > 1) t = t + c * 1; else s = s / c;
+  if (x > 34) s = s + x * 7 - t; else t = t + 4;
+  if (x > 35) s = s + x * 8 - t; else t = t + 0;
+  if (x > 36) s = s + x * 9 - t; else t = t + 1;
+  if (c > 2) t = t + c * 5; else s = s / c;
+  if (x > 38) s = s + x * 11 - t; else t = t + 3;
+  if (x > 39) s = s + x * 12 - t; else t = t + 4;
+  if (x > 40) s = s + x * 0 - t; else t = t + 0;
+  if (c > 0) t = t + c * 2; else s = s / c;
+  if (x > 42) s = s + x * 2 - t; else t = t + 2;
+  if (x > 43) s = s + x * 3 - t; else t = t + 3;
+  if (x > 44) s = s + x * 4 - t; else t = t + 4;
+  if (c > 1) t = t + c * 6; else s = s / c;
+  if (x > 46) s = s + x * 6 - t; else t = t + 1;
+  if (x > 47) s = s + x * 7 - t; else t = t + 2;
+  if (x > 48) s = s + x * 8 - t; else t = t + 3;
+  if (c > 2) t = t + c * 3; else s = s / c;
+  printf(s);
+  printf(t);
+  return s % 1000;
+}
+int main() {
+  f(20);
+  return f(40);
+}
@@ -0,0 +1,26 @@
+int main() {
+  int y;
+  {
+    int x;
+    x = 7;
+    printf(x);
+  }
+  {
+    float x;
+    x = 2.5;
+    printf(x);
+  }
+  {
+    int buf[2];
+    buf[1] = 3;
+    y = buf[1];
+    printf(y);
+  }
+  {
+    int buf[6];
+    buf[4] = 9;
+    y = buf[4];
+    printf(y);
+  }
+  return y;
+}
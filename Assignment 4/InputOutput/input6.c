@@ -0,0 +1,13 @@
+int main() {
+  int i;
+  float fb, fc;
+  fc = 1.5;
+  fb = -(fc == 7);
+  for (i = 0; i < 4; i++) {
+    fb = -(-(fb * -3));
+  }
+  printf(fb);
+  fb = fb * -1;
+  printf(fb);
+  return i;
+}
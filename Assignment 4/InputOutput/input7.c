@@ -0,0 +1,24 @@
+int f(int x) {
+  int a, b, c, d, e, g;
+  a = x / 4;
+  b = x % 16;
+  c = x / 7;
+  d = x % 10;
+  e = x / 3 + x % 3;
+  g = x / 641 - x % 1000;
+  printf(a);
+  printf(b);
+  printf(c);
+  printf(d);
+  printf(e);
+  printf(g);
+  return a + c;
+}
+int main() {
+  int s;
+  s = f(-37);
+  s = s + f(37);
+  s = s + f(2147483647);
+  s = s + f(-2147483647);
+  return s;
+}
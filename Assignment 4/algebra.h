@@ -0,0 +1,245 @@
+#ifndef ALGEBRA_H
+#define ALGEBRA_H
+
+#include <cstdint>
+#include <vector>
+
+#include "ir.h"
+
+using namespace std;
+
+// Algebraic simplification of single instructions. Identities (x + 0, x * 1, x - x,
+// x * 0, x % 1, ...) become copies, negations or constants when that keeps the
+// result's type. When lowering, int multiplication by a power of two becomes a
+// shift. Int division and remainder by a positive constant can become shifts and
+// masks (powers of two) or a multiply-high sequence (Granlund and Montgomery, as in
+// Hacker's Delight), all rounding towards zero like the division they replace, but
+// only where the target's division_cost is above the length of that sequence.
+//
+// Lowering runs after strength reduction, which looks for the multiplications.
+
+class algebraic_simplifier
+{
+private:
+    tac_program& prog;
+    tac_values values;
+    vector<tac_instr> result;
+
+    bool int_constant(const tac_operand& opnd, long long& v) const {
+        if (opnd.kind != OPND_CONST || prog.constants[opnd.id].type != TYPE_INT) return false;
+        v = prog.constants[opnd.id].int_value;
+        return true;
+    }
+
+    bool is_constant(const tac_operand& opnd, long long v) const {
+        long long c;
+        if (opnd.kind != OPND_CONST) return false;
+        if (int_constant(opnd, c)) return c == v;
+        return prog.constants[opnd.id].float_value == (double)v;
+    }
+
+    bool is_int(const tac_operand& opnd) const {
+        return values.type_of(opnd) == TYPE_INT;
+    }
+
+    static int log2_of(long long v) {
+        if (v <= 0 || (v & (v - 1)) != 0) return -1;
+        return __builtin_ctzll(v);
+    }
+
+    tac_operand new_temp() {
+        return tac_operand(OPND_TEMP, prog.num_temps++);
+    }
+
+    void emit(tac_opcode op, const tac_operand& dst, const tac_operand& a, const tac_operand& b = tac_operand()) {
+        result.push_back(tac_instr{op, dst, a, b});
+    }
+
+    // Rewrites an identity in place; true if in was one
+    bool simplify(tac_instr& in) {
+        // Replacing with an operand must not change the type a temporary gets
+        data_type type = values.result_type(in);
+        bool both_int = is_int(in.src1) && is_int(in.src2);
+        tac_operand x;
+        switch (in.op) {
+            case OP_ADD:
+                // Not for floats: -0.0 + 0 is +0.0
+                if (both_int && is_constant(in.src2, 0)) x = in.src1;
+                else if (both_int && is_constant(in.src1, 0)) x = in.src2;
+                break;
+            case OP_SUB:
+                if (is_constant(in.src2, 0)) x = in.src1;
+                else if (both_int && in.src1 == in.src2) {
+                    in = tac_instr{OP_COPY, in.dst, prog.int_constant(0), tac_operand()};
+                    return true;
+                }
+                break;
+            case OP_MUL:
+                if (is_constant(in.src2, 1)) x = in.src1;
+                else if (is_constant(in.src1, 1)) x = in.src2;
+                else if (both_int && (is_constant(in.src1, 0) || is_constant(in.src2, 0))) {
+                    in = tac_instr{OP_COPY, in.dst, prog.int_constant(0), tac_operand()};
+                    return true;
+                } else if (both_int && is_constant(in.src2, -1)) {
+                    in = tac_instr{OP_NEG, in.dst, in.src1, tac_operand()};
+                    return true;
+                }
+                break;
+            case OP_DIV:
+                if (is_constant(in.src2, 1)) x = in.src1;
+                else if (both_int && is_constant(in.src2, -1)) {
+                    in = tac_instr{OP_NEG, in.dst, in.src1, tac_operand()};
+                    return true;
+                }
+                break;
+            case OP_MOD:
+                if (both_int && (is_constant(in.src2, 1) || is_constant(in.src2, -1))) {
+                    in = tac_instr{OP_COPY, in.dst, prog.int_constant(0), tac_operand()};
+                    return true;
+                }
+                break;
+            default:
+                break;
+        }
+        if (x.is_none() || type == TYPE_NONE || values.type_of(x) != type) return false;
+        in = tac_instr{OP_COPY, in.dst, x, tac_operand()};
+        return true;
+    }
+
+    // x / 2^k rounding towards zero: add 2^k - 1 to negative x before shifting
+    tac_operand emit_biased(const tac_operand& x, int k) {
+        tac_operand sign = new_temp(), bias = new_temp(), sum = new_temp();
+        emit(OP_SHR, sign, x, prog.int_constant(31));
+        emit(OP_BITAND, bias, sign, prog.int_constant((1LL << k) - 1));
+        emit(OP_ADD, sum, x, bias);
+        return sum;
+    }
+
+    // Magic multiplier and shift for signed division by d >= 2 (Hacker's Delight 10-1)
+    static void magic(uint32_t d, int32_t& multiplier, int& shift) {
+        const uint32_t two31 = 0x80000000u;
+        uint32_t anc = two31 - 1 - two31 % d;
+        uint32_t q1 = two31 / anc, r1 = two31 - q1 * anc;
+        uint32_t q2 = two31 / d, r2 = two31 - q2 * d;
+        uint32_t delta;
+        int p = 31;
+        do {
+            p++;
+            q1 *= 2; r1 *= 2;
+            if (r1 >= anc) { q1++; r1 -= anc; }
+            q2 *= 2; r2 *= 2;
+            if (r2 >= d) { q2++; r2 -= d; }
+            delta = d - r2;
+        } while (q1 < delta || (q1 == delta && r1 == 0));
+        multiplier = (int32_t)(q2 + 1);
+        shift = p - 32;
+    }
+
+    // Instructions emit_quotient writes for d
+    static size_t quotient_length(uint32_t d) {
+        int32_t multiplier;
+        int shift;
+        magic(d, multiplier, shift);
+        return 3 + (multiplier < 0) + (shift > 0);
+    }
+
+    // Quotient of x / d for a constant d >= 3 that is no power of two
+    tac_operand emit_quotient(const tac_operand& x, uint32_t d, const tac_operand& dst) {
+        int32_t multiplier;
+        int shift;
+        magic(d, multiplier, shift);
+        tac_operand q = new_temp();
+        emit(OP_MULHI, q, x, prog.int_constant(multiplier));
+        if (multiplier < 0) {
+            tac_operand sum = new_temp();
+            emit(OP_ADD, sum, q, x);
+            q = sum;
+        }
+        if (shift > 0) {
+            tac_operand shifted = new_temp();
+            emit(OP_SHR, shifted, q, prog.int_constant(shift));
+            q = shifted;
+        }
+        // Add one for negative x, so the quotient rounds towards zero
+        tac_operand sign = new_temp();
+        emit(OP_SHR, sign, x, prog.int_constant(31));
+        emit(OP_SUB, dst, q, sign);
+        return dst;
+    }
+
+    // Appends the lowered form of in; false if it stays as it is
+    bool lower(const tac_instr& in) {
+        if (in.op != OP_MUL && in.op != OP_DIV && in.op != OP_MOD) return false;
+        if (!is_int(in.src1) || !is_int(in.src2)) return false;
+        long long c;
+        if (in.op == OP_MUL) {
+            tac_operand x = in.src1;
+            if (!int_constant(in.src2, c)) {
+                if (!int_constant(in.src1, c)) return false;
+                x = in.src2;
+            }
+            int k = log2_of(c);
+            if (k < 1 || k > 30) return false;
+            emit(OP_SHL, in.dst, x, prog.int_constant(k));
+            shifts++;
+            return true;
+        }
+
+        const tac_operand& x = in.src1;
+        if (!int_constant(in.src2, c) || c < 2 || c > INT32_MAX || x.kind == OPND_CONST) return false;
+        int k = log2_of(c);
+        size_t length = k > 0 ? 4 : quotient_length((uint32_t)c);
+        if (in.op == OP_MOD) length += k > 0 ? 1 : 2;
+        if (length >= division_cost) return false;
+        if (k > 0) {
+            tac_operand sum = emit_biased(x, k);
+            if (in.op == OP_DIV) {
+                emit(OP_SHR, in.dst, sum, prog.int_constant(k));
+            } else {
+                // x % 2^k = x - (x rounded towards zero to a multiple of 2^k)
+                tac_operand rounded = new_temp();
+                emit(OP_BITAND, rounded, sum, prog.int_constant(-(1LL << k)));
+                emit(OP_SUB, in.dst, x, rounded);
+            }
+            shifts++;
+            return true;
+        }
+
+        if (in.op == OP_DIV) {
+            emit_quotient(x, (uint32_t)c, in.dst);
+        } else {
+            tac_operand q = emit_quotient(x, (uint32_t)c, new_temp()), product = new_temp();
+            emit(OP_MUL, product, q, in.src2);
+            emit(OP_SUB, in.dst, x, product);
+        }
+        divisions++;
+        return true;
+    }
+
+public:
+    size_t identities = 0;      // instructions reduced to a copy, negation or constant
+    size_t shifts = 0;          // multiplications, divisions and remainders by powers of two
+    size_t divisions = 0;       // divisions and remainders turned into multiply-high
+
+    // Cost of an int division or remainder on the target, counted in simple
+    // instructions (--division-cost). tac_vm dispatches a division like any other
+    // instruction, so by default no sequence replacing one is cheaper
+    size_t division_cost = 1;
+
+    algebraic_simplifier(tac_program& prog) : prog(prog), values(prog) {}
+
+    // lower_arithmetic also rewrites multiplication, division and remainder by constants
+    void run(tac_function& func, bool lower_arithmetic) {
+        identities = shifts = divisions = 0;
+        values.build(func);
+        result.clear();
+        for (tac_instr in : func.code) {
+            if (in.op <= OP_MOD && simplify(in)) identities++;
+            if (lower_arithmetic && lower(in)) continue;
+            result.push_back(in);
+        }
+        if (identities + shifts + divisions > 0) func.code.swap(result);
+    }
+};
+
+#endif // ALGEBRA_H
@@ -0,0 +1,102 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+// Bump allocator for one compilation. Semantic values, symbol table entries and AST
+// nodes are carved out of large blocks instead of being allocated one by one, and
+// are all released together by release(). Objects with non-trivial destructors are
+// destroyed there, newest first.
+
+class arena
+{
+private:
+    static const size_t block_size = 64 * 1024;
+
+    struct dtor_entry
+    {
+        void (*destroy)(void*);
+        void* obj;
+    };
+
+    vector<char*> blocks;
+    vector<dtor_entry> dtors;
+    char* curr = NULL;
+    size_t left = 0;
+
+    template<typename T>
+    static void destroy(void* obj)
+    {
+        static_cast<T*>(obj)->~T();
+    }
+
+    void new_block(size_t min_size)
+    {
+        size_t size = min_size > block_size ? min_size : block_size;
+        curr = (char*)malloc(size);
+        if(curr == NULL) throw bad_alloc();
+        blocks.push_back(curr);
+        left = size;
+    }
+
+public:
+    arena() {}
+    arena(const arena&) = delete;
+    arena& operator=(const arena&) = delete;
+
+    void* allocate(size_t size, size_t align)
+    {
+        size_t pad = (align - (uintptr_t)curr % align) % align;
+        if(curr == NULL || pad + size > left)
+        {
+            new_block(size + align);
+            pad = (align - (uintptr_t)curr % align) % align;
+        }
+        void* ptr = curr + pad;
+        curr += pad + size;
+        left -= pad + size;
+        return ptr;
+    }
+
+    template<typename T, typename... Args>
+    T* make(Args&&... args)
+    {
+        T* obj = new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+        if(!is_trivially_destructible<T>::value)
+        {
+            dtors.push_back({&arena::destroy<T>, obj});
+        }
+        return obj;
+    }
+
+    void release()
+    {
+        for(size_t i = dtors.size(); i > 0; i--)
+        {
+            dtors[i-1].destroy(dtors[i-1].obj);
+        }
+        dtors.clear();
+        for(size_t i = 0; i < blocks.size(); i++)
+        {
+            free(blocks[i]);
+        }
+        blocks.clear();
+        curr = NULL;
+        left = 0;
+    }
+
+    ~arena()
+    {
+        release();
+    }
+};
+
+#endif // ARENA_H
@@ -4,65 +4,132 @@
 #include <iostream>
 #include <vector>
 #include <string>
-#include <fstream>
-#include <map>
+
+#include "ir.h"
+#include "name_table.h"
+#include "types.h"
 
 using namespace std;
 
+// All nodes are allocated from the compilation arena (arena.h), which owns them;
+// a node never deletes its children.
+
 class ASTNode {
 public:
     virtual ~ASTNode() {}
-    virtual string generate_code(ofstream& outcode, map<string, string>& symbol_to_temp, int& temp_count, int& label_count) const = 0;
+    // Appends the three-address code of the node; expressions return the operand
+    // holding their value
+    virtual tac_operand generate_code(tac_builder& out) const = 0;
+    // Appends the source text of the node in the form used by the parser log
+    virtual void print_source(string& out) const = 0;
 };
 
+// Renders a node into a reused buffer and writes it with a single call
+inline ostream& operator<<(ostream& out, const ASTNode& node) {
+    static string buffer;
+    buffer.clear();
+    node.print_source(buffer);
+    return out.write(buffer.data(), buffer.size());
+}
+
 // Expression node base types
 
 class ExprNode : public ASTNode {
 protected:
-    string node_type; // Type information (int, float, void, etc.)
+    data_type node_type; // Type information (int, float, void, etc.)
+    int paren_count; // Number of parentheses written around the expression
 public:
-    ExprNode(string type) : node_type(type) {}
-    virtual string get_type() const { return node_type; }
+    ExprNode(data_type type) : node_type(type), paren_count(0) {}
+    virtual data_type get_type() const { return node_type; }
+    
+    void add_parens() { paren_count++; }
+    int get_parens() const { return paren_count; }
+    
+    // Appends code that jumps to true_label if the expression is nonzero and to
+    // false_label otherwise. One of the labels may be none: that outcome falls
+    // through to the code that follows
+    virtual void generate_cond(tac_builder& out, tac_operand true_label, tac_operand false_label) const {
+        tac_operand value = generate_code(out);
+        emit_branch(out, OP_COPY, value, tac_operand(), true_label, false_label);
+    }
+    
+    // Branches on a relation of a and b (OP_COPY tests a alone), with a single
+    // inverted branch when the true outcome falls through
+    static void emit_branch(tac_builder& out, tac_opcode relation, tac_operand a, tac_operand b,
+                            tac_operand true_label, tac_operand false_label) {
+        if (true_label.is_none()) {
+            out.emit(make_branch(false, relation), false_label, a, b);
+            return;
+        }
+        out.emit(make_branch(true, relation), true_label, a, b);
+        if (!false_label.is_none()) out.emit(OP_GOTO, tac_operand(), false_label);
+    }
+    
+    // Whether evaluating the expression can change anything (assignments, calls)
+    virtual bool has_side_effects() const { return false; }
+    
+    // Whether evaluating the expression can stop the program (division by zero, an
+    // index out of bounds)
+    virtual bool can_fault() const { return false; }
+    
+    void print_source(string& out) const override {
+        out.append(paren_count, '(');
+        print_expr(out);
+        out.append(paren_count, ')');
+    }
+    
+    virtual void print_expr(string& out) const = 0;
 };
 
 // Variable node (for identifier references)
 
 class VarNode : public ExprNode {
 private:
-    string name;
+    uint32_t name; // interned identifier
     ExprNode* index; // For array indexing, nullptr for simple variables
 
 public:
-    VarNode(string name, string type, ExprNode* idx = nullptr)
+    VarNode(uint32_t name, data_type type, ExprNode* idx = nullptr)
         : ExprNode(type), name(name), index(idx) {}
     
-    ~VarNode() { if(index) delete index; }
-    
     bool has_index() const { return index != nullptr; }
     
-    string generate_index_code(ofstream& outcode, map<string, string>& symbol_to_temp,
-                              int& temp_count, int& label_count) const {
-        if (!index) return "";
+    tac_operand generate_index_code(tac_builder& out) const {
+        if (!index) return tac_operand();
         
-        string idx_result = index->generate_code(outcode, symbol_to_temp, temp_count, label_count);
-        return idx_result;
+        return index->generate_code(out);
     }
     
-    string generate_code(ofstream& outcode, map<string, string>& symbol_to_temp,
-                        int& temp_count, int& label_count) const override {
+    tac_operand generate_code(tac_builder& out) const override {
         if (has_index()) {
             // Array element access: arr[idx]
-            string idx_str = index->generate_code(outcode, symbol_to_temp, temp_count, label_count);
-            string temp_var = "t" + to_string(temp_count++);
-            outcode << temp_var << " = " << name << "[" << idx_str << "]" << endl;
+            tac_operand idx = index->generate_code(out);
+            tac_operand temp_var = out.new_temp();
+            out.emit(OP_LOAD, temp_var, get_operand(out), idx);
             return temp_var;
         } else {
-            // Simple variable reference - just return the name
-            return name;
+            // Simple variable reference - the variable itself
+            return get_operand(out);
+        }
+    }
+    
+    tac_operand get_operand(const tac_builder& out) const { return out.variable(name); }
+    
+    bool has_side_effects() const override { return index && index->has_side_effects(); }
+    
+    bool can_fault() const override { return index != nullptr; }
+    
+    void print_expr(string& out) const override {
+        out += names.get_name(name);
+        if (index) {
+            out += "[";
+            index->print_source(out);
+            out += "]";
         }
     }
     
-    string get_name() const { return name; }
+    const string& get_name() const { return names.get_name(name); }
+    uint32_t get_name_id() const { return name; }
 };
 
 // Constant value node
@@ -72,13 +139,18 @@ private:
     string value;
 
 public:
-    ConstNode(string val, string type) : ExprNode(type), value(val) {}
+    ConstNode(string val, data_type type) : ExprNode(type), value(val) {}
     
-    string generate_code(ofstream& outcode, map<string, string>& symbol_to_temp,
-                        int& temp_count, int& label_count) const override {
-        // Return the constant value directly
-        return value;
+    tac_operand generate_code(tac_builder& out) const override {
+        // The constant is used directly
+        return out.constant(value, node_type);
     }
+    
+    void print_expr(string& out) const override {
+        out += value;
+    }
+    
+    string get_value() const { return value; }
 };
 
 // Binary operation node
@@ -90,24 +162,75 @@ private:
     ExprNode* right;
 
 public:
-    BinaryOpNode(string op, ExprNode* left, ExprNode* right, string result_type)
+    BinaryOpNode(string op, ExprNode* left, ExprNode* right, data_type result_type)
         : ExprNode(result_type), op(op), left(left), right(right) {}
     
-    ~BinaryOpNode() {
-        delete left;
-        delete right;
-    }
-    
-    string generate_code(ofstream& outcode, map<string, string>& symbol_to_temp,
-                        int& temp_count, int& label_count) const override {
-        string left_str = left->generate_code(outcode, symbol_to_temp, temp_count, label_count);
-        string right_str = right->generate_code(outcode, symbol_to_temp, temp_count, label_count);
+    bool is_logical() const { return op == "&&" || op == "||"; }
+    
+    tac_operand generate_code(tac_builder& out) const override {
+        if (is_logical() && (right->has_side_effects() || right->can_fault())) {
+            // The right operand must not run once the left one decides: t = 1 or t = 0
+            // on the two exits of the jumping code
+            tac_operand temp_var = out.new_temp();
+            tac_operand label_false = out.new_label();
+            tac_operand label_end = out.new_label();
+            generate_cond(out, tac_operand(), label_false);
+            out.emit(OP_COPY, temp_var, out.constant("1", TYPE_INT));
+            out.emit(OP_GOTO, tac_operand(), label_end);
+            out.emit(OP_LABEL, tac_operand(), label_false);
+            out.emit(OP_COPY, temp_var, out.constant("0", TYPE_INT));
+            out.emit(OP_LABEL, tac_operand(), label_end);
+            return temp_var;
+        }
         
-        string temp_var = "t" + to_string(temp_count++);
-        outcode << temp_var << " = " << left_str << " " << op << " " << right_str << endl;
+        tac_operand left_opnd = left->generate_code(out);
+        tac_operand right_opnd = right->generate_code(out);
+        
+        tac_operand temp_var = out.new_temp();
+        out.emit(binary_opcode(op), temp_var, left_opnd, right_opnd);
         
         return temp_var;
     }
+    
+    void generate_cond(tac_builder& out, tac_operand true_label, tac_operand false_label) const override {
+        tac_opcode opcode = is_logical() ? OP_COPY : binary_opcode(op);
+        if (is_relation(opcode)) {
+            // Compare and branch in one instruction
+            tac_operand left_opnd = left->generate_code(out);
+            tac_operand right_opnd = right->generate_code(out);
+            emit_branch(out, opcode, left_opnd, right_opnd, true_label, false_label);
+            return;
+        }
+        if (!is_logical()) {
+            ExprNode::generate_cond(out, true_label, false_label);
+            return;
+        }
+        
+        // Short circuit: the right operand is only evaluated when the left one does
+        // not decide the result, and the left one falls through into it. When the
+        // outcome that decides early falls through as well it needs its own label
+        bool is_and = op == "&&";
+        tac_operand early = is_and ? false_label : true_label;
+        tac_operand label_end;
+        if (early.is_none()) early = label_end = out.new_label();
+        if (is_and) {
+            left->generate_cond(out, tac_operand(), early);
+        } else {
+            left->generate_cond(out, early, tac_operand());
+        }
+        right->generate_cond(out, true_label, false_label);
+        if (!label_end.is_none()) out.emit(OP_LABEL, tac_operand(), label_end);
+    }
+    
+    bool has_side_effects() const override { return left->has_side_effects() || right->has_side_effects(); }
+    
+    bool can_fault() const override { return op == "/" || op == "%" || left->can_fault() || right->can_fault(); }
+    
+    void print_expr(string& out) const override {
+        left->print_source(out);
+        out += op;
+        right->print_source(out);
+    }
 };
 
 // Unary operation node
@@ -118,20 +241,35 @@ private:
     ExprNode* expr;
 
 public:
-    UnaryOpNode(string op, ExprNode* expr, string result_type)
+    UnaryOpNode(string op, ExprNode* expr, data_type result_type)
         : ExprNode(result_type), op(op), expr(expr) {}
     
-    ~UnaryOpNode() { delete expr; }
-    
-    string generate_code(ofstream& outcode, map<string, string>& symbol_to_temp,
-                        int& temp_count, int& label_count) const override {
-        string expr_str = expr->generate_code(outcode, symbol_to_temp, temp_count, label_count);
+    tac_operand generate_code(tac_builder& out) const override {
+        tac_operand expr_opnd = expr->generate_code(out);
         
-        string temp_var = "t" + to_string(temp_count++);
-        outcode << temp_var << " = " << op << expr_str << endl;
+        tac_operand temp_var = out.new_temp();
+        out.emit(unary_opcode(op), temp_var, expr_opnd);
         
         return temp_var;
     }
+    
+    void generate_cond(tac_builder& out, tac_operand true_label, tac_operand false_label) const override {
+        if (op == "!") {
+            // Negation swaps the targets
+            expr->generate_cond(out, false_label, true_label);
+        } else {
+            ExprNode::generate_cond(out, true_label, false_label);
+        }
+    }
+    
+    bool has_side_effects() const override { return expr->has_side_effects(); }
+    
+    bool can_fault() const override { return expr->can_fault(); }
+    
+    void print_expr(string& out) const override {
+        out += op;
+        expr->print_source(out);
+    }
 };
 
 // Assignment operation node
@@ -140,30 +278,37 @@ class AssignNode : public ExprNode {
 private:
     VarNode* lhs;
     ExprNode* rhs;
+    string postfix_op; // "++" or "--" when desugared from x++ / x--, empty otherwise
 
 public:
-    AssignNode(VarNode* lhs, ExprNode* rhs, string result_type)
-        : ExprNode(result_type), lhs(lhs), rhs(rhs) {}
-    
-    ~AssignNode() {
-        delete lhs;
-        delete rhs;
-    }
+    AssignNode(VarNode* lhs, ExprNode* rhs, data_type result_type, string postfix = "")
+        : ExprNode(result_type), lhs(lhs), rhs(rhs), postfix_op(postfix) {}
     
-    string generate_code(ofstream& outcode, map<string, string>& symbol_to_temp,
-                        int& temp_count, int& label_count) const override {
-        string rhs_str = rhs->generate_code(outcode, symbol_to_temp, temp_count, label_count);
+    tac_operand generate_code(tac_builder& out) const override {
+        tac_operand rhs_opnd = rhs->generate_code(out);
         
         if (lhs->has_index()) {
-            // Array element assignment: arr[idx] = expr
-            string idx_str = lhs->generate_index_code(outcode, symbol_to_temp, temp_count, label_count);
-            outcode << lhs->get_name() << "[" << idx_str << "] = " << rhs_str << endl;
+            // Array element assignment: arr[idx] = expr; its value is the stored one
+            tac_operand idx = lhs->generate_index_code(out);
+            out.emit(OP_STORE, lhs->get_operand(out), idx, rhs_opnd);
+            return rhs_opnd;
         } else {
             // Simple assignment: var = expr
-            outcode << lhs->get_name() << " = " << rhs_str << endl;
+            out.emit(OP_COPY, lhs->get_operand(out), rhs_opnd);
+            return lhs->get_operand(out);
+        }
+    }
+    
+    bool has_side_effects() const override { return true; }
+    
+    void print_expr(string& out) const override {
+        lhs->print_source(out);
+        if (!postfix_op.empty()) {
+            out += postfix_op;
+        } else {
+            out += "=";
+            rhs->print_source(out);
         }
-        
-        return lhs->get_name();
     }
 };
 
@@ -171,8 +316,7 @@ public:
 
 class StmtNode : public ASTNode {
 public:
-    virtual string generate_code(ofstream& outcode, map<string, string>& symbol_to_temp,
-                                int& temp_count, int& label_count) const = 0;
+    virtual tac_operand generate_code(tac_builder& out) const = 0;
 };
 
 // Expression statement node
@@ -183,40 +327,94 @@ private:
 
 public:
     ExprStmtNode(ExprNode* e) : expr(e) {}
-    ~ExprStmtNode() { if(expr) delete expr; }
     
-    string generate_code(ofstream& outcode, map<string, string>& symbol_to_temp,
-                        int& temp_count, int& label_count) const override {
+    tac_operand generate_code(tac_builder& out) const override {
         if (expr) {
-            expr->generate_code(outcode, symbol_to_temp, temp_count, label_count);
+            return expr->generate_code(out);
         }
-        return "";
+        return tac_operand();
+    }
+    
+    ExprNode* get_expr() const { return expr; }
+    
+    void print_source(string& out) const override {
+        if (expr) expr->print_source(out);
+        out += ";";
+    }
+};
+
+// printf statement node
+
+class PrintNode : public StmtNode {
+private:
+    VarNode* var;
+
+public:
+    PrintNode(VarNode* v) : var(v) {}
+    
+    tac_operand generate_code(tac_builder& out) const override {
+        out.emit(OP_PRINT, tac_operand(), var->generate_code(out));
+        return tac_operand();
+    }
+    
+    void print_source(string& out) const override {
+        out += "printf(";
+        var->print_source(out);
+        out += ");";
     }
 };
 
+// Placeholder for a statement or unit discarded by error recovery
+
+class ErrorStmtNode : public StmtNode {
+public:
+    tac_operand generate_code(tac_builder&) const override {
+        return tac_operand();
+    }
+    
+    void print_source(string&) const override {}
+};
+
 // Block (compound statement) node
 
 class BlockNode : public StmtNode {
 private:
     vector<StmtNode*> statements;
+    // Source text of the statements rendered so far; statements are complete once added,
+    // so each one is rendered only the first time the block is printed after it was added
+    mutable string source_cache;
+    mutable size_t cached_count = 0;
 
 public:
-    ~BlockNode() {
-        for (auto stmt : statements) {
-            delete stmt;
-        }
-    }
-    
     void add_statement(StmtNode* stmt) {
         if (stmt) statements.push_back(stmt);
     }
     
-    string generate_code(ofstream& outcode, map<string, string>& symbol_to_temp,
-                        int& temp_count, int& label_count) const override {
+    tac_operand generate_code(tac_builder& out) const override {
+        out.enter_scope();
         for (const auto& stmt : statements) {
-            stmt->generate_code(outcode, symbol_to_temp, temp_count, label_count);
+            stmt->generate_code(out);
         }
-        return "";
+        out.exit_scope();
+        return tac_operand();
+    }
+    
+    // Statements separated by newlines, without the enclosing braces
+    void print_statements(string& out) const {
+        for (; cached_count < statements.size(); cached_count++) {
+            if (cached_count > 0) source_cache += "\n";
+            statements[cached_count]->print_source(source_cache);
+        }
+        out += source_cache;
+    }
+    
+    void print_source(string& out) const override {
+        out += "{\n";
+        if (!statements.empty()) {
+            print_statements(out);
+            out += "\n";
+        }
+        out += "}";
     }
 };
 
@@ -232,41 +430,37 @@ public:
     IfNode(ExprNode* cond, StmtNode* then_stmt, StmtNode* else_stmt = nullptr)
         : condition(cond), then_block(then_stmt), else_block(else_stmt) {}
     
-    ~IfNode() {
-        delete condition;
-        delete then_block;
-        if (else_block) delete else_block;
-    }
-    
-    string generate_code(ofstream& outcode, map<string, string>& symbol_to_temp,
-                        int& temp_count, int& label_count) const override {
-        string cond_str = condition->generate_code(outcode, symbol_to_temp, temp_count, label_count);
-        
-        string label_else = "L" + to_string(label_count++);
-        string label_end = "L" + to_string(label_count++);
-        
+    tac_operand generate_code(tac_builder& out) const override {
         if (else_block) {
-            // if-else: if condition goto then, goto else
-            outcode << "if " << cond_str << " goto " << label_else << endl;
-            outcode << "goto " << label_end << endl;
-            outcode << label_else << ":" << endl;
-            then_block->generate_code(outcode, symbol_to_temp, temp_count, label_count);
-            outcode << "goto " << label_end << endl;
-            outcode << label_end << ":" << endl;
-            else_block->generate_code(outcode, symbol_to_temp, temp_count, label_count);
-            outcode << "goto " << label_end << endl;
-            outcode << label_end << ":" << endl;
+            // if-else: condition falls through to then or jumps to else
+            tac_operand label_else = out.new_label();
+            tac_operand label_end = out.new_label();
+            condition->generate_cond(out, tac_operand(), label_else);
+            then_block->generate_code(out);
+            out.emit(OP_GOTO, tac_operand(), label_end);
+            out.emit(OP_LABEL, tac_operand(), label_else);
+            else_block->generate_code(out);
+            out.emit(OP_LABEL, tac_operand(), label_end);
         } else {
-            // if only: if condition goto then, goto end
-            outcode << "if " << cond_str << " goto " << label_else << endl;
-            outcode << "goto " << label_end << endl;
-            outcode << label_else << ":" << endl;
-            then_block->generate_code(outcode, symbol_to_temp, temp_count, label_count);
-            outcode << "goto " << label_end << endl;
-            outcode << label_end << ":" << endl;
+            // if only: condition falls through to then or jumps to end
+            tac_operand label_end = out.new_label();
+            condition->generate_cond(out, tac_operand(), label_end);
+            then_block->generate_code(out);
+            out.emit(OP_LABEL, tac_operand(), label_end);
         }
         
-        return "";
+        return tac_operand();
+    }
+    
+    void print_source(string& out) const override {
+        out += "if(";
+        condition->print_source(out);
+        out += ")\n";
+        then_block->print_source(out);
+        if (else_block) {
+            out += "\nelse\n";
+            else_block->print_source(out);
+        }
     }
 };
 
@@ -281,27 +475,26 @@ public:
     WhileNode(ExprNode* cond, StmtNode* body_stmt)
         : condition(cond), body(body_stmt) {}
     
-    ~WhileNode() {
-        delete condition;
-        delete body;
-    }
-    
-    string generate_code(ofstream& outcode, map<string, string>& symbol_to_temp,
-                        int& temp_count, int& label_count) const override {
-        string start_label = "L" + to_string(label_count++);
-        string body_label = "L" + to_string(label_count++);
-        string end_label = "L" + to_string(label_count++);
+    tac_operand generate_code(tac_builder& out) const override {
+        // Rotated: a guard test skips the loop, and a test at the bottom jumps back
+        // to the body, so an iteration takes one conditional branch
+        tac_operand body_label = out.new_label();
+        tac_operand end_label = out.new_label();
         
-        outcode << start_label << ":" << endl;
-        string cond_str = condition->generate_code(outcode, symbol_to_temp, temp_count, label_count);
-        outcode << "if " << cond_str << " goto " << body_label << endl;
-        outcode << "goto " << end_label << endl;
-        outcode << body_label << ":" << endl;
-        body->generate_code(outcode, symbol_to_temp, temp_count, label_count);
-        outcode << "goto " << start_label << endl;
-        outcode << end_label << ":" << endl;
+        condition->generate_cond(out, tac_operand(), end_label);
+        out.emit(OP_LABEL, tac_operand(), body_label);
+        body->generate_code(out);
+        condition->generate_cond(out, body_label, tac_operand());
+        out.emit(OP_LABEL, tac_operand(), end_label);
         
-        return "";
+        return tac_operand();
+    }
+    
+    void print_source(string& out) const override {
+        out += "while(";
+        condition->print_source(out);
+        out += ")\n";
+        body->print_source(out);
     }
 };
 
@@ -309,55 +502,55 @@ public:
 
 class ForNode : public StmtNode {
 private:
-    ExprNode* init;
-    ExprNode* condition;
+    ExprStmtNode* init;
+    ExprStmtNode* condition; // expression statement, its expression is null in for(;;)
     ExprNode* update;
     StmtNode* body;
 
 public:
-    ForNode(ExprNode* init_expr, ExprNode* cond_expr, ExprNode* update_expr, StmtNode* body_stmt)
-        : init(init_expr), condition(cond_expr), update(update_expr), body(body_stmt) {}
-    
-    ~ForNode() {
-        if (init) delete init;
-        if (condition) delete condition;
-        if (update) delete update;
-        delete body;
-    }
+    ForNode(ExprStmtNode* init_stmt, ExprStmtNode* cond_stmt, ExprNode* update_expr, StmtNode* body_stmt)
+        : init(init_stmt), condition(cond_stmt), update(update_expr), body(body_stmt) {}
     
-    string generate_code(ofstream& outcode, map<string, string>& symbol_to_temp,
-                        int& temp_count, int& label_count) const override {
+    tac_operand generate_code(tac_builder& out) const override {
         // Initialization
-        if (init) {
-            init->generate_code(outcode, symbol_to_temp, temp_count, label_count);
-        }
-        
-        string start_label = "L" + to_string(label_count++);
-        string body_label = "L" + to_string(label_count++);
-        string end_label = "L" + to_string(label_count++);
+        init->generate_code(out);
         
-        outcode << start_label << ":" << endl;
+        ExprNode* test = condition->get_expr();
+        tac_operand body_label = out.new_label();
+        tac_operand end_label = out.new_label();
         
-        // Condition check
-        if (condition) {
-            string cond_str = condition->generate_code(outcode, symbol_to_temp, temp_count, label_count);
-            outcode << "if " << cond_str << " goto " << body_label << endl;
-            outcode << "goto " << end_label << endl;
-            outcode << body_label << ":" << endl;
+        // Guard test, rotated like while
+        if (test) {
+            test->generate_cond(out, tac_operand(), end_label);
         }
         
         // Execute body
-        body->generate_code(outcode, symbol_to_temp, temp_count, label_count);
+        out.emit(OP_LABEL, tac_operand(), body_label);
+        body->generate_code(out);
         
         // Update
         if (update) {
-            update->generate_code(outcode, symbol_to_temp, temp_count, label_count);
+            update->generate_code(out);
         }
         
-        outcode << "goto " << start_label << endl;
-        outcode << end_label << ":" << endl;
+        // Bottom test jumps back while the condition holds
+        if (test) {
+            test->generate_cond(out, body_label, tac_operand());
+        } else {
+            out.emit(OP_GOTO, tac_operand(), body_label);
+        }
+        out.emit(OP_LABEL, tac_operand(), end_label);
         
-        return "";
+        return tac_operand();
+    }
+    
+    void print_source(string& out) const override {
+        out += "for(";
+        init->print_source(out);
+        condition->print_source(out);
+        update->print_source(out);
+        out += ")\n";
+        body->print_source(out);
     }
 };
 
@@ -369,17 +562,20 @@ private:
 
 public:
     ReturnNode(ExprNode* e) : expr(e) {}
-    ~ReturnNode() { if (expr) delete expr; }
     
-    string generate_code(ofstream& outcode, map<string, string>& symbol_to_temp,
-                        int& temp_count, int& label_count) const override {
+    tac_operand generate_code(tac_builder& out) const override {
         if (expr) {
-            string ret_str = expr->generate_code(outcode, symbol_to_temp, temp_count, label_count);
-            outcode << "return " << ret_str << endl;
+            out.emit(OP_RETURN, tac_operand(), expr->generate_code(out));
         } else {
-            outcode << "return" << endl;
+            out.emit(OP_RETURN);
         }
-        return "";
+        return tac_operand();
+    }
+    
+    void print_source(string& out) const override {
+        out += "return ";
+        expr->print_source(out);
+        out += ";";
     }
 };
 
@@ -387,48 +583,51 @@ public:
 
 class DeclNode : public StmtNode {
 private:
-    string type;
-    vector<pair<string, int>> vars; // Variable identifier and array dimension (0 for regular vars)
+    data_type type;
+    vector<pair<uint32_t, int>> vars; // Variable identifier and array dimension (0 for regular vars)
 
 public:
-    DeclNode(string t) : type(t) {}
+    DeclNode(data_type t) : type(t) {}
     
-    void add_var(string name, int array_size = 0) {
+    void add_var(uint32_t name, int array_size = 0) {
         vars.push_back(make_pair(name, array_size));
     }
     
-    string generate_code(ofstream& outcode, map<string, string>& symbol_to_temp,
-                        int& temp_count, int& label_count) const override {
+    tac_operand generate_code(tac_builder& out) const override {
+        // Declarations only appear as comments in the code
         for (const auto& var : vars) {
-            if (var.second == 0) {
-                // Regular variable declaration
-                outcode << "// Declaration: " << type << " " << var.first << endl;
-            } else {
-                // Array declaration
-                outcode << "// Declaration: " << type << " " << var.first << "[" << var.second << "]" << endl;
-            }
+            out.declare(var.first, type, var.second);
         }
-        return "";
+        return tac_operand();
     }
     
-    string get_type() const { return type; }
-    const vector<pair<string, int>>& get_vars() const { return vars; }
+    void print_source(string& out) const override {
+        out += type_name(type) + " ";
+        for (size_t i = 0; i < vars.size(); i++) {
+            if (i > 0) out += ",";
+            out += names.get_name(vars[i].first);
+            if (vars[i].second != 0) out += "[" + to_string(vars[i].second) + "]";
+        }
+        out += ";";
+    }
+    
+    data_type get_type() const { return type; }
+    const vector<pair<uint32_t, int>>& get_vars() const { return vars; }
 };
 
 // Function declaration node
 
 class FuncDeclNode : public ASTNode {
 private:
-    string return_type;
-    string name;
-    vector<pair<string, string>> params; // Parameter data type and identifier
+    data_type return_type;
+    uint32_t name;
+    vector<pair<data_type, uint32_t>> params; // Parameter data type and identifier (name_table::none if unnamed)
     BlockNode* body;
 
 public:
-    FuncDeclNode(string ret_type, string n) : return_type(ret_type), name(n), body(nullptr) {}
-    ~FuncDeclNode() { if (body) delete body; }
+    FuncDeclNode(data_type ret_type, uint32_t n) : return_type(ret_type), name(n), body(nullptr) {}
     
-    void add_param(string type, string name) {
+    void add_param(data_type type, uint32_t name) {
         params.push_back(make_pair(type, name));
     }
     
@@ -436,25 +635,27 @@ public:
         body = b;
     }
     
-    string generate_code(ofstream& outcode, map<string, string>& symbol_to_temp,
-                        int& temp_count, int& label_count) const override {
-        outcode << endl << "// Function: " << return_type << " " << name << "(";
-        
-        // Print parameter list
-        for (size_t i = 0; i < params.size(); i++) {
-            outcode << params[i].first << " " << params[i].second;
-            if (i < params.size() - 1) outcode << ", ";
-        }
-        outcode << ")" << endl;
+    tac_operand generate_code(tac_builder& out) const override {
+        out.begin_function(name, return_type, params);
         
         // Function body
         if (body) {
-            body->generate_code(outcode, symbol_to_temp, temp_count, label_count);
+            body->generate_code(out);
         }
         
-        outcode << endl;
-        
-        return "";
+        out.end_function();
+        return tac_operand();
+    }
+    
+    void print_source(string& out) const override {
+        out += type_name(return_type) + " " + names.get_name(name) + "(";
+        for (size_t i = 0; i < params.size(); i++) {
+            if (i > 0) out += ",";
+            out += type_name(params[i].first);
+            if (params[i].second != name_table::none) out += " " + names.get_name(params[i].second);
+        }
+        out += ")\n";
+        body->print_source(out);
     }
 };
 
@@ -465,16 +666,12 @@ private:
     vector<ExprNode*> args;
 
 public:
-    ~ArgumentsNode() {
-        // Arguments will be managed by FuncCallNode
-    }
-    
     void add_argument(ExprNode* arg) {
         if (arg) args.push_back(arg);
     }
     
     ExprNode* get_argument(int index) const {
-        if (index >= 0 && index < args.size()) {
+        if (index >= 0 && (size_t)index < args.size()) {
             return args[index];
         }
         return nullptr;
@@ -488,10 +685,16 @@ public:
         return args;
     }
     
-    string generate_code(ofstream& outcode, map<string, string>& symbol_to_temp,
-                        int& temp_count, int& label_count) const override {
+    tac_operand generate_code(tac_builder&) const override {
         // This node doesn't directly generate code
-        return "";
+        return tac_operand();
+    }
+    
+    void print_source(string& out) const override {
+        for (size_t i = 0; i < args.size(); i++) {
+            if (i > 0) out += ",";
+            args[i]->print_source(out);
+        }
     }
 };
 
@@ -499,43 +702,46 @@ public:
 
 class FuncCallNode : public ExprNode {
 private:
-    string func_name;
+    uint32_t func_name;
     vector<ExprNode*> arguments;
 
 public:
-    FuncCallNode(string name, string result_type)
+    FuncCallNode(uint32_t name, data_type result_type)
         : ExprNode(result_type), func_name(name) {}
     
-    ~FuncCallNode() {
-        for (auto arg : arguments) {
-            delete arg;
-        }
-    }
-    
     void add_argument(ExprNode* arg) {
         if (arg) arguments.push_back(arg);
     }
     
-    string generate_code(ofstream& outcode, map<string, string>& symbol_to_temp,
-                        int& temp_count, int& label_count) const override {
+    tac_operand generate_code(tac_builder& out) const override {
         // Evaluate and generate params for arguments
-        vector<string> arg_strs;
+        vector<tac_operand> arg_opnds;
         for (const auto& arg : arguments) {
-            string arg_str = arg->generate_code(outcode, symbol_to_temp, temp_count, label_count);
-            arg_strs.push_back(arg_str);
+            arg_opnds.push_back(arg->generate_code(out));
         }
         
         // Output param statements for each argument
-        for (const auto& arg_str : arg_strs) {
-            outcode << "param " << arg_str << endl;
+        for (const auto& arg_opnd : arg_opnds) {
+            out.emit(OP_PARAM, tac_operand(), arg_opnd);
         }
         
         // Call function
-        string temp_var = "t" + to_string(temp_count++);
-        outcode << temp_var << " = call " << func_name << ", " << arguments.size() << endl;
+        tac_operand temp_var = out.new_temp();
+        out.emit(OP_CALL, temp_var, tac_operand(OPND_FUNC, func_name), tac_operand(OPND_IMM, arguments.size()));
         
         return temp_var;
     }
+    
+    bool has_side_effects() const override { return true; }
+    
+    void print_expr(string& out) const override {
+        out += names.get_name(func_name) + "(";
+        for (size_t i = 0; i < arguments.size(); i++) {
+            if (i > 0) out += ",";
+            arguments[i]->print_source(out);
+        }
+        out += ")";
+    }
 };
 
 // Program node (AST root)
@@ -543,24 +749,28 @@ public:
 class ProgramNode : public ASTNode {
 private:
     vector<ASTNode*> units;
+    // Source text of the units rendered so far (see BlockNode)
+    mutable string source_cache;
+    mutable size_t cached_count = 0;
 
 public:
-    ~ProgramNode() {
-        for (auto unit : units) {
-            delete unit;
-        }
-    }
-    
     void add_unit(ASTNode* unit) {
         if (unit) units.push_back(unit);
     }
     
-    string generate_code(ofstream& outcode, map<string, string>& symbol_to_temp,
-                        int& temp_count, int& label_count) const override {
+    tac_operand generate_code(tac_builder& out) const override {
         for (const auto& unit : units) {
-            unit->generate_code(outcode, symbol_to_temp, temp_count, label_count);
+            unit->generate_code(out);
+        }
+        return tac_operand();
+    }
+    
+    void print_source(string& out) const override {
+        for (; cached_count < units.size(); cached_count++) {
+            if (cached_count > 0) source_cache += "\n";
+            units[cached_count]->print_source(source_cache);
         }
-        return "";
+        out += source_cache;
     }
 };
 
@@ -0,0 +1,94 @@
+// Cost of declaring variables the way the parser actions do: one Insert_in_table
+// that hands back the symbol to annotate, against inserting and then looking the
+// name up again for every attribute that is set (the previous pattern).
+//
+// Build and run from this directory:
+//     g++ -O2 -std=gnu++17 -o declaration_bench declaration_bench.cpp && ./declaration_bench
+
+#include "../symbol_table.h"
+#include <chrono>
+#include <cstdio>
+#include <algorithm>
+#include <vector>
+
+using namespace std;
+
+name_table names;
+
+// Declares vars_per_scope variables (every fourth one an array) in each of scopes
+// block scopes nested in a global scope and returns the nanoseconds per declaration
+template<typename F>
+double time_declarations(const vector<uint32_t>& ids, int scopes, F declare)
+{
+    ofstream outlog("/dev/null");
+    arena mem;
+    symbol_table table(mem);
+    table.enter_scope(outlog);
+
+    auto start = chrono::steady_clock::now();
+    for(int s = 0; s < scopes; s++)
+    {
+        table.enter_scope(outlog);
+        for(int i = 0; i < ids.size(); i++)
+        {
+            declare(table, ids[i], i % 4 == 3 ? 10 : 0);
+        }
+        table.exit_scope(outlog);
+    }
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double, nano>(end - start).count() / ((double)scopes * ids.size());
+}
+
+void declare_with_handle(symbol_table& table, uint32_t name, int array_size)
+{
+    bool inserted;
+    symbol_info *sym = table.Insert_in_table(name, "ID", inserted);
+    if(!inserted) return;
+    sym->setvartype(TYPE_INT);
+    if(array_size == 0) sym->setidtype(ID_VAR);
+    else
+    {
+        sym->setidtype(ID_ARRAY);
+        sym->setarraysize(array_size);
+    }
+}
+
+void declare_with_lookups(symbol_table& table, uint32_t name, int array_size)
+{
+    bool inserted;
+    table.Insert_in_table(name, "ID", inserted);
+    if(!inserted) return;
+    table.Lookup_in_table(name)->setvartype(TYPE_INT);
+    if(array_size == 0) table.Lookup_in_table(name)->setidtype(ID_VAR);
+    else
+    {
+        table.Lookup_in_table(name)->setidtype(ID_ARRAY);
+        table.Lookup_in_table(name)->setarraysize(array_size);
+    }
+}
+
+int main()
+{
+    int sizes[] = {10, 100, 1000};
+    const int total = 2000000;
+
+    printf("%16s %14s %14s\n", "vars per scope", "handle ns", "lookups ns");
+    for(int n : sizes)
+    {
+        vector<uint32_t> ids;
+        for(int i = 0; i < n; i++)
+        {
+            ids.push_back(names.intern("var_" + to_string(i)));
+        }
+
+        // best of three alternating runs
+        double handle_ns = 1e18, lookups_ns = 1e18;
+        for(int run = 0; run < 3; run++)
+        {
+            handle_ns = min(handle_ns, time_declarations(ids, total / n, declare_with_handle));
+            lookups_ns = min(lookups_ns, time_declarations(ids, total / n, declare_with_lookups));
+        }
+        printf("%16d %14.1f %14.1f\n", n, handle_ns, lookups_ns);
+    }
+    return 0;
+}
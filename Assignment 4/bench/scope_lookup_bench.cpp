@@ -0,0 +1,111 @@
+// Lookup cost of a single scope as it grows, for the scope_table in ../scope_table.h
+// against the previous layout (10 chains indexed by the sum of the characters).
+//
+// Build and run from this directory:
+//     g++ -O2 -std=gnu++17 -o scope_lookup_bench scope_lookup_bench.cpp && ./scope_lookup_bench
+
+#include "../scope_table.h"
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+using namespace std;
+
+name_table names;
+
+// The previous scope layout: fixed bucket count, additive hash, linked chains
+class chained_scope
+{
+private:
+    struct node
+    {
+        uint32_t name;
+        node *next;
+    };
+    vector<node*> chains;
+
+    int hash_func(uint32_t name)
+    {
+        const string& symbol = names.get_name(name);
+        int sum = 0;
+        for (int i = 0; i < symbol.size(); i++) sum += (int)symbol[i];
+        return sum % chains.size();
+    }
+
+public:
+    chained_scope(int n) : chains(n, NULL) {}
+
+    void insert(uint32_t name)
+    {
+        node *&head = chains[hash_func(name)];
+        head = new node{name, head};
+    }
+
+    bool lookup(uint32_t name)
+    {
+        for(node *curr = chains[hash_func(name)]; curr != NULL; curr = curr->next)
+        {
+            if(curr->name == name) return true;
+        }
+        return false;
+    }
+
+    ~chained_scope()
+    {
+        for(node *head : chains)
+        {
+            while(head != NULL)
+            {
+                node *next = head->next;
+                delete head;
+                head = next;
+            }
+        }
+    }
+};
+
+// Nanoseconds per lookup, probing every declared name in turn
+template<typename F>
+double time_lookups(const vector<uint32_t>& ids, int total, F lookup)
+{
+    int found = 0;
+    auto start = chrono::steady_clock::now();
+    for(int i = 0; i < total; i++)
+    {
+        found += lookup(ids[(size_t)i * 7919 % ids.size()]);
+    }
+    auto end = chrono::steady_clock::now();
+    if(found != total) printf("lookup failed\n");
+    return chrono::duration<double, nano>(end - start).count() / total;
+}
+
+int main()
+{
+    const int lookups = 2000000;
+    int sizes[] = {100, 1000, 10000, 100000};
+
+    printf("%10s %18s %18s\n", "symbols", "scope_table ns", "10 chains ns");
+    for(int n : sizes)
+    {
+        vector<uint32_t> ids;
+        for(int i = 0; i < n; i++)
+        {
+            ids.push_back(names.intern("func_" + to_string(i)));
+        }
+
+        arena mem;
+        scope_table scope(64, 1, mem);
+        bool inserted;
+        for(uint32_t id : ids) scope.Insert_in_scope(id, "ID", inserted);
+
+        chained_scope chained(10);
+        for(uint32_t id : ids) chained.insert(id);
+
+        double open_ns = time_lookups(ids, lookups, [&](uint32_t id) { return scope.Lookup_in_scope(id) != NULL; });
+        // the chained table is quadratic overall, keep its run short
+        double chained_ns = time_lookups(ids, n >= 10000 ? 20000 : lookups, [&](uint32_t id) { return chained.lookup(id); });
+
+        printf("%10d %18.1f %18.1f\n", n, open_ns, chained_ns);
+    }
+    return 0;
+}
@@ -0,0 +1,358 @@
+#ifndef CFG_H
+#define CFG_H
+
+#include <algorithm>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "ir.h"
+
+using namespace std;
+
+// Control-flow graph of one tac_function. Blocks, edges, the dominator tree and the
+// loop nest are all kept in flat vectors addressed by block index: a block's
+// instructions are a range of tac_function::code, and its predecessors and dominator
+// tree children are ranges of shared index vectors. The graph is a view of the
+// code; a pass that changes the jumps or labels builds it again.
+
+static const uint32_t no_block = UINT32_MAX;
+static const uint32_t no_loop = UINT32_MAX;
+
+struct basic_block
+{
+    uint32_t begin, end;            // instructions [begin, end) of tac_function::code
+    uint32_t succs[2];              // fall-through successor first, then the jump target
+    uint32_t num_succs;
+    uint32_t pred_begin, pred_end;  // range of control_flow_graph::preds
+    uint32_t child_begin, child_end; // range of control_flow_graph::dom_children
+};
+
+// Natural loop; blocks are a range of control_flow_graph::loop_blocks, header first
+struct tac_loop
+{
+    uint32_t header;
+    uint32_t parent;                // enclosing loop, no_loop at the outermost level
+    uint32_t depth;                 // 1 for an outermost loop
+    uint32_t block_begin, block_end;
+};
+
+class control_flow_graph
+{
+private:
+    vector<uint32_t> dom_pre, dom_post; // dominator tree numbering, for dominates()
+
+    static bool ends_block(tac_opcode op) {
+        return op == OP_GOTO || is_cond_branch(op) || op == OP_RETURN;
+    }
+
+    void find_blocks(const tac_function& func, vector<uint32_t>& label_block) {
+        // A block starts at a label and after a jump or return
+        const vector<tac_instr>& code = func.code;
+        blocks.push_back(basic_block{0, 0, {no_block, no_block}, 0, 0, 0, 0, 0});
+        for (uint32_t i = 0; i < code.size(); i++) {
+            if (i > blocks.back().begin && (code[i].op == OP_LABEL || ends_block(code[i - 1].op))) {
+                blocks.back().end = i;
+                blocks.push_back(basic_block{i, i, {no_block, no_block}, 0, 0, 0, 0, 0});
+            }
+            if (code[i].op == OP_LABEL) label_block[code[i].src1.id] = blocks.size() - 1;
+        }
+        blocks.back().end = code.size();
+    }
+
+    void link_blocks(const tac_function& func, const vector<uint32_t>& label_block) {
+        vector<uint32_t> num_preds(blocks.size() + 1, 0);
+        for (uint32_t b = 0; b < blocks.size(); b++) {
+            basic_block& block = blocks[b];
+            const tac_instr* last = block.begin < block.end ? &func.code[block.end - 1] : nullptr;
+            bool falls_through = !last || (last->op != OP_GOTO && last->op != OP_RETURN);
+            if (falls_through && b + 1 < blocks.size()) block.succs[block.num_succs++] = b + 1;
+            if (last && last->op == OP_GOTO) block.succs[block.num_succs++] = label_block[last->src1.id];
+            if (last && is_cond_branch(last->op)) {
+                uint32_t target = label_block[last->dst.id];
+                if (block.num_succs == 0 || block.succs[0] != target) block.succs[block.num_succs++] = target;
+            }
+            for (uint32_t s = 0; s < block.num_succs; s++) num_preds[block.succs[s] + 1]++;
+        }
+
+        // Predecessor lists, one counting pass and one filling pass
+        for (uint32_t b = 0; b < blocks.size(); b++) num_preds[b + 1] += num_preds[b];
+        preds.assign(num_preds[blocks.size()], 0);
+        for (uint32_t b = 0; b < blocks.size(); b++) {
+            blocks[b].pred_begin = blocks[b].pred_end = num_preds[b];
+        }
+        for (uint32_t b = 0; b < blocks.size(); b++) {
+            for (uint32_t s = 0; s < blocks[b].num_succs; s++) {
+                preds[blocks[blocks[b].succs[s]].pred_end++] = b;
+            }
+        }
+    }
+
+    void order_blocks() {
+        // Iterative depth-first search from the entry; postorder reversed
+        rpo.clear();
+        rpo_index.assign(blocks.size(), no_block);
+        vector<uint8_t> visited(blocks.size(), 0);
+        vector<pair<uint32_t, uint32_t>> stack; // block, next successor to visit
+        stack.push_back(make_pair(0, 0));
+        visited[0] = 1;
+        while (!stack.empty()) {
+            uint32_t b = stack.back().first;
+            uint32_t& next = stack.back().second;
+            if (next < blocks[b].num_succs) {
+                uint32_t s = blocks[b].succs[next++];
+                if (!visited[s]) {
+                    visited[s] = 1;
+                    stack.push_back(make_pair(s, 0));
+                }
+            } else {
+                rpo.push_back(b);
+                stack.pop_back();
+            }
+        }
+        reverse(rpo.begin(), rpo.end());
+        for (uint32_t i = 0; i < rpo.size(); i++) rpo_index[rpo[i]] = i;
+    }
+
+    uint32_t intersect(uint32_t a, uint32_t b) const {
+        while (a != b) {
+            while (rpo_index[a] > rpo_index[b]) a = idom[a];
+            while (rpo_index[b] > rpo_index[a]) b = idom[b];
+        }
+        return a;
+    }
+
+    // Cooper, Harvey and Kennedy's iterative algorithm over the reverse postorder
+    void find_dominators() {
+        idom.assign(blocks.size(), no_block);
+        idom[0] = 0;
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            for (uint32_t i = 1; i < rpo.size(); i++) {
+                uint32_t b = rpo[i];
+                uint32_t new_idom = no_block;
+                for (uint32_t p = blocks[b].pred_begin; p < blocks[b].pred_end; p++) {
+                    uint32_t pred = preds[p];
+                    if (idom[pred] == no_block) continue;
+                    new_idom = new_idom == no_block ? pred : intersect(pred, new_idom);
+                }
+                if (idom[b] != new_idom) {
+                    idom[b] = new_idom;
+                    changed = true;
+                }
+            }
+        }
+
+        // Children lists of the dominator tree, in reverse postorder
+        vector<uint32_t> num_children(blocks.size() + 1, 0);
+        for (uint32_t i = 1; i < rpo.size(); i++) num_children[idom[rpo[i]] + 1]++;
+        for (uint32_t b = 0; b < blocks.size(); b++) num_children[b + 1] += num_children[b];
+        dom_children.assign(num_children[blocks.size()], 0);
+        for (uint32_t b = 0; b < blocks.size(); b++) {
+            blocks[b].child_begin = blocks[b].child_end = num_children[b];
+        }
+        for (uint32_t i = 1; i < rpo.size(); i++) {
+            dom_children[blocks[idom[rpo[i]]].child_end++] = rpo[i];
+        }
+
+        // Pre and post numbers of the tree make dominance a constant-time test
+        dom_pre.assign(blocks.size(), 0);
+        dom_post.assign(blocks.size(), 0);
+        uint32_t counter = 0;
+        vector<pair<uint32_t, uint32_t>> stack; // block, next child
+        stack.push_back(make_pair(0, blocks[0].child_begin));
+        dom_pre[0] = counter++;
+        while (!stack.empty()) {
+            uint32_t b = stack.back().first;
+            uint32_t& next = stack.back().second;
+            if (next < blocks[b].child_end) {
+                uint32_t c = dom_children[next++];
+                dom_pre[c] = counter++;
+                stack.push_back(make_pair(c, blocks[c].child_begin));
+            } else {
+                dom_post[b] = counter++;
+                stack.pop_back();
+            }
+        }
+    }
+
+    // Natural loops of the back edges (edges to a dominator), one loop per header
+    void find_loops() {
+        loops.clear();
+        loop_blocks.clear();
+        loop_of.assign(blocks.size(), no_loop);
+
+        vector<uint32_t> in_loop(blocks.size(), no_loop); // loop whose body was last collected
+        vector<uint32_t> work;
+        for (uint32_t i = 0; i < rpo.size(); i++) {
+            uint32_t header = rpo[i];
+            uint32_t loop = loops.size();
+            uint32_t first = loop_blocks.size();
+            for (uint32_t p = blocks[header].pred_begin; p < blocks[header].pred_end; p++) {
+                uint32_t latch = preds[p];
+                if (!dominates(header, latch)) continue;
+                if (loop_blocks.size() == first) {
+                    loop_blocks.push_back(header);
+                    in_loop[header] = loop;
+                }
+                if (in_loop[latch] != loop) {
+                    in_loop[latch] = loop;
+                    loop_blocks.push_back(latch);
+                    work.push_back(latch);
+                }
+            }
+            if (loop_blocks.size() == first) continue;
+
+            // Everything that reaches a latch without passing through the header
+            while (!work.empty()) {
+                uint32_t b = work.back();
+                work.pop_back();
+                for (uint32_t p = blocks[b].pred_begin; p < blocks[b].pred_end; p++) {
+                    uint32_t pred = preds[p];
+                    if (in_loop[pred] == loop || rpo_index[pred] == no_block) continue;
+                    in_loop[pred] = loop;
+                    loop_blocks.push_back(pred);
+                    work.push_back(pred);
+                }
+            }
+
+            // Headers are visited in reverse postorder, so the loops containing this
+            // one are already recorded and the innermost of them owns the header
+            uint32_t parent = loop_of[header];
+            loops.push_back(tac_loop{header, parent, parent == no_loop ? 1 : loops[parent].depth + 1,
+                                     first, (uint32_t)loop_blocks.size()});
+            for (uint32_t k = first; k < loop_blocks.size(); k++) loop_of[loop_blocks[k]] = loop;
+        }
+    }
+
+public:
+    vector<basic_block> blocks;     // blocks[0] is the entry
+    vector<uint32_t> preds;
+    vector<uint32_t> rpo;           // reachable blocks in reverse postorder
+    vector<uint32_t> rpo_index;     // position in rpo, no_block if unreachable
+    vector<uint32_t> idom;          // immediate dominator, no_block if unreachable (entry: itself)
+    vector<uint32_t> dom_children;
+    vector<tac_loop> loops;         // outer loops before the loops they contain
+    vector<uint32_t> loop_blocks;
+    vector<uint32_t> loop_of;       // innermost loop of each block, no_loop if none
+
+    // label_block maps label numbers to blocks; it is scratch space of at least
+    // tac_program::num_labels entries and only the labels of func are touched
+    void build(const tac_function& func, vector<uint32_t>& label_block) {
+        blocks.clear();
+        find_blocks(func, label_block);
+        link_blocks(func, label_block);
+        order_blocks();
+        find_dominators();
+        find_loops();
+    }
+
+    // Successor reached when a block's ending branch is not taken, no_block if there is none
+    uint32_t fall_through(uint32_t b) const {
+        const basic_block& block = blocks[b];
+        return block.num_succs > 0 && block.succs[0] == b + 1 ? b + 1 : no_block;
+    }
+
+    // Target of a block's ending goto or branch (the fall-through block if they coincide)
+    uint32_t jump_target(uint32_t b) const {
+        const basic_block& block = blocks[b];
+        return block.num_succs > 0 ? block.succs[block.num_succs - 1] : no_block;
+    }
+
+    bool reachable(uint32_t b) const {
+        return rpo_index[b] != no_block;
+    }
+
+    // Whether every path from the entry to b passes through a (a dominates itself)
+    bool dominates(uint32_t a, uint32_t b) const {
+        if (!reachable(a) || !reachable(b)) return false;
+        return dom_pre[a] <= dom_pre[b] && dom_post[b] <= dom_post[a];
+    }
+
+    bool loop_contains(uint32_t loop, uint32_t b) const {
+        for (uint32_t l = loop_of[b]; l != no_loop; l = loops[l].parent) {
+            if (l == loop) return true;
+        }
+        return false;
+    }
+
+    // Whether code placed right before a loop's header label runs only on entry to
+    // the loop: the header starts with a label and the loop does not fall into it
+    bool has_preheader_spot(const tac_function& func, uint32_t loop) const {
+        uint32_t header = loops[loop].header;
+        if (header == 0 || func.code[blocks[header].begin].op != OP_LABEL) return false;
+        return !(fall_through(header - 1) == header && loop_contains(loop, header - 1));
+    }
+};
+
+// Retargets the jumps that enter a loop's header from outside the loop to a new
+// label and returns it, to be placed before the code inserted in front of the
+// header. Returns none when the loop is only entered by falling through.
+inline tac_operand enter_through_preheader(tac_program& prog, tac_function& func, const control_flow_graph& cfg,
+                                           uint32_t loop) {
+    const basic_block& header = cfg.blocks[cfg.loops[loop].header];
+    tac_operand label;
+    for (uint32_t p = header.pred_begin; p < header.pred_end; p++) {
+        uint32_t pred = cfg.preds[p];
+        if (cfg.loop_contains(loop, pred)) continue;
+        tac_instr& last = func.code[cfg.blocks[pred].end - 1];
+        if (last.op != OP_GOTO && !is_cond_branch(last.op)) continue;
+        if (jump_label(last) != func.code[header.begin].src1) continue;
+        if (label.is_none()) label = tac_operand(OPND_LABEL, prog.num_labels++);
+        jump_label(last) = label;
+    }
+    return label;
+}
+
+// Writes the graphs of all functions in Graphviz dot format, one cluster per function.
+// Dashed edges point from each block to its immediate dominator; loop headers are
+// drawn with a double border.
+
+inline void dump_cfg(const tac_program& prog, ostream& out) {
+    tac_printer printer(prog);
+    control_flow_graph cfg;
+    vector<uint32_t> label_block(prog.num_labels, no_block);
+    string text;
+
+    out << "digraph cfg {" << endl;
+    out << "    node [shape=box, fontname=\"monospace\"];" << endl;
+    for (uint32_t f = 0; f < prog.functions.size(); f++) {
+        const tac_function& func = prog.functions[f];
+        cfg.build(func, label_block);
+
+        out << "    subgraph cluster_" << f << " {" << endl;
+        out << "        label=\"" << type_name(func.return_type) << " " << names.get_name(func.name) << "\";" << endl;
+        for (uint32_t b = 0; b < cfg.blocks.size(); b++) {
+            const basic_block& block = cfg.blocks[b];
+            text = "B" + to_string(b);
+            if (cfg.loop_of[b] != no_loop) text += " (loop depth " + to_string(cfg.loops[cfg.loop_of[b]].depth) + ")";
+            if (!cfg.reachable(b)) text += " (unreachable)";
+            text += "\\l";
+            for (uint32_t i = block.begin; i < block.end; i++) {
+                for (char c : printer.instr_text(func.code[i])) {
+                    if (c == '"' || c == '\\') text += '\\';
+                    text += c;
+                }
+                text += "\\l";
+            }
+            out << "        f" << f << "b" << b << " [label=\"" << text << "\"";
+            if (cfg.loop_of[b] != no_loop && cfg.loops[cfg.loop_of[b]].header == b) out << ", peripheries=2";
+            out << "];" << endl;
+        }
+        for (uint32_t b = 0; b < cfg.blocks.size(); b++) {
+            for (uint32_t s = 0; s < cfg.blocks[b].num_succs; s++) {
+                out << "        f" << f << "b" << b << " -> f" << f << "b" << cfg.blocks[b].succs[s] << ";" << endl;
+            }
+            if (b != 0 && cfg.idom[b] != no_block) {
+                out << "        f" << f << "b" << b << " -> f" << f << "b" << cfg.idom[b]
+                    << " [style=dashed, color=gray, constraint=false];" << endl;
+            }
+        }
+        out << "    }" << endl;
+    }
+    out << "}" << endl;
+}
+
+#endif // CFG_H
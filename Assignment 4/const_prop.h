@@ -0,0 +1,427 @@
+#ifndef CONST_PROP_H
+#define CONST_PROP_H
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "cfg.h"
+#include "ir.h"
+#include "liveness.h"
+
+using namespace std;
+
+// Sparse conditional constant propagation (Wegman and Zadeck) over the flat TAC.
+// Blocks are only evaluated once an edge into them is known to execute, and a branch
+// whose condition is constant only lets its taken edge execute, so constants that
+// reach a block along live paths only are still found. The variables are not in SSA
+// form, so a block keeps lattice values on entry, but only for the scalars it reads
+// before assigning them. Those are found per scalar by walking back from such reads
+// to the blocks that assign it, so a temporary used within one block takes no space
+// and the entry values grow with what is live across blocks rather than with blocks
+// times scalars. Blocks wait on the worklist in reverse postorder, so a block is
+// evaluated again only when a loop brings it a new value.
+//
+// Afterwards constant operands are substituted, instructions with a constant result
+// become copies of the constant and constant branches become gotos or disappear. Blocks
+// left unreachable are not touched; dead code elimination removes them.
+//
+// Arithmetic follows the type checker: int operations wrap at 32 bits and float
+// operations are done in single precision. Division by zero and results that have
+// no literal form are left to run time.
+
+class constant_propagation
+{
+private:
+    enum lattice_state : uint8_t { UNDEFINED, CONSTANT, VARYING };
+
+    struct lattice_value
+    {
+        lattice_state state;
+        data_type type;
+        long long int_value;
+        float float_value;
+
+        bool operator==(const lattice_value& other) const {
+            if (state != other.state) return false;
+            if (state != CONSTANT) return true;
+            if (type != other.type) return false;
+            if (type == TYPE_INT) return int_value == other.int_value;
+            // Not ==, which takes -0.0 for +0.0
+            return float_value == other.float_value && signbit(float_value) == signbit(other.float_value);
+        }
+    };
+
+    tac_program& prog;
+    tac_values values;
+
+    vector<uint32_t> entry_begin;       // by block, range of entry_slots; one more at the end
+    vector<uint32_t> entry_slots;       // scalars each block reads before assigning them
+    vector<lattice_value> block_in;     // value on entry, parallel to entry_slots
+    vector<uint32_t> global_slots;      // scalars a call may assign
+    vector<uint8_t> reached;
+    vector<uint8_t> queued;
+    bool pending = false;               // some block is queued
+    vector<lattice_value> state;        // by slot; only entries and assigned slots are current
+
+    static lattice_value undefined() { return lattice_value{UNDEFINED, TYPE_NONE, 0, 0}; }
+    static lattice_value varying() { return lattice_value{VARYING, TYPE_NONE, 0, 0}; }
+
+    static lattice_value int_value(long long v) {
+        return lattice_value{CONSTANT, TYPE_INT, (long long)(int32_t)(uint32_t)v, 0};
+    }
+
+    static lattice_value float_value(double v) {
+        float f = (float)v;
+        if (!isfinite(f)) return varying();
+        return lattice_value{CONSTANT, TYPE_FLOAT, 0, f};
+    }
+
+    static bool is_true(const lattice_value& v) {
+        return v.type == TYPE_INT ? v.int_value != 0 : v.float_value != 0;
+    }
+
+    static double as_double(const lattice_value& v) {
+        return v.type == TYPE_INT ? (double)v.int_value : (double)v.float_value;
+    }
+
+    static lattice_value meet(const lattice_value& a, const lattice_value& b) {
+        if (a.state == UNDEFINED) return b;
+        if (b.state == UNDEFINED) return a;
+        if (a.state == VARYING || b.state == VARYING || !(a == b)) return varying();
+        return a;
+    }
+
+    lattice_value value_of(const tac_operand& opnd) const {
+        if (opnd.kind == OPND_CONST) {
+            const tac_constant& c = prog.constants[opnd.id];
+            return c.type == TYPE_INT ? int_value(c.int_value) : float_value(c.float_value);
+        }
+        uint32_t s = values.scalar_slot(opnd);
+        return s == no_slot ? varying() : state[s];
+    }
+
+    // Value stored into a variable of the given declared type
+    static lattice_value convert(const lattice_value& v, data_type type) {
+        if (v.state != CONSTANT || type == TYPE_NONE || type == v.type) return v;
+        if (type == TYPE_FLOAT) return float_value((double)v.int_value);
+        if (type == TYPE_INT) {
+            if (!(v.float_value > (float)INT_MIN - 1 && v.float_value < (float)INT_MAX)) return varying();
+            return int_value((long long)v.float_value);
+        }
+        return v;
+    }
+
+    // Type a store into the slot converts to; temporaries take values as they are
+    data_type declared_type(uint32_t s) const {
+        return values.operands[s].kind == OPND_VAR ? values.types[s] : TYPE_NONE;
+    }
+
+    static lattice_value fold_binary(tac_opcode op, const lattice_value& a, const lattice_value& b) {
+        // A constant left operand can decide && and || on its own
+        if (op == OP_AND && a.state == CONSTANT && !is_true(a)) return int_value(0);
+        if (op == OP_OR && a.state == CONSTANT && is_true(a)) return int_value(1);
+        if (a.state == VARYING || b.state == VARYING) return varying();
+        if (a.state == UNDEFINED || b.state == UNDEFINED) return undefined();
+
+        switch (op) {
+            case OP_LT: return int_value(as_double(a) < as_double(b));
+            case OP_LE: return int_value(as_double(a) <= as_double(b));
+            case OP_GT: return int_value(as_double(a) > as_double(b));
+            case OP_GE: return int_value(as_double(a) >= as_double(b));
+            case OP_EQ: return int_value(as_double(a) == as_double(b));
+            case OP_NE: return int_value(as_double(a) != as_double(b));
+            case OP_AND: return int_value(is_true(a) && is_true(b));
+            case OP_OR: return int_value(is_true(a) || is_true(b));
+            default: break;
+        }
+
+        if (a.type == TYPE_INT && b.type == TYPE_INT) {
+            long long x = a.int_value, y = b.int_value;
+            switch (op) {
+                case OP_ADD: return int_value(x + y);
+                case OP_SUB: return int_value(x - y);
+                case OP_MUL: return int_value(x * y);
+                case OP_DIV:
+                case OP_MOD:
+                    if (y == 0 || (x == INT_MIN && y == -1)) return varying();
+                    return int_value(op == OP_DIV ? x / y : x % y);
+                case OP_SHL: return int_value((long long)((uint32_t)x << (y & 31)));
+                case OP_SHR: return int_value((long long)((int32_t)x >> (y & 31)));
+                case OP_BITAND: return int_value(x & y);
+                case OP_MULHI: return int_value((x * y) >> 32);
+                default: return varying();
+            }
+        }
+
+        float x = (float)as_double(a), y = (float)as_double(b);
+        switch (op) {
+            case OP_ADD: return float_value(x + y);
+            case OP_SUB: return float_value(x - y);
+            case OP_MUL: return float_value(x * y);
+            case OP_DIV: return y == 0 ? varying() : float_value(x / y);
+            default: return varying();
+        }
+    }
+
+    static lattice_value fold_unary(tac_opcode op, const lattice_value& a) {
+        if (a.state != CONSTANT) return a;
+        switch (op) {
+            case OP_NEG: return a.type == TYPE_INT ? int_value(-a.int_value) : float_value(-a.float_value);
+            case OP_POS: return a;
+            default: return int_value(!is_true(a));
+        }
+    }
+
+    // Value an instruction gives its destination
+    lattice_value evaluate(const tac_instr& in) const {
+        switch (in.op) {
+            case OP_COPY: return value_of(in.src1);
+            case OP_NEG:
+            case OP_POS:
+            case OP_NOT: return fold_unary(in.op, value_of(in.src1));
+            case OP_LOAD:
+            case OP_CALL: return varying();
+            default: return fold_binary(in.op, value_of(in.src1), value_of(in.src2));
+        }
+    }
+
+    static bool is_computation(tac_opcode op) {
+        return op <= OP_NOT;
+    }
+
+    // Whether a conditional branch jumps, as a lattice value (int 1 or 0 when known)
+    lattice_value branch_taken(const tac_instr& in) const {
+        tac_opcode relation = branch_relation(in.op);
+        lattice_value cond = relation == OP_COPY ? value_of(in.src1)
+                                                 : fold_binary(relation, value_of(in.src1), value_of(in.src2));
+        if (cond.state != CONSTANT) return cond;
+        return int_value(is_true(cond) == branch_sense(in.op));
+    }
+
+    void transfer(const tac_instr& in) {
+        if (in.op == OP_CALL) {
+            // The callee may assign any global
+            for (uint32_t s : global_slots) state[s] = varying();
+        }
+        if (!is_computation(in.op) && in.op != OP_LOAD && in.op != OP_CALL) return;
+        uint32_t s = values.scalar_slot(in.dst);
+        if (s != no_slot) state[s] = convert(evaluate(in), declared_type(s));
+    }
+
+    // Fills entry_begin and entry_slots. A scalar is read on entry to a block if the
+    // block reads it before assigning it, or if it reaches the end of the block
+    // unassigned and is read on entry to a successor.
+    void find_entry_slots(const tac_function& func, const control_flow_graph& cfg) {
+        size_t num_blocks = cfg.blocks.size();
+        vector<pair<uint32_t, uint32_t>> reads, writes;     // slot, block
+        vector<uint32_t> written(values.size(), no_block);  // by slot, last block assigning it
+        for (uint32_t b = 0; b < num_blocks; b++) {
+            for (uint32_t i = cfg.blocks[b].begin; i < cfg.blocks[b].end; i++) {
+                const tac_instr& in = func.code[i];
+                if (in.op == OP_DECL) continue;
+                for (const tac_operand* opnd : {&in.src1, &in.src2}) {
+                    uint32_t s = values.scalar_slot(*opnd);
+                    if (s != no_slot && written[s] != b) reads.push_back(make_pair(s, b));
+                }
+                uint32_t d = liveness::defined(in, values);
+                if (d != no_slot && written[d] != b) {
+                    written[d] = b;
+                    writes.push_back(make_pair(d, b));
+                }
+            }
+        }
+        sort(reads.begin(), reads.end());
+        reads.erase(unique(reads.begin(), reads.end()), reads.end());
+        sort(writes.begin(), writes.end());
+
+        // Walk back from the reads of each scalar, stopping at blocks that assign it
+        vector<pair<uint32_t, uint32_t>> entries;           // block, slot
+        vector<uint32_t> assigns(num_blocks, no_slot), seen(num_blocks, no_slot), stack;
+        size_t w = 0;
+        for (size_t r = 0; r < reads.size();) {
+            uint32_t s = reads[r].first;
+            for (; w < writes.size() && writes[w].first <= s; w++) {
+                if (writes[w].first == s) assigns[writes[w].second] = s;
+            }
+            for (; r < reads.size() && reads[r].first == s; r++) {
+                seen[reads[r].second] = s;
+                stack.push_back(reads[r].second);
+            }
+            while (!stack.empty()) {
+                uint32_t b = stack.back();
+                stack.pop_back();
+                entries.push_back(make_pair(b, s));
+                for (uint32_t p = cfg.blocks[b].pred_begin; p < cfg.blocks[b].pred_end; p++) {
+                    uint32_t pred = cfg.preds[p];
+                    if (seen[pred] != s && assigns[pred] != s) {
+                        seen[pred] = s;
+                        stack.push_back(pred);
+                    }
+                }
+            }
+        }
+
+        entry_begin.assign(num_blocks + 1, 0);
+        for (const pair<uint32_t, uint32_t>& e : entries) entry_begin[e.first + 1]++;
+        for (size_t b = 0; b < num_blocks; b++) entry_begin[b + 1] += entry_begin[b];
+        entry_slots.resize(entries.size());
+        vector<uint32_t> next(entry_begin.begin(), entry_begin.end() - 1);
+        for (const pair<uint32_t, uint32_t>& e : entries) entry_slots[next[e.first]++] = e.second;
+    }
+
+    // Sets state to the values on entry to b; other slots are assigned before use
+    void enter(uint32_t b) {
+        for (uint32_t k = entry_begin[b]; k < entry_begin[b + 1]; k++) state[entry_slots[k]] = block_in[k];
+    }
+
+    void reach(uint32_t b) {
+        bool changed = !reached[b];
+        if (!reached[b]) {
+            reached[b] = 1;
+            for (uint32_t k = entry_begin[b]; k < entry_begin[b + 1]; k++) block_in[k] = state[entry_slots[k]];
+        } else {
+            for (uint32_t k = entry_begin[b]; k < entry_begin[b + 1]; k++) {
+                lattice_value v = meet(block_in[k], state[entry_slots[k]]);
+                if (!(v == block_in[k])) {
+                    block_in[k] = v;
+                    changed = true;
+                }
+            }
+        }
+        if (changed && !queued[b]) {
+            queued[b] = 1;
+            pending = true;
+        }
+    }
+
+    void analyze(const tac_function& func, const control_flow_graph& cfg) {
+        find_entry_slots(func, cfg);
+        block_in.assign(entry_slots.size(), undefined());
+        reached.assign(cfg.blocks.size(), 0);
+        queued.assign(cfg.blocks.size(), 0);
+        global_slots.clear();
+        for (uint32_t s = 0; s < values.size(); s++) {
+            if (values.is_global[s] && !values.is_array[s]) global_slots.push_back(s);
+        }
+
+        // Nothing is known about parameters, globals and uninitialized locals on entry
+        state.assign(values.size(), undefined());
+        for (uint32_t s = 0; s < values.size(); s++) {
+            if (values.operands[s].kind == OPND_VAR) state[s] = varying();
+        }
+        reach(0);
+
+        // Each sweep evaluates the queued blocks; blocks queued behind the sweep, by
+        // loops, wait for the next one
+        while (pending) {
+            pending = false;
+            for (uint32_t b : cfg.rpo) {
+                if (!queued[b]) continue;
+                queued[b] = 0;
+
+                const basic_block& block = cfg.blocks[b];
+                enter(b);
+                for (uint32_t i = block.begin; i < block.end; i++) transfer(func.code[i]);
+
+                const tac_instr* last = block.begin < block.end ? &func.code[block.end - 1] : nullptr;
+                if (last && is_cond_branch(last->op)) {
+                    lattice_value cond = branch_taken(*last);
+                    if (cond.state == UNDEFINED) continue;
+                    if (cond.state == VARYING || is_true(cond)) reach(cfg.jump_target(b));
+                    if ((cond.state == VARYING || !is_true(cond)) && cfg.fall_through(b) != no_block) reach(cfg.fall_through(b));
+                } else {
+                    for (uint32_t s = 0; s < block.num_succs; s++) reach(block.succs[s]);
+                }
+            }
+        }
+    }
+
+    tac_operand constant_operand(const lattice_value& v) {
+        return v.type == TYPE_INT ? prog.int_constant(v.int_value) : prog.float_constant(v.float_value);
+    }
+
+    // Replaces a temporary or variable operand known to be constant
+    void substitute(tac_operand& opnd) {
+        uint32_t s = values.scalar_slot(opnd);
+        if (s != no_slot && state[s].state == CONSTANT) {
+            opnd = constant_operand(state[s]);
+            substituted++;
+        }
+    }
+
+    void rewrite(tac_function& func, const control_flow_graph& cfg) {
+        vector<tac_instr>& code = func.code;
+        vector<uint8_t> removed(code.size(), 0);
+        bool any_removed = false;
+
+        for (uint32_t b = 0; b < cfg.blocks.size(); b++) {
+            if (!reached[b]) continue;
+            enter(b);
+            for (uint32_t i = cfg.blocks[b].begin; i < cfg.blocks[b].end; i++) {
+                tac_instr& in = code[i];
+                lattice_value result = varying();
+                uint32_t dst = values.scalar_slot(in.dst);
+                if (is_computation(in.op) && dst != no_slot) result = convert(evaluate(in), declared_type(dst));
+
+                if (is_cond_branch(in.op)) {
+                    lattice_value cond = branch_taken(in);
+                    if (cond.state == CONSTANT) {
+                        if (is_true(cond)) in = tac_instr{OP_GOTO, tac_operand(), in.dst, tac_operand()};
+                        else removed[i] = any_removed = true;
+                        branches++;
+                        continue;
+                    }
+                }
+
+                if (result.state == CONSTANT && !(in.op == OP_COPY && in.src1.kind == OPND_CONST)) {
+                    transfer(in);
+                    in = tac_instr{OP_COPY, in.dst, constant_operand(result), tac_operand()};
+                    folded++;
+                    continue;
+                }
+
+                switch (in.op) {
+                    case OP_LOAD: substitute(in.src2); break;
+                    case OP_STORE: substitute(in.src1); substitute(in.src2); break;
+                    case OP_PARAM:
+                    case OP_RETURN:
+                    case OP_PRINT: substitute(in.src1); break;
+                    default:
+                        if (is_computation(in.op) || is_cond_branch(in.op)) {
+                            substitute(in.src1);
+                            substitute(in.src2);
+                        }
+                        break;
+                }
+                transfer(in);
+            }
+        }
+
+        if (any_removed) {
+            size_t kept = 0;
+            for (size_t i = 0; i < code.size(); i++) {
+                if (!removed[i]) code[kept++] = code[i];
+            }
+            code.resize(kept);
+        }
+    }
+
+public:
+    size_t folded = 0;          // instructions replaced by a constant copy
+    size_t substituted = 0;     // operands replaced by a constant
+    size_t branches = 0;        // branches decided at compile time
+
+    constant_propagation(tac_program& prog) : prog(prog), values(prog) {}
+
+    void run(tac_function& func, const control_flow_graph& cfg) {
+        folded = substituted = branches = 0;
+        values.build(func);
+        analyze(func, cfg);
+        rewrite(func, cfg);
+    }
+};
+
+#endif // CONST_PROP_H
@@ -0,0 +1,96 @@
+#ifndef DEAD_CODE_H
+#define DEAD_CODE_H
+
+#include <cstdint>
+#include <vector>
+
+#include "cfg.h"
+#include "ir.h"
+#include "liveness.h"
+
+using namespace std;
+
+// Removes the blocks no path from the entry reaches (code after a return or behind
+// a branch constant propagation decided) and the computations whose result is never
+// read, which includes stores to a variable that is assigned again before any use.
+// Removing an instruction can make the ones feeding it dead, so liveness is redone
+// until nothing more goes. Calls and array stores always stay.
+
+class dead_code_elimination
+{
+private:
+    tac_program& prog;
+    tac_values values;
+    liveness live;
+    vector<uint8_t> removed;
+    vector<uint64_t> scratch;
+
+    // Computations and loads, which only write their destination
+    static bool is_pure(tac_opcode op) {
+        return op <= OP_LOAD;
+    }
+
+    bool is_dead(const tac_instr& in, const uint64_t* live_after) const {
+        if (in.op == OP_COPY && in.dst == in.src1) return true;
+        if (!is_pure(in.op)) return false;
+        uint32_t d = liveness::defined(in, values);
+        return d != no_slot && !liveness::test(live_after, d);
+    }
+
+    // One backward sweep over every reachable block; true if anything was removed
+    bool sweep(const tac_function& func, const control_flow_graph& cfg) {
+        bool any = false;
+        for (uint32_t b : cfg.rpo) {
+            const basic_block& block = cfg.blocks[b];
+            for (size_t w = 0; w < live.words; w++) scratch[w] = live.live_out[b * live.words + w];
+            for (uint32_t i = block.end; i-- > block.begin;) {
+                if (removed[i]) continue;
+                if (is_dead(func.code[i], scratch.data())) {
+                    removed[i] = 1;
+                    dead++;
+                    any = true;
+                    continue;
+                }
+                live.step(func.code[i], values, scratch.data());
+            }
+        }
+        return any;
+    }
+
+public:
+    size_t unreachable = 0;     // instructions in blocks that never execute
+    size_t dead = 0;            // computations whose result is never used
+
+    dead_code_elimination(tac_program& prog) : prog(prog), values(prog) {}
+
+    void run(tac_function& func, const control_flow_graph& cfg) {
+        unreachable = dead = 0;
+        vector<tac_instr>& code = func.code;
+        removed.assign(code.size(), 0);
+
+        // Declarations stay so the variable list of the function is unchanged
+        for (uint32_t b = 0; b < cfg.blocks.size(); b++) {
+            if (cfg.reachable(b)) continue;
+            for (uint32_t i = cfg.blocks[b].begin; i < cfg.blocks[b].end; i++) {
+                if (code[i].op == OP_DECL) continue;
+                removed[i] = 1;
+                unreachable++;
+            }
+        }
+
+        values.build(func);
+        do {
+            live.run(func, cfg, values, &removed);
+            scratch.resize(live.words);
+        } while (sweep(func, cfg));
+
+        if (unreachable + dead == 0) return;
+        size_t kept = 0;
+        for (size_t i = 0; i < code.size(); i++) {
+            if (!removed[i]) code[kept++] = code[i];
+        }
+        code.resize(kept);
+    }
+};
+
+#endif // DEAD_CODE_H
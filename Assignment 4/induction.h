@@ -0,0 +1,409 @@
+#ifndef INDUCTION_H
+#define INDUCTION_H
+
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <vector>
+
+#include "cfg.h"
+#include "ir.h"
+#include "liveness.h"
+
+using namespace std;
+
+// Strength reduction of induction variables. A basic induction variable is an int
+// scalar a loop assigns once, by adding a constant to itself, either directly or
+// through a temporary (next = i + 1; i = next, as i++ is lowered). A product of
+// one with an invariant factor becomes a copy of a new temporary that starts at
+// i * factor in the preheader and is bumped by step * factor right after i's
+// assignment, so the loop no longer multiplies.
+//
+// Linear-function test replacement then rewrites an exit test "i < n" with constant
+// n as "temp < n * factor" when the factor is a positive constant and i starts
+// from a constant, so neither side can overflow. If i is then read nowhere else,
+// its increment goes away.
+
+static const uint32_t no_instr = UINT32_MAX;
+
+class strength_reduction
+{
+private:
+    // i changes by step once per iteration: i = i + step, or next = i + step; i = next
+    struct induction
+    {
+        tac_operand var, next;      // next is none for the single instruction form
+        uint32_t var_def, next_def; // positions of the assignments, next_def no_instr if none
+        long long step;
+    };
+
+    // Temporary kept equal to var * factor
+    struct reduced
+    {
+        uint32_t iv;                // index in ivs
+        tac_operand factor, temp;
+    };
+
+    // Instruction added before (pos 2 * i) or after (pos 2 * i + 1) instruction i
+    struct insertion
+    {
+        uint32_t pos;
+        tac_instr instr;
+    };
+
+    tac_program& prog;
+    tac_values values;
+    liveness live;
+    vector<uint32_t> block_of;      // by instruction
+    vector<uint8_t> removed;        // by instruction
+    vector<uint8_t> rewritten;      // by instruction, already changed for an inner loop
+    vector<uint32_t> defs;          // by slot, assignments in the current loop
+    vector<uint32_t> def_at;        // by slot, position of the last of them
+    vector<uint32_t> uses;          // by slot, reads in the current loop
+    vector<pair<uint32_t, uint32_t>> pinned; // slot and block of each read by inserted code
+    vector<induction> ivs;
+    vector<reduced> temps;
+    vector<insertion> inserts;
+    bool has_call = false;
+
+    static long long wrap(long long v) {
+        return (long long)(int32_t)(uint32_t)v;
+    }
+
+    bool int_constant(const tac_operand& opnd, long long& v) const {
+        if (opnd.kind != OPND_CONST || prog.constants[opnd.id].type != TYPE_INT) return false;
+        v = prog.constants[opnd.id].int_value;
+        return true;
+    }
+
+    bool is_int_scalar(const tac_operand& opnd) const {
+        uint32_t s = values.scalar_slot(opnd);
+        return s != no_slot && !values.is_global[s] && values.types[s] == TYPE_INT;
+    }
+
+    // Whether the instruction at position i runs after the one at d in every iteration
+    bool runs_after(const control_flow_graph& cfg, uint32_t d, uint32_t i) const {
+        if (block_of[d] == block_of[i]) return i > d;
+        return cfg.dominates(block_of[d], block_of[i]);
+    }
+
+    // Induction variable an operand read at position i is equal to, no_instr if none
+    uint32_t match(const control_flow_graph& cfg, const tac_operand& opnd, uint32_t i) const {
+        for (uint32_t k = 0; k < ivs.size(); k++) {
+            if (opnd == ivs[k].var) return k;
+            if (opnd == ivs[k].next && runs_after(cfg, ivs[k].var_def, i)) return k;
+        }
+        return no_instr;
+    }
+
+    bool is_factor(const tac_operand& opnd) const {
+        long long v;
+        if (int_constant(opnd, v)) return true;
+        uint32_t s = values.scalar_slot(opnd);
+        if (s == no_slot || defs[s] != 0 || values.types[s] != TYPE_INT) return false;
+        return !(values.is_global[s] && has_call);
+    }
+
+    void read_operand(const tac_operand& opnd) {
+        uint32_t s = values.slot(opnd);
+        if (s != no_slot) uses[s]++;
+    }
+
+    void count(const tac_function& func, const control_flow_graph& cfg, uint32_t l) {
+        defs.assign(values.size(), 0);
+        def_at.assign(values.size(), no_instr);
+        uses.assign(values.size(), 0);
+        has_call = false;
+        const tac_loop& loop = cfg.loops[l];
+        for (uint32_t k = loop.block_begin; k < loop.block_end; k++) {
+            const basic_block& block = cfg.blocks[cfg.loop_blocks[k]];
+            for (uint32_t i = block.begin; i < block.end; i++) {
+                const tac_instr& in = func.code[i];
+                if (removed[i]) continue;
+                if (in.op == OP_CALL) has_call = true;
+
+                // A store counts for the array, a declaration for the variable
+                uint32_t s = values.slot(in.dst);
+                if (s != no_slot) {
+                    defs[s]++;
+                    def_at[s] = i;
+                }
+                if (in.op == OP_DECL) continue;
+                read_operand(in.src1);
+                read_operand(in.src2);
+            }
+        }
+    }
+
+    // Step of an increment of var (var + k, k + var or var - k), false if it is not one
+    bool increment_of(const tac_instr& in, const tac_operand& var, long long& step) const {
+        long long k;
+        if (in.op == OP_ADD && in.src1 == var && int_constant(in.src2, k)) step = k;
+        else if (in.op == OP_ADD && in.src2 == var && int_constant(in.src1, k)) step = k;
+        else if (in.op == OP_SUB && in.src1 == var && int_constant(in.src2, k)) step = -k;
+        else return false;
+        return step != 0;
+    }
+
+    void find_ivs(const tac_function& func, const control_flow_graph& cfg, uint32_t l) {
+        ivs.clear();
+        const tac_loop& loop = cfg.loops[l];
+        for (uint32_t k = loop.block_begin; k < loop.block_end; k++) {
+            const basic_block& block = cfg.blocks[cfg.loop_blocks[k]];
+            for (uint32_t i = block.begin; i < block.end; i++) {
+                const tac_instr& in = func.code[i];
+                if (removed[i] || !is_int_scalar(in.dst) || defs[values.slot(in.dst)] != 1) continue;
+                long long step;
+                if (increment_of(in, in.dst, step)) {
+                    ivs.push_back(induction{in.dst, tac_operand(), i, no_instr, step});
+                    continue;
+                }
+                if (in.op != OP_COPY || in.src1.kind != OPND_TEMP || !is_int_scalar(in.src1)) continue;
+                uint32_t next = values.slot(in.src1);
+                uint32_t n = def_at[next];
+                if (defs[next] != 1 || block_of[n] != block_of[i] || n > i) continue;
+                if (increment_of(func.code[n], in.dst, step)) {
+                    ivs.push_back(induction{in.dst, in.src1, i, n, step});
+                }
+            }
+        }
+    }
+
+    // Temporary equal to ivs[iv].var * factor, created on first use
+    const reduced& reduce(uint32_t iv, const tac_operand& factor) {
+        for (const reduced& r : temps) {
+            if (r.iv == iv && r.factor == factor) return r;
+        }
+        temps.push_back(reduced{iv, factor, tac_operand(OPND_TEMP, prog.num_temps++)});
+        return temps.back();
+    }
+
+    void reduce_products(tac_function& func, const control_flow_graph& cfg, uint32_t l) {
+        const tac_loop& loop = cfg.loops[l];
+        for (uint32_t k = loop.block_begin; k < loop.block_end; k++) {
+            const basic_block& block = cfg.blocks[cfg.loop_blocks[k]];
+            for (uint32_t i = block.begin; i < block.end; i++) {
+                tac_instr& in = func.code[i];
+                if (removed[i] || rewritten[i] || in.op != OP_MUL || values.slot(in.dst) == no_slot) continue;
+                for (int side = 0; side < 2; side++) {
+                    const tac_operand& var = side == 0 ? in.src1 : in.src2;
+                    const tac_operand& factor = side == 0 ? in.src2 : in.src1;
+                    uint32_t iv = match(cfg, var, i);
+                    if (iv == no_instr || !is_factor(factor)) continue;
+                    uses[values.slot(var)]--;
+                    in = tac_instr{OP_COPY, in.dst, reduce(iv, factor).temp, tac_operand()};
+                    rewritten[i] = 1;
+                    products++;
+                    break;
+                }
+            }
+        }
+    }
+
+    // Constant initial value of an induction variable, from the block that falls
+    // into the preheader when that is the only way into the loop
+    bool initial_value(const tac_function& func, const control_flow_graph& cfg, uint32_t l,
+                       const tac_operand& var, long long& value) const {
+        uint32_t header = cfg.loops[l].header;
+        const basic_block& block = cfg.blocks[header];
+        if (cfg.fall_through(header - 1) != header || cfg.loop_contains(l, header - 1)) return false;
+        for (uint32_t p = block.pred_begin; p < block.pred_end; p++) {
+            uint32_t pred = cfg.preds[p];
+            if (!cfg.loop_contains(l, pred) && (pred != header - 1 || cfg.fall_through(pred) != header)) return false;
+        }
+        const basic_block& entry = cfg.blocks[header - 1];
+        for (uint32_t i = entry.end; i-- > entry.begin;) {
+            const tac_instr& in = func.code[i];
+            if (in.dst != var || in.op == OP_DECL) continue;
+            return in.op == OP_COPY && int_constant(in.src1, value);
+        }
+        return false;
+    }
+
+    static tac_opcode mirrored(tac_opcode relation) {
+        switch (relation) {
+            case OP_LT: return OP_GT;
+            case OP_LE: return OP_GE;
+            case OP_GT: return OP_LT;
+            case OP_GE: return OP_LE;
+            default: return relation;
+        }
+    }
+
+    // Rewrites the exit tests of the loop on ivs[iv] to compare r.temp instead
+    void replace_tests(tac_function& func, const control_flow_graph& cfg, uint32_t l, const reduced& r) {
+        const induction& iv = ivs[r.iv];
+        long long factor, start;
+        if (!int_constant(r.factor, factor) || factor <= 0) return;
+        if (!initial_value(func, cfg, l, iv.var, start)) return;
+
+        const tac_loop& loop = cfg.loops[l];
+        uint32_t header = loop.header;
+        for (uint32_t k = loop.block_begin; k < loop.block_end; k++) {
+            uint32_t b = cfg.loop_blocks[k];
+            const basic_block& block = cfg.blocks[b];
+            tac_instr& test = func.code[block.end - 1];
+            tac_opcode relation = branch_relation(test.op);
+            if (!is_cond_branch(test.op) || rewritten[block.end - 1] || relation == OP_COPY) continue;
+
+            // i rel n, or n rel i read the other way
+            bool var_left = match(cfg, test.src1, block.end - 1) == r.iv;
+            long long bound;
+            if (var_left ? !int_constant(test.src2, bound) : !int_constant(test.src1, bound)) continue;
+            if (!var_left && match(cfg, test.src2, block.end - 1) != r.iv) continue;
+            if (!var_left) relation = mirrored(relation);
+
+            // The loop must go on exactly while the relation holds, and the test
+            // must run in every iteration
+            uint32_t holds = branch_sense(test.op) ? cfg.jump_target(b) : cfg.fall_through(b);
+            uint32_t fails = branch_sense(test.op) ? cfg.fall_through(b) : cfg.jump_target(b);
+            if (holds == no_block || fails == no_block || holds == fails) continue;
+            if (!cfg.loop_contains(l, holds) || cfg.loop_contains(l, fails)) continue;
+            bool every_iteration = true;
+            for (uint32_t p = cfg.blocks[header].pred_begin; p < cfg.blocks[header].pred_end; p++) {
+                uint32_t pred = cfg.preds[p];
+                if (cfg.loop_contains(l, pred) && !cfg.dominates(b, pred)) every_iteration = false;
+            }
+            if (!every_iteration) continue;
+
+            // The test bounds i from the side it moves towards; with the start that
+            // keeps i * factor inside int
+            bool up = relation == OP_LT || relation == OP_LE;
+            bool down = relation == OP_GT || relation == OP_GE;
+            if (!(iv.step > 0 ? up : down)) continue;
+            long long step = iv.step > 0 ? iv.step : -iv.step;
+            long long low = min(start, bound) - step, high = max(start, bound) + step;
+            if (low * factor < INT_MIN || high * factor > INT_MAX) continue;
+
+            tac_operand& var = var_left ? test.src1 : test.src2;
+            tac_operand& limit = var_left ? test.src2 : test.src1;
+            uses[values.slot(var)]--;
+            var = r.temp;
+            limit = prog.int_constant(bound * factor);
+            rewritten[block.end - 1] = 1;
+            tests++;
+        }
+    }
+
+    bool live_after_loop(const control_flow_graph& cfg, uint32_t l, uint32_t s) const {
+        const tac_loop& loop = cfg.loops[l];
+        for (uint32_t k = loop.block_begin; k < loop.block_end; k++) {
+            const basic_block& block = cfg.blocks[cfg.loop_blocks[k]];
+            for (uint32_t n = 0; n < block.num_succs; n++) {
+                uint32_t succ = block.succs[n];
+                if (!cfg.loop_contains(l, succ) && liveness::test(&live.live_in[succ * live.words], s)) return true;
+            }
+        }
+        return false;
+    }
+
+    // Drops the increment of an induction variable nothing reads any more
+    void remove_if_unused(const control_flow_graph& cfg, uint32_t l, const induction& iv) {
+        uint32_t var = values.slot(iv.var);
+        if (uses[var] != 1 || is_pinned(cfg, l, var) || live_after_loop(cfg, l, var)) return;
+        if (!iv.next.is_none()) {
+            uint32_t next = values.slot(iv.next);
+            if (uses[next] != 1 || is_pinned(cfg, l, next) || live_after_loop(cfg, l, next)) return;
+            removed[iv.next_def] = 1;
+        }
+        removed[iv.var_def] = 1;
+        increments++;
+    }
+
+    // What inserted code reads must stay, for the enclosing loops
+    void insert(uint32_t pos, const tac_instr& in) {
+        inserts.push_back(insertion{pos, in});
+        pin(in.src1, block_of[pos / 2]);
+        pin(in.src2, block_of[pos / 2]);
+    }
+
+    void pin(const tac_operand& opnd, uint32_t b) {
+        uint32_t s = values.slot(opnd);
+        if (s != no_slot) pinned.push_back(make_pair(s, b));
+    }
+
+    bool is_pinned(const control_flow_graph& cfg, uint32_t l, uint32_t s) const {
+        for (const pair<uint32_t, uint32_t>& pin : pinned) {
+            if (pin.first == s && cfg.loop_contains(l, pin.second)) return true;
+        }
+        return false;
+    }
+
+    void reduce_loop(tac_function& func, const control_flow_graph& cfg, uint32_t l) {
+        count(func, cfg, l);
+        find_ivs(func, cfg, l);
+        if (ivs.empty()) return;
+        temps.clear();
+        reduce_products(func, cfg, l);
+        if (temps.empty()) return;
+        for (const reduced& r : temps) replace_tests(func, cfg, l, r);
+        for (const induction& iv : ivs) remove_if_unused(cfg, l, iv);
+
+        // Preheader: each temporary starts at var * factor
+        uint32_t preheader = 2 * cfg.blocks[cfg.loops[l].header].begin;
+        tac_operand label = enter_through_preheader(prog, func, cfg, l);
+        if (!label.is_none()) insert(preheader, tac_instr{OP_LABEL, tac_operand(), label, tac_operand()});
+        for (const reduced& r : temps) {
+            const induction& iv = ivs[r.iv];
+            insert(preheader, tac_instr{OP_MUL, r.temp, iv.var, r.factor});
+
+            // and follows each change of var
+            long long factor;
+            tac_operand bump;
+            if (int_constant(r.factor, factor)) {
+                bump = prog.int_constant(wrap(iv.step * factor));
+            } else if (iv.step == 1) {
+                bump = r.factor;
+            } else {
+                bump = tac_operand(OPND_TEMP, prog.num_temps++);
+                insert(preheader, tac_instr{OP_MUL, bump, r.factor, prog.int_constant(iv.step)});
+            }
+            insert(2 * iv.var_def + 1, tac_instr{OP_ADD, r.temp, r.temp, bump});
+        }
+    }
+
+    void rewrite(tac_function& func) {
+        stable_sort(inserts.begin(), inserts.end(), [](const insertion& a, const insertion& b) { return a.pos < b.pos; });
+        vector<tac_instr>& code = func.code;
+        vector<tac_instr> result;
+        result.reserve(code.size() + inserts.size());
+        size_t k = 0;
+        for (uint32_t i = 0; i < code.size(); i++) {
+            for (; k < inserts.size() && inserts[k].pos == 2 * i; k++) result.push_back(inserts[k].instr);
+            if (!removed[i]) result.push_back(code[i]);
+            for (; k < inserts.size() && inserts[k].pos == 2 * i + 1; k++) result.push_back(inserts[k].instr);
+        }
+        code.swap(result);
+    }
+
+public:
+    size_t products = 0;        // multiplications replaced by a copy of a reduced temporary
+    size_t tests = 0;           // exit tests rewritten to the reduced temporary
+    size_t increments = 0;      // induction variables whose updates were dropped
+
+    strength_reduction(tac_program& prog) : prog(prog), values(prog) {}
+
+    void run(tac_function& func, const control_flow_graph& cfg) {
+        products = tests = increments = 0;
+        if (cfg.loops.empty()) return;
+
+        values.build(func);
+        live.run(func, cfg, values);
+        block_of.assign(func.code.size(), no_block);
+        for (uint32_t b = 0; b < cfg.blocks.size(); b++) {
+            for (uint32_t i = cfg.blocks[b].begin; i < cfg.blocks[b].end; i++) block_of[i] = b;
+        }
+        removed.assign(func.code.size(), 0);
+        rewritten.assign(func.code.size(), 0);
+        pinned.clear();
+        inserts.clear();
+
+        // Inner loops first, so a product moves to the innermost loop's temporary
+        for (uint32_t l = cfg.loops.size(); l-- > 0;) {
+            if (cfg.has_preheader_spot(func, l)) reduce_loop(func, cfg, l);
+        }
+        if (products > 0) rewrite(func);
+    }
+};
+
+#endif // INDUCTION_H
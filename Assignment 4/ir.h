@@ -0,0 +1,596 @@
+#ifndef IR_H
+#define IR_H
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "name_table.h"
+#include "types.h"
+
+using namespace std;
+
+// Three-address code held in memory as quadruples (opcode, dst, src1, src2), one
+// instruction vector per function. The second pass builds it from the AST, the
+// optimization passes rewrite it, and code.txt is printed from it at the end.
+
+enum tac_opcode : uint8_t
+{
+    OP_COPY,    // dst = src1
+    OP_ADD,     // dst = src1 + src2, likewise for the other binary operators
+    OP_SUB,
+    OP_MUL,
+    OP_DIV,
+    OP_MOD,
+    OP_LT,
+    OP_LE,
+    OP_GT,
+    OP_GE,
+    OP_EQ,
+    OP_NE,
+    OP_AND,
+    OP_OR,
+    OP_SHL,     // dst = src1 << src2, int only
+    OP_SHR,     // dst = src1 >> src2, arithmetic (copies the sign bit)
+    OP_BITAND,  // dst = src1 & src2, bitwise
+    OP_MULHI,   // dst = high 32 bits of the 64-bit product src1 * src2
+    OP_NEG,     // dst = -src1
+    OP_POS,     // dst = +src1
+    OP_NOT,     // dst = !src1
+    OP_LOAD,    // dst = src1[src2]
+    OP_STORE,   // dst[src1] = src2
+    OP_LABEL,   // src1:
+    OP_GOTO,    // goto src1
+    OP_IF,      // if src1 goto dst
+    OP_IF_LT,   // if src1 < src2 goto dst, likewise for the other relations
+    OP_IF_LE,
+    OP_IF_GT,
+    OP_IF_GE,
+    OP_IF_EQ,
+    OP_IF_NE,
+    OP_IFFALSE, // ifFalse src1 goto dst
+    OP_IFFALSE_LT, // ifFalse src1 < src2 goto dst, likewise for the other relations
+    OP_IFFALSE_LE,
+    OP_IFFALSE_GT,
+    OP_IFFALSE_GE,
+    OP_IFFALSE_EQ,
+    OP_IFFALSE_NE,
+    OP_PARAM,   // param src1
+    OP_CALL,    // dst = call src1, src2 (argument count)
+    OP_RETURN,  // return src1 (src1 empty for a bare return)
+    OP_PRINT,   // print src1
+    OP_DECL     // declaration of variable dst: src1 holds its type, src2 its array size (0 if scalar)
+};
+
+enum operand_kind : uint8_t
+{
+    OPND_NONE,
+    OPND_TEMP,  // id is the temporary's number
+    OPND_VAR,   // id is the interned variable name
+    OPND_CONST, // id indexes tac_program::constants
+    OPND_LABEL, // id is the label's number
+    OPND_FUNC,  // id is the interned function name
+    OPND_IMM    // id is the value itself (argument counts, declaration details)
+};
+
+struct tac_operand
+{
+    operand_kind kind = OPND_NONE;
+    uint32_t id = 0;
+
+    tac_operand() {}
+    tac_operand(operand_kind kind, uint32_t id) : kind(kind), id(id) {}
+
+    bool is_none() const { return kind == OPND_NONE; }
+    bool operator==(const tac_operand& other) const { return kind == other.kind && id == other.id; }
+    bool operator!=(const tac_operand& other) const { return !(*this == other); }
+};
+
+struct tac_instr
+{
+    tac_opcode op;
+    tac_operand dst;
+    tac_operand src1;
+    tac_operand src2;
+};
+
+// Literal as written in the source, with its value
+struct tac_constant
+{
+    string text;
+    data_type type;
+    long long int_value;
+    double float_value;
+};
+
+struct tac_function
+{
+    uint32_t name;
+    data_type return_type;
+    vector<pair<data_type, uint32_t>> params; // type and interned name (name_table::none if unnamed)
+    vector<tac_instr> code;
+    uint32_t num_temps = 0; // temporaries t0 .. t(num_temps-1) once renumbered per function, 0 before
+};
+
+// Declaration at file scope, printed before functions[position]
+struct tac_global
+{
+    tac_instr decl;
+    size_t position;
+};
+
+class tac_program
+{
+private:
+    unordered_map<string, uint32_t> constant_ids; // by spelling
+
+public:
+    vector<tac_function> functions;
+    vector<tac_global> globals;
+    vector<tac_constant> constants;
+    uint32_t num_temps = 0;
+    uint32_t num_labels = 0;
+
+    tac_operand constant(const string& text, data_type type)
+    {
+        auto found = constant_ids.find(text);
+        if (found != constant_ids.end()) return tac_operand(OPND_CONST, found->second);
+
+        tac_constant c;
+        c.text = text;
+        c.type = type;
+        c.int_value = type == TYPE_INT ? strtoll(text.c_str(), NULL, 10) : 0;
+        c.float_value = strtod(text.c_str(), NULL);
+
+        uint32_t id = constants.size();
+        constants.push_back(c);
+        constant_ids.emplace(text, id);
+        return tac_operand(OPND_CONST, id);
+    }
+
+    // Constants computed by the optimizer, spelled the way a literal would be
+    tac_operand int_constant(long long value)
+    {
+        return constant(to_string(value), TYPE_INT);
+    }
+
+    tac_operand float_constant(double value)
+    {
+        char text[32];
+        snprintf(text, sizeof(text), "%.9g", value);
+        if (strpbrk(text, ".e") == NULL) strcat(text, ".0");
+        return constant(text, TYPE_FLOAT);
+    }
+};
+
+// Appends instructions to a tac_program while the AST is walked
+
+class tac_builder
+{
+private:
+    tac_program& prog;
+    tac_function* curr_func = nullptr;
+
+    // A declaration of a name already declared as a global or earlier in the function
+    // (a parameter, a variable of an enclosing block or of a block already closed)
+    // gets a name of its own, so that every variable the code names is a single one
+    // with a single type and array size
+    vector<uint32_t> current;                   // by name id, name the code uses, none if not declared
+    vector<pair<uint32_t, uint32_t>> scope_log; // name and its previous entry in current
+    vector<size_t> scope_starts;                // scope_log size when each open scope began
+    vector<uint8_t> taken;                      // by name id, declared as a global or in this function
+    vector<uint32_t> function_names;            // names taken in this function, released at its end
+
+    bool visible(uint32_t name) const {
+        return name < current.size() && current[name] != name_table::none;
+    }
+
+    bool is_taken(uint32_t name) const {
+        return name < taken.size() && taken[name];
+    }
+
+    void take(uint32_t name) {
+        if (name >= taken.size()) taken.resize(names.size(), 0);
+        taken[name] = 1;
+        if (curr_func) function_names.push_back(name);
+    }
+
+    void bind(uint32_t name, uint32_t id) {
+        if (name >= current.size()) current.resize(names.size(), (uint32_t)name_table::none);
+        if (!scope_starts.empty()) scope_log.push_back(make_pair(name, current[name]));
+        current[name] = id;
+    }
+
+    // name_k for the first k that is no identifier yet
+    static uint32_t fresh_name(uint32_t name) {
+        for (uint32_t k = 1;; k++) {
+            string text = names.get_name(name) + "_" + to_string(k);
+            if (!names.contains(text)) return names.intern(text);
+        }
+    }
+
+public:
+    tac_builder(tac_program& prog) : prog(prog) {}
+
+    tac_program& program() { return prog; }
+
+    tac_operand new_temp() { return tac_operand(OPND_TEMP, prog.num_temps++); }
+    tac_operand new_label() { return tac_operand(OPND_LABEL, prog.num_labels++); }
+    tac_operand constant(const string& text, data_type type) { return prog.constant(text, type); }
+
+    // Operand for a variable as the source names it
+    tac_operand variable(uint32_t name) const {
+        return tac_operand(OPND_VAR, visible(name) ? current[name] : name);
+    }
+
+    void enter_scope() { scope_starts.push_back(scope_log.size()); }
+
+    void exit_scope() {
+        while (scope_log.size() > scope_starts.back()) {
+            current[scope_log.back().first] = scope_log.back().second;
+            scope_log.pop_back();
+        }
+        scope_starts.pop_back();
+    }
+
+    void begin_function(uint32_t name, data_type return_type, const vector<pair<data_type, uint32_t>>& params) {
+        prog.functions.push_back(tac_function{name, return_type, params, {}, 0});
+        curr_func = &prog.functions.back();
+        enter_scope();
+        for (const auto& param : params) {
+            if (param.second == name_table::none) continue;
+            bind(param.second, param.second);
+            if (!is_taken(param.second)) take(param.second);
+        }
+    }
+
+    void end_function() {
+        exit_scope();
+        for (uint32_t name : function_names) taken[name] = 0;
+        function_names.clear();
+        curr_func = nullptr;
+    }
+
+    void emit(tac_opcode op, tac_operand dst = tac_operand(), tac_operand src1 = tac_operand(), tac_operand src2 = tac_operand()) {
+        curr_func->code.push_back(tac_instr{op, dst, src1, src2});
+    }
+
+    void declare(uint32_t name, data_type type, int array_size) {
+        uint32_t id = is_taken(name) ? fresh_name(name) : name;
+        bind(name, id);
+        take(id);
+        tac_instr decl{OP_DECL, tac_operand(OPND_VAR, id), tac_operand(OPND_IMM, type), tac_operand(OPND_IMM, (uint32_t)array_size)};
+        if (curr_func) curr_func->code.push_back(decl);
+        else prog.globals.push_back(tac_global{decl, prog.functions.size()});
+    }
+};
+
+// Dense numbering of the temporaries and variables one function uses, so passes can
+// keep per-value tables in plain vectors. Variables also carry their declared type
+// and whether they are the function's own (parameter or local) or global; temporaries
+// get the type of the values assigned to them.
+
+static const uint32_t no_slot = UINT32_MAX;
+
+class tac_values
+{
+private:
+    const tac_program& prog;
+    vector<data_type> global_types;     // by name id, TYPE_NONE if not a global
+    vector<uint8_t> global_arrays;      // by name id
+    vector<data_type> return_types;     // by name id, for calls
+    vector<uint32_t> temp_slots;        // by temp number, no_slot outside this function
+    vector<uint32_t> var_slots;         // by name id, no_slot outside this function
+
+    uint32_t add(const tac_operand& opnd, data_type type, bool global, bool array) {
+        operands.push_back(opnd);
+        types.push_back(type);
+        is_global.push_back(global);
+        is_array.push_back(array);
+        return operands.size() - 1;
+    }
+
+    void add_var(uint32_t name, data_type type, bool array) {
+        if (var_slots[name] == no_slot) var_slots[name] = add(tac_operand(OPND_VAR, name), type, false, array);
+    }
+
+    void use(const tac_operand& opnd) {
+        if (opnd.kind == OPND_TEMP && temp_slots[opnd.id] == no_slot) {
+            temp_slots[opnd.id] = add(opnd, TYPE_NONE, false, false);
+        } else if (opnd.kind == OPND_VAR && var_slots[opnd.id] == no_slot) {
+            var_slots[opnd.id] = add(opnd, global_types[opnd.id], true, global_arrays[opnd.id]);
+        }
+    }
+
+public:
+    vector<tac_operand> operands;       // by slot
+    vector<data_type> types;            // by slot, TYPE_NONE if not known
+    vector<uint8_t> is_global;
+    vector<uint8_t> is_array;
+
+    // Type of the value an instruction assigns, TYPE_NONE if not known
+    data_type result_type(const tac_instr& in) const {
+        switch (in.op) {
+            case OP_COPY:
+            case OP_NEG:
+            case OP_POS: return type_of(in.src1);
+            case OP_LOAD: return type_of(in.src1);
+            case OP_CALL: return return_types[in.src1.id];
+            case OP_ADD:
+            case OP_SUB:
+            case OP_MUL:
+            case OP_DIV:
+            case OP_MOD: {
+                data_type a = type_of(in.src1), b = type_of(in.src2);
+                if (a == TYPE_FLOAT || b == TYPE_FLOAT) return TYPE_FLOAT;
+                return a == TYPE_INT && b == TYPE_INT ? TYPE_INT : TYPE_NONE;
+            }
+            default: return in.op <= OP_NOT ? TYPE_INT : TYPE_NONE;
+        }
+    }
+
+    tac_values(const tac_program& prog) : prog(prog) {
+        global_types.assign(names.size(), TYPE_NONE);
+        global_arrays.assign(names.size(), 0);
+        return_types.assign(names.size(), TYPE_NONE);
+        for (const tac_global& g : prog.globals) {
+            global_types[g.decl.dst.id] = (data_type)g.decl.src1.id;
+            global_arrays[g.decl.dst.id] = g.decl.src2.id != 0;
+        }
+        for (const tac_function& func : prog.functions) {
+            return_types[func.name] = func.return_type;
+        }
+    }
+
+    void build(const tac_function& func) {
+        for (const tac_operand& opnd : operands) {
+            if (opnd.kind == OPND_TEMP) temp_slots[opnd.id] = no_slot;
+            else var_slots[opnd.id] = no_slot;
+        }
+        temp_slots.resize(prog.num_temps, no_slot);
+        var_slots.resize(names.size(), no_slot);
+        global_types.resize(names.size(), TYPE_NONE);
+        global_arrays.resize(names.size(), 0);
+        operands.clear();
+        types.clear();
+        is_global.clear();
+        is_array.clear();
+
+        for (const auto& param : func.params) {
+            if (param.second != name_table::none) add_var(param.second, param.first, false);
+        }
+        for (const tac_instr& in : func.code) {
+            if (in.op == OP_DECL) add_var(in.dst.id, (data_type)in.src1.id, in.src2.id != 0);
+        }
+        for (const tac_instr& in : func.code) {
+            use(in.dst);
+            use(in.src1);
+            use(in.src2);
+        }
+
+        // Temporaries take the type of what is assigned to them; a temporary assigned
+        // values of different types has none. Repeated for temporaries read before
+        // their assignment in code order.
+        bool changed = true;
+        for (int round = 0; changed && round < 4; round++) {
+            changed = false;
+            for (const tac_instr& in : func.code) {
+                if (in.dst.kind != OPND_TEMP || in.op == OP_STORE || in.op == OP_DECL) continue;
+                uint32_t s = temp_slots[in.dst.id];
+                data_type type = result_type(in);
+                if (type == TYPE_NONE || types[s] == TYPE_ERROR || types[s] == type) continue;
+                types[s] = types[s] == TYPE_NONE ? type : TYPE_ERROR;
+                changed = true;
+            }
+        }
+        for (uint32_t s = 0; s < operands.size(); s++) {
+            if (types[s] == TYPE_ERROR) types[s] = TYPE_NONE;
+        }
+    }
+
+    data_type type_of(const tac_operand& opnd) const {
+        if (opnd.kind == OPND_CONST) return prog.constants[opnd.id].type;
+        uint32_t s = slot(opnd);
+        return s == no_slot ? TYPE_NONE : types[s];
+    }
+
+    // Slot of a temporary or variable of the function, no_slot for other operands and
+    // for temporaries created since build
+    uint32_t slot(const tac_operand& opnd) const {
+        if (opnd.kind == OPND_TEMP) return opnd.id < temp_slots.size() ? temp_slots[opnd.id] : no_slot;
+        if (opnd.kind == OPND_VAR) return var_slots[opnd.id];
+        return no_slot;
+    }
+
+    // Slot of a scalar (temporary or non-array variable), no_slot otherwise
+    uint32_t scalar_slot(const tac_operand& opnd) const {
+        uint32_t s = slot(opnd);
+        return s != no_slot && !is_array[s] ? s : no_slot;
+    }
+
+    size_t size() const {
+        return operands.size();
+    }
+};
+
+// Conditional branches: if and ifFalse, on a value or on a relation of two values
+
+inline bool is_cond_branch(tac_opcode op) {
+    return op >= OP_IF && op <= OP_IFFALSE_NE;
+}
+
+// Whether the branch jumps when its condition holds (if) rather than fails (ifFalse)
+inline bool branch_sense(tac_opcode op) {
+    return op < OP_IFFALSE;
+}
+
+// Relation a fused branch compares with (OP_LT .. OP_NE), OP_COPY for a plain value test
+inline tac_opcode branch_relation(tac_opcode op) {
+    int k = (op - OP_IF) % (OP_IFFALSE - OP_IF);
+    return k == 0 ? OP_COPY : (tac_opcode)(OP_LT + k - 1);
+}
+
+// Branch opcode testing relation (OP_COPY for a plain value), jumping when it is sense
+inline tac_opcode make_branch(bool sense, tac_opcode relation) {
+    int base = sense ? OP_IF : OP_IFFALSE;
+    return (tac_opcode)(relation == OP_COPY ? base : base + 1 + (relation - OP_LT));
+}
+
+inline bool is_relation(tac_opcode op) {
+    return op >= OP_LT && op <= OP_NE;
+}
+
+// Label a goto or conditional branch jumps to
+inline const tac_operand& jump_label(const tac_instr& in) {
+    return in.op == OP_GOTO ? in.src1 : in.dst;
+}
+
+inline tac_operand& jump_label(tac_instr& in) {
+    return in.op == OP_GOTO ? in.src1 : in.dst;
+}
+
+// Opcode of a binary operator as spelled in the source
+inline tac_opcode binary_opcode(const string& op) {
+    static const unordered_map<string, tac_opcode> opcodes = {
+        {"+", OP_ADD}, {"-", OP_SUB}, {"*", OP_MUL}, {"/", OP_DIV}, {"%", OP_MOD},
+        {"<", OP_LT}, {"<=", OP_LE}, {">", OP_GT}, {">=", OP_GE}, {"==", OP_EQ}, {"!=", OP_NE},
+        {"&&", OP_AND}, {"||", OP_OR}
+    };
+    return opcodes.at(op);
+}
+
+inline tac_opcode unary_opcode(const string& op) {
+    if (op == "-") return OP_NEG;
+    if (op == "+") return OP_POS;
+    return OP_NOT;
+}
+
+// Writes the program in the textual form of code.txt
+
+class tac_printer
+{
+private:
+    const tac_program& prog;
+    string line; // reused for every instruction
+
+    void operand(const tac_operand& opnd) {
+        switch (opnd.kind) {
+            case OPND_TEMP: line += "t"; line += to_string(opnd.id); break;
+            case OPND_VAR:
+            case OPND_FUNC: line += names.get_name(opnd.id); break;
+            case OPND_CONST: line += prog.constants[opnd.id].text; break;
+            case OPND_LABEL: line += "L"; line += to_string(opnd.id); break;
+            case OPND_IMM: line += to_string(opnd.id); break;
+            case OPND_NONE: break;
+        }
+    }
+
+    static const char* operator_text(tac_opcode op) {
+        static const char* texts[] = {"", "+", "-", "*", "/", "%", "<", "<=", ">", ">=", "==", "!=", "&&", "||",
+                                      "<<", ">>", "&", "*hi", "-", "+", "!"};
+        return texts[op];
+    }
+
+public:
+    tac_printer(const tac_program& prog) : prog(prog) {}
+
+    // Text of one instruction, valid until the next call
+    const string& instr_text(const tac_instr& in) {
+        line.clear();
+        switch (in.op) {
+            case OP_COPY:
+                operand(in.dst); line += " = "; operand(in.src1);
+                break;
+            case OP_NEG:
+            case OP_POS:
+            case OP_NOT:
+                operand(in.dst); line += " = "; line += operator_text(in.op); operand(in.src1);
+                break;
+            case OP_LOAD:
+                operand(in.dst); line += " = "; operand(in.src1); line += "["; operand(in.src2); line += "]";
+                break;
+            case OP_STORE:
+                operand(in.dst); line += "["; operand(in.src1); line += "] = "; operand(in.src2);
+                break;
+            case OP_LABEL:
+                operand(in.src1); line += ":";
+                break;
+            case OP_GOTO:
+                line += "goto "; operand(in.src1);
+                break;
+            case OP_PARAM:
+                line += "param "; operand(in.src1);
+                break;
+            case OP_CALL:
+                operand(in.dst); line += " = call "; operand(in.src1); line += ", "; operand(in.src2);
+                break;
+            case OP_RETURN:
+                line += "return";
+                if (!in.src1.is_none()) { line += " "; operand(in.src1); }
+                break;
+            case OP_PRINT:
+                line += "print "; operand(in.src1);
+                break;
+            case OP_DECL:
+                line += "// Declaration: "; line += type_name((data_type)in.src1.id); line += " "; operand(in.dst);
+                if (in.src2.id != 0) { line += "["; operand(in.src2); line += "]"; }
+                break;
+            default:
+                if (is_cond_branch(in.op)) {
+                    line += branch_sense(in.op) ? "if " : "ifFalse ";
+                    operand(in.src1);
+                    if (branch_relation(in.op) != OP_COPY) {
+                        line += " "; line += operator_text(branch_relation(in.op)); line += " ";
+                        operand(in.src2);
+                    }
+                    line += " goto "; operand(in.dst);
+                    break;
+                }
+                operand(in.dst); line += " = "; operand(in.src1);
+                line += " "; line += operator_text(in.op); line += " ";
+                operand(in.src2);
+                break;
+        }
+        return line;
+    }
+
+    void print_instr(const tac_instr& in, ostream& out) {
+        instr_text(in);
+        line += "\n";
+        out.write(line.data(), line.size());
+    }
+
+    void print_function(const tac_function& func, ostream& out) {
+        out << endl << "// Function: " << type_name(func.return_type) << " " << names.get_name(func.name) << "(";
+        for (size_t i = 0; i < func.params.size(); i++) {
+            out << type_name(func.params[i].first) << " ";
+            if (func.params[i].second != name_table::none) out << names.get_name(func.params[i].second);
+            if (i < func.params.size() - 1) out << ", ";
+        }
+        out << ")" << endl;
+
+        for (const tac_instr& in : func.code) {
+            print_instr(in, out);
+        }
+        out << endl;
+    }
+
+    void print_program(ostream& out) {
+        size_t next_global = 0;
+        for (size_t f = 0; f <= prog.functions.size(); f++) {
+            while (next_global < prog.globals.size() && prog.globals[next_global].position == f) {
+                print_instr(prog.globals[next_global].decl, out);
+                next_global++;
+            }
+            if (f < prog.functions.size()) print_function(prog.functions[f], out);
+        }
+    }
+};
+
+#endif // IR_H
@@ -0,0 +1,190 @@
+#ifndef LICM_H
+#define LICM_H
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "cfg.h"
+#include "ir.h"
+#include "liveness.h"
+
+using namespace std;
+
+// Loop-invariant code motion. A computation or array load inside a loop whose
+// operands are not assigned in the loop (or are assigned by another hoisted
+// instruction) moves to a preheader in front of the loop header. Loops are handled
+// outermost first, so an invariant moves as far out as it can.
+//
+// An instruction only moves when the loop assigns its destination nowhere else and
+// the old value is not read in the loop before it. If the value is read after the
+// loop, the instruction's block must dominate every exit, so it ran on each way out.
+// A division or load that might fault must also dominate the exits. Arrays stored
+// in the loop and globals of loops with calls count as assigned. Variables declared
+// in the loop are never hoisted.
+
+class loop_invariant_motion
+{
+private:
+    tac_program& prog;
+    tac_values values;
+    liveness live;
+    vector<uint32_t> defs;          // by slot, assignments in the current loop
+    vector<uint32_t> hoisted_for;   // by slot, loop whose preheader assigns it, no_loop if none
+    vector<uint32_t> moved_to;      // by instruction, loop it moves out of, no_loop if it stays
+    vector<uint32_t> order_moved;   // hoisted instructions in the order they were chosen
+    vector<uint32_t> exiting;       // blocks of the current loop with a way out of it
+    vector<uint32_t> exit_targets;
+
+    // Whether an operand holds the same value on every iteration of loop l
+    bool invariant(const tac_operand& opnd, uint32_t l) const {
+        if (opnd.kind != OPND_TEMP && opnd.kind != OPND_VAR) return true;
+        uint32_t s = values.slot(opnd);
+        return defs[s] == 0 || (defs[s] == 1 && hoisted_for[s] == l);
+    }
+
+    // Division by a variable and array loads can fault, so they must not run when
+    // the loop would not have run them
+    bool can_fault(const tac_instr& in) const {
+        if (in.op == OP_LOAD) return true;
+        if (in.op != OP_DIV && in.op != OP_MOD) return false;
+        if (in.src2.kind != OPND_CONST) return true;
+        const tac_constant& c = prog.constants[in.src2.id];
+        return c.type == TYPE_INT ? c.int_value == 0 : c.float_value == 0;
+    }
+
+    bool dominates_exits(const control_flow_graph& cfg, uint32_t b) const {
+        for (uint32_t e : exiting) {
+            if (!cfg.dominates(b, e)) return false;
+        }
+        return true;
+    }
+
+    bool live_after_loop(uint32_t s) const {
+        for (uint32_t t : exit_targets) {
+            if (liveness::test(&live.live_in[t * live.words], s)) return true;
+        }
+        return false;
+    }
+
+    bool can_hoist(const tac_function& func, const control_flow_graph& cfg, uint32_t l, uint32_t b, uint32_t i) const {
+        const tac_instr& in = func.code[i];
+        if (in.op > OP_LOAD) return false;
+        uint32_t d = values.scalar_slot(in.dst);
+        if (d == no_slot || values.is_global[d] || defs[d] != 1) return false;
+        if (!invariant(in.src1, l) || !invariant(in.src2, l)) return false;
+        if (liveness::test(&live.live_in[cfg.loops[l].header * live.words], d)) return false;
+        if ((can_fault(in) || live_after_loop(d)) && !dominates_exits(cfg, b)) return false;
+        return true;
+    }
+
+    void count_defs(const tac_function& func, const control_flow_graph& cfg, uint32_t l) {
+        defs.assign(values.size(), 0);
+        exiting.clear();
+        exit_targets.clear();
+        bool has_call = false;
+        const tac_loop& loop = cfg.loops[l];
+        for (uint32_t k = loop.block_begin; k < loop.block_end; k++) {
+            uint32_t b = cfg.loop_blocks[k];
+            const basic_block& block = cfg.blocks[b];
+            bool exits = block.num_succs == 0;
+            for (uint32_t s = 0; s < block.num_succs; s++) {
+                if (cfg.loop_contains(l, block.succs[s])) continue;
+                exits = true;
+                exit_targets.push_back(block.succs[s]);
+            }
+            if (exits) exiting.push_back(b);
+            for (uint32_t i = block.begin; i < block.end; i++) {
+                const tac_instr& in = func.code[i];
+                if (moved_to[i] != no_loop) continue;
+                if (in.op == OP_CALL) has_call = true;
+                uint32_t s = values.slot(in.dst);
+                if (s != no_slot) defs[s]++;
+            }
+        }
+        if (has_call) {
+            for (uint32_t s = 0; s < values.size(); s++) {
+                if (values.is_global[s]) defs[s]++;
+            }
+        }
+    }
+
+    void hoist_from(const tac_function& func, const control_flow_graph& cfg, uint32_t l) {
+        count_defs(func, cfg, l);
+        const tac_loop& loop = cfg.loops[l];
+        size_t count = 0;
+
+        // Blocks in reverse postorder see definitions before their uses; repeat
+        // until nothing more moves, since a later block may free an earlier one
+        vector<uint32_t> order(cfg.loop_blocks.begin() + loop.block_begin, cfg.loop_blocks.begin() + loop.block_end);
+        sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return cfg.rpo_index[a] < cfg.rpo_index[b]; });
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            for (uint32_t b : order) {
+                for (uint32_t i = cfg.blocks[b].begin; i < cfg.blocks[b].end; i++) {
+                    if (moved_to[i] != no_loop || !can_hoist(func, cfg, l, b, i)) continue;
+                    moved_to[i] = l;
+                    hoisted_for[values.slot(func.code[i].dst)] = l;
+                    order_moved.push_back(i);
+                    count++;
+                    changed = true;
+                }
+            }
+        }
+        if (count > 0) {
+            per_loop.push_back(make_pair(func.code[cfg.blocks[loop.header].begin].src1, count));
+            hoisted += count;
+        }
+    }
+
+    void rewrite(tac_function& func, const control_flow_graph& cfg) {
+        // Preheader contents by header block, and retargeted jumps into the loop
+        vector<vector<uint32_t>> preheader(cfg.blocks.size());
+        for (uint32_t i : order_moved) preheader[cfg.loops[moved_to[i]].header].push_back(i);
+
+        vector<tac_operand> new_target(cfg.blocks.size()); // by header, label of its preheader
+        for (uint32_t l = 0; l < cfg.loops.size(); l++) {
+            uint32_t header = cfg.loops[l].header;
+            if (!preheader[header].empty()) new_target[header] = enter_through_preheader(prog, func, cfg, l);
+        }
+
+        vector<tac_instr>& code = func.code;
+
+        vector<tac_instr> result;
+        result.reserve(code.size() + cfg.loops.size());
+        for (uint32_t b = 0; b < cfg.blocks.size(); b++) {
+            if (!new_target[b].is_none()) result.push_back(tac_instr{OP_LABEL, tac_operand(), new_target[b], tac_operand()});
+            for (uint32_t i : preheader[b]) result.push_back(code[i]);
+            for (uint32_t i = cfg.blocks[b].begin; i < cfg.blocks[b].end; i++) {
+                if (moved_to[i] == no_loop) result.push_back(code[i]);
+            }
+        }
+        code.swap(result);
+    }
+
+public:
+    size_t hoisted = 0;                             // instructions moved out of loops
+    vector<pair<tac_operand, size_t>> per_loop;     // header label and instructions hoisted from it
+
+    loop_invariant_motion(tac_program& prog) : prog(prog), values(prog) {}
+
+    void run(tac_function& func, const control_flow_graph& cfg) {
+        hoisted = 0;
+        per_loop.clear();
+        if (cfg.loops.empty()) return;
+
+        values.build(func);
+        live.run(func, cfg, values);
+        hoisted_for.assign(values.size(), no_loop);
+        moved_to.assign(func.code.size(), no_loop);
+        order_moved.clear();
+
+        for (uint32_t l = 0; l < cfg.loops.size(); l++) {
+            if (cfg.has_preheader_spot(func, l)) hoist_from(func, cfg, l);
+        }
+        if (hoisted > 0) rewrite(func, cfg);
+    }
+};
+
+#endif // LICM_H
@@ -0,0 +1,107 @@
+#ifndef LIVENESS_H
+#define LIVENESS_H
+
+#include <cstdint>
+#include <vector>
+
+#include "cfg.h"
+#include "ir.h"
+
+using namespace std;
+
+// Live scalars (temporaries and non-array variables) at the start and end of each
+// block, as bit sets over tac_values slots. Arrays are not tracked: element stores
+// are never considered dead. Globals are live when the function returns, and a call
+// reads them all since the callee may.
+
+class liveness
+{
+private:
+    vector<uint64_t> global_mask;
+    vector<uint64_t> scratch;
+
+public:
+    size_t words = 0;               // 64-bit words per set
+    vector<uint64_t> live_in;       // by block * words
+    vector<uint64_t> live_out;
+
+    static bool test(const uint64_t* set, uint32_t s) {
+        return (set[s >> 6] >> (s & 63)) & 1;
+    }
+
+    static void set(uint64_t* set, uint32_t s) {
+        set[s >> 6] |= (uint64_t)1 << (s & 63);
+    }
+
+    static void reset(uint64_t* set, uint32_t s) {
+        set[s >> 6] &= ~((uint64_t)1 << (s & 63));
+    }
+
+    // Scalar an instruction assigns, no_slot if none
+    static uint32_t defined(const tac_instr& in, const tac_values& values) {
+        if (in.op == OP_STORE || in.op == OP_DECL) return no_slot;
+        return values.scalar_slot(in.dst);
+    }
+
+    // Turns the set live after the instruction into the set live before it
+    void step(const tac_instr& in, const tac_values& values, uint64_t* live) const {
+        if (in.op == OP_DECL) return;
+        uint32_t d = defined(in, values);
+        if (d != no_slot) reset(live, d);
+        uint32_t s1 = values.scalar_slot(in.src1), s2 = values.scalar_slot(in.src2);
+        if (s1 != no_slot) set(live, s1);
+        if (s2 != no_slot) set(live, s2);
+        if (in.op == OP_CALL) {
+            for (size_t w = 0; w < words; w++) live[w] |= global_mask[w];
+        }
+    }
+
+    // removed, if given, marks instructions to treat as already deleted
+    void run(const tac_function& func, const control_flow_graph& cfg, const tac_values& values,
+             const vector<uint8_t>* removed = nullptr) {
+        words = (values.size() + 63) / 64;
+        global_mask.assign(words, 0);
+        for (uint32_t s = 0; s < values.size(); s++) {
+            if (values.is_global[s] && !values.is_array[s]) set(global_mask.data(), s);
+        }
+
+        size_t num_blocks = cfg.blocks.size();
+        live_in.assign(num_blocks * words, 0);
+        live_out.assign(num_blocks * words, 0);
+        scratch.resize(words);
+
+        // Backward problem: iterate the reachable blocks in postorder until stable
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            for (size_t k = cfg.rpo.size(); k-- > 0;) {
+                uint32_t b = cfg.rpo[k];
+                const basic_block& block = cfg.blocks[b];
+                uint64_t* out = &live_out[b * words];
+                const tac_instr* last = block.begin < block.end ? &func.code[block.end - 1] : nullptr;
+                if (block.num_succs == 0 || (last && last->op == OP_RETURN)) {
+                    for (size_t w = 0; w < words; w++) out[w] |= global_mask[w];
+                }
+                for (uint32_t s = 0; s < block.num_succs; s++) {
+                    const uint64_t* succ_in = &live_in[block.succs[s] * words];
+                    for (size_t w = 0; w < words; w++) out[w] |= succ_in[w];
+                }
+
+                for (size_t w = 0; w < words; w++) scratch[w] = out[w];
+                for (uint32_t i = block.end; i-- > block.begin;) {
+                    if (removed && (*removed)[i]) continue;
+                    step(func.code[i], values, scratch.data());
+                }
+                uint64_t* in = &live_in[b * words];
+                for (size_t w = 0; w < words; w++) {
+                    if (in[w] != scratch[w]) {
+                        in[w] = scratch[w];
+                        changed = true;
+                    }
+                }
+            }
+        }
+    }
+};
+
+#endif // LIVENESS_H
@@ -0,0 +1,74 @@
+#ifndef NAME_TABLE_H
+#define NAME_TABLE_H
+
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+
+// Interned identifier spellings. The lexer maps every identifier to a dense 32-bit
+// id once; the symbol table and the AST keep only the id, so name comparisons are
+// integer compares and each distinct name is stored a single time. The FNV-1a hash
+// of each spelling is computed at that point too and reused by every scope table.
+
+class name_table
+{
+private:
+    deque<string> spellings; // indexed by id, a deque never moves its elements
+    unordered_map<string_view, uint32_t> ids; // keys view into spellings
+    vector<uint32_t> hashes; // indexed by id
+
+    static uint32_t fnv1a(string_view text)
+    {
+        uint32_t hash = 2166136261u;
+        for(size_t i = 0; i < text.size(); i++)
+        {
+            hash ^= (unsigned char)text[i];
+            hash *= 16777619u;
+        }
+        return hash;
+    }
+
+public:
+    static const uint32_t none = UINT32_MAX; // "no name", e.g. an unnamed parameter
+
+    uint32_t intern(string_view text)
+    {
+        auto found = ids.find(text);
+        if(found != ids.end()) return found->second;
+
+        uint32_t id = spellings.size();
+        spellings.emplace_back(text);
+        hashes.push_back(fnv1a(text));
+        ids.emplace(string_view(spellings.back()), id);
+        return id;
+    }
+
+    bool contains(string_view text) const
+    {
+        return ids.count(text) != 0;
+    }
+
+    const string& get_name(uint32_t id)
+    {
+        return spellings[id];
+    }
+
+    uint32_t get_hash(uint32_t id)
+    {
+        return hashes[id];
+    }
+
+    size_t size()
+    {
+        return spellings.size();
+    }
+};
+
+extern name_table names;
+
+#endif // NAME_TABLE_H
@@ -0,0 +1,139 @@
+#ifndef OPTIMIZER_H
+#define OPTIMIZER_H
+
+#include <ostream>
+#include <vector>
+
+#include "algebra.h"
+#include "cfg.h"
+#include "const_prop.h"
+#include "dead_code.h"
+#include "induction.h"
+#include "ir.h"
+#include "licm.h"
+#include "peephole.h"
+#include "temp_alloc.h"
+#include "value_number.h"
+
+using namespace std;
+
+// Runs the optimization passes over every function of a tac_program. The control-flow
+// graph is rebuilt before each pass that needs it, since passes rewrite jumps. When a
+// report stream is given, each pass that changed a function says what it did.
+
+class tac_optimizer
+{
+private:
+    tac_program& prog;
+    ostream* report;
+    control_flow_graph cfg;
+    vector<uint32_t> label_block;
+
+    constant_propagation const_prop;
+    algebraic_simplifier algebra;
+    value_numbering value_number;
+    dead_code_elimination dead_code;
+    loop_invariant_motion licm;
+    strength_reduction strength;
+    jump_peephole peephole;
+    temp_allocator temp_alloc;
+
+    const tac_function* reported = nullptr; // function whose report heading is written
+
+    // Report stream for a line about func, headed by the function's name once
+    ostream& note(const tac_function& func) {
+        if (reported != &func) {
+            *report << "Optimizing " << names.get_name(func.name) << ":" << endl;
+            reported = &func;
+        }
+        return *report;
+    }
+
+    void build_cfg(const tac_function& func) {
+        label_block.resize(prog.num_labels, no_block);
+        cfg.build(func, label_block);
+    }
+
+    void report_algebra(const tac_function& func) {
+        if (report && algebra.identities + algebra.shifts + algebra.divisions > 0) {
+            note(func) << "  algebra: " << algebra.identities << " identities, " << algebra.shifts
+                    << " shifts and masks, " << algebra.divisions << " divisions by multiply-high" << endl;
+        }
+    }
+
+    void optimize(tac_function& func) {
+        build_cfg(func);
+        const_prop.run(func, cfg);
+        if (report && (const_prop.folded || const_prop.substituted || const_prop.branches)) {
+            note(func) << "  constant propagation: " << const_prop.folded << " folded, "
+                    << const_prop.substituted << " operands replaced, "
+                    << const_prop.branches << " branches decided" << endl;
+        }
+
+        // Identities first, so value numbering sees x * 1 as x
+        algebra.run(func, false);
+        report_algebra(func);
+
+        build_cfg(func);
+        value_number.run(func, cfg);
+        if (report && value_number.reused + value_number.loads + value_number.replaced > 0) {
+            note(func) << "  value numbering: " << value_number.reused << " expressions and "
+                    << value_number.loads << " loads reused, " << value_number.replaced << " operands replaced" << endl;
+        }
+
+        dead_code.run(func, cfg);
+        if (report && dead_code.unreachable + dead_code.dead > 0) {
+            note(func) << "  dead code: " << dead_code.unreachable + dead_code.dead << " instructions removed ("
+                    << dead_code.unreachable << " unreachable, " << dead_code.dead << " unused results)" << endl;
+        }
+
+        build_cfg(func);
+        licm.run(func, cfg);
+        if (report) {
+            for (const pair<tac_operand, size_t>& loop : licm.per_loop) {
+                note(func) << "  loop invariants: " << loop.second << " hoisted out of the loop at L"
+                        << loop.first.id << endl;
+            }
+        }
+
+        build_cfg(func);
+        strength.run(func, cfg);
+        if (report && strength.products > 0) {
+            note(func) << "  induction variables: " << strength.products << " multiplications reduced, "
+                    << strength.tests << " exit tests replaced, " << strength.increments << " increments removed" << endl;
+        }
+
+        // Shifts and multiply-high only after strength reduction has seen the products
+        algebra.run(func, true);
+        report_algebra(func);
+
+        peephole.run(func);
+        if (report && peephole.threaded + peephole.jumps + peephole.labels + peephole.unreachable > 0) {
+            note(func) << "  jumps: " << peephole.threaded << " threaded, " << peephole.jumps << " removed, "
+                    << peephole.labels << " labels and " << peephole.unreachable << " unreachable instructions dropped" << endl;
+        }
+
+        // Last, since the passes above may leave temporaries unused
+        build_cfg(func);
+        temp_alloc.run(func, cfg);
+        if (report && temp_alloc.temps_before > 0) {
+            note(func) << "  temporaries: " << temp_alloc.temps_before << " renumbered into "
+                    << temp_alloc.temps_after << " (peak live)" << endl;
+        }
+    }
+
+public:
+    // division_cost is what an int division costs on the target, in simple instructions
+    tac_optimizer(tac_program& prog, ostream* report = nullptr, size_t division_cost = 1)
+        : prog(prog), report(report), const_prop(prog), algebra(prog), value_number(prog), dead_code(prog), licm(prog), strength(prog), peephole(prog), temp_alloc(prog) {
+        algebra.division_cost = division_cost;
+    }
+
+    void run() {
+        for (tac_function& func : prog.functions) {
+            optimize(func);
+        }
+    }
+};
+
+#endif // OPTIMIZER_H
@@ -0,0 +1,214 @@
+#ifndef OUTPUT_FILE_H
+#define OUTPUT_FILE_H
+
+#include <atomic>
+#include <condition_variable>
+#include <fcntl.h>
+#include <mutex>
+#include <ostream>
+#include <streambuf>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+using namespace std;
+
+// Stream buffer for the log, error and code files. Text collects in a large buffer
+// that is written out in one system call when it fills up. Flushing the stream
+// (endl) does not reach the file; text is only forced out by drain() and close(),
+// which the compiler calls at the end of each phase.
+//
+// In background mode a writer thread does the system calls: the buffer is swapped
+// with a second one and the compiler keeps filling that while the first is written.
+
+class output_buf : public streambuf
+{
+private:
+    static const size_t buffer_size = 1 << 20;
+
+    int fd = -1;
+    atomic<bool> failed{false}; // also set by the writer thread
+    vector<char> buffer; // being filled
+
+    // Background writer state, guarded by lock
+    bool background = false;
+    thread writer;
+    mutex lock;
+    condition_variable changed;
+    vector<char> pending; // full buffer handed to the writer
+    size_t pending_size = 0; // 0 when the writer is idle
+    bool stopping = false;
+
+    bool write_all(const char *data, size_t size)
+    {
+        while(size > 0)
+        {
+            ssize_t n = ::write(fd, data, size);
+            if(n < 0) return false;
+            data += n;
+            size -= n;
+        }
+        return true;
+    }
+
+    void write_pending()
+    {
+        unique_lock<mutex> guard(lock);
+        while(true)
+        {
+            changed.wait(guard, [this] { return pending_size != 0 || stopping; });
+            if(pending_size == 0) return;
+
+            // the compiler does not touch pending until pending_size is cleared
+            guard.unlock();
+            bool ok = write_all(pending.data(), pending_size);
+            guard.lock();
+
+            if(!ok) failed = true;
+            pending_size = 0;
+            changed.notify_all();
+        }
+    }
+
+    // Passes the buffered text on, to the writer thread or straight to the file
+    void hand_off()
+    {
+        size_t size = pptr() - pbase();
+        if(size == 0) return;
+
+        if(background)
+        {
+            unique_lock<mutex> guard(lock);
+            changed.wait(guard, [this] { return pending_size == 0; });
+            pending.swap(buffer);
+            pending_size = size;
+            changed.notify_all();
+        }
+        else if(!write_all(buffer.data(), size))
+        {
+            failed = true;
+        }
+        setp(buffer.data(), buffer.data() + buffer.size());
+    }
+
+protected:
+    int_type overflow(int_type c) override
+    {
+        hand_off();
+        if(failed) return traits_type::eof();
+        if(!traits_type::eq_int_type(c, traits_type::eof()))
+        {
+            *pptr() = traits_type::to_char_type(c);
+            pbump(1);
+        }
+        return traits_type::not_eof(c);
+    }
+
+    // Called for endl and flush; see drain() for getting text to the file
+    int sync() override
+    {
+        return failed ? -1 : 0;
+    }
+
+public:
+    output_buf() {}
+    output_buf(const output_buf&) = delete;
+    output_buf& operator=(const output_buf&) = delete;
+
+    bool open(const char *path, bool in_background)
+    {
+        fd = ::open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if(fd < 0) return false;
+
+        failed = false;
+        buffer.resize(buffer_size);
+        setp(buffer.data(), buffer.data() + buffer.size());
+
+        background = in_background;
+        if(background)
+        {
+            pending.resize(buffer_size);
+            stopping = false;
+            writer = thread(&output_buf::write_pending, this);
+        }
+        return true;
+    }
+
+    bool is_open()
+    {
+        return fd >= 0;
+    }
+
+    // Writes out everything buffered so far and waits until it is in the file
+    bool drain()
+    {
+        if(fd < 0) return false;
+        hand_off();
+        if(background)
+        {
+            unique_lock<mutex> guard(lock);
+            changed.wait(guard, [this] { return pending_size == 0; });
+        }
+        return !failed;
+    }
+
+    bool close()
+    {
+        if(fd < 0) return false;
+        bool ok = drain();
+        if(background)
+        {
+            {
+                lock_guard<mutex> guard(lock);
+                stopping = true;
+            }
+            changed.notify_all();
+            writer.join();
+            background = false;
+        }
+        ok = (::close(fd) == 0) && ok;
+        fd = -1;
+        setp(NULL, NULL);
+        return ok;
+    }
+
+    ~output_buf()
+    {
+        close();
+    }
+};
+
+// Output stream over an output_buf, used like an ofstream
+
+class output_file : public ostream
+{
+private:
+    output_buf buf;
+
+public:
+    output_file() : ostream(&buf) {}
+
+    void open(const char *path, bool in_background = false)
+    {
+        if(buf.open(path, in_background)) clear();
+        else setstate(ios::failbit);
+    }
+
+    bool is_open()
+    {
+        return buf.is_open();
+    }
+
+    // Phase boundary: get everything written so far into the file
+    void drain()
+    {
+        if(!buf.drain()) setstate(ios::badbit);
+    }
+
+    void close()
+    {
+        if(!buf.close()) setstate(ios::failbit);
+    }
+};
+
+#endif // OUTPUT_FILE_H
@@ -0,0 +1,178 @@
+#ifndef PEEPHOLE_H
+#define PEEPHOLE_H
+
+#include <cstdint>
+#include <vector>
+
+#include "ir.h"
+
+using namespace std;
+
+// Cleans up jumps and labels in one function at a time, in a few linear sweeps:
+// adjacent labels are merged into the first, a jump to a label that is followed by
+// a goto goes straight to the goto's target, code after a goto or return up to the
+// next label is dropped, a jump to the label right after it disappears, a branch
+// over a goto becomes one inverted branch, and labels nothing jumps to are removed.
+// Declarations never execute, so they are skipped over and always kept. Sweeps
+// repeat while one of them changes something, which is rarely more than twice.
+
+class jump_peephole
+{
+private:
+    tac_program& prog;
+    vector<uint32_t> alias;     // by label, first label of its run of adjacent labels
+    vector<uint32_t> position;  // by label, index of its instruction
+    vector<uint32_t> target;    // by label, where a jump to it ends up
+    vector<uint32_t> refs;      // by label, jumps to it
+    vector<uint8_t> resolved;   // by label
+    vector<uint32_t> next_real; // by instruction, first later one that is no label or declaration
+    vector<uint32_t> reached;   // by label, stamp of the instruction the label sits before
+    vector<uint8_t> removed;    // by instruction
+    vector<uint32_t> chain;
+
+    static bool is_jump(tac_opcode op) {
+        return op == OP_GOTO || is_cond_branch(op);
+    }
+
+    // Final target of a jump to label l, following gotos (stops on a cycle)
+    uint32_t resolve(uint32_t l, const vector<tac_instr>& code) {
+        chain.clear();
+        l = alias[l];
+        while (!resolved[l]) {
+            resolved[l] = 1;
+            target[l] = l;
+            chain.push_back(l);
+            uint32_t i = next_real[position[l]];
+            if (i >= code.size() || code[i].op != OP_GOTO) break;
+            l = alias[code[i].src1.id];
+        }
+        uint32_t final_target = target[l];
+        for (uint32_t c : chain) target[c] = final_target;
+        return final_target;
+    }
+
+    void index_labels(const vector<tac_instr>& code) {
+        next_real.resize(code.size());
+        uint32_t next = code.size();
+        for (uint32_t i = code.size(); i-- > 0;) {
+            next_real[i] = next;
+            if (code[i].op != OP_LABEL && code[i].op != OP_DECL) next = i;
+        }
+        for (uint32_t i = 0; i < code.size(); i++) {
+            if (code[i].op != OP_LABEL) continue;
+            uint32_t l = code[i].src1.id;
+            position[l] = i;
+            alias[l] = i > 0 && code[i - 1].op == OP_LABEL ? alias[code[i - 1].src1.id] : l;
+            resolved[l] = 0;
+            refs[l] = 0;
+            reached[l] = 0;
+        }
+    }
+
+    // Whether the labels (and declarations) right after instruction i include label l
+    bool falls_into(const vector<tac_instr>& code, uint32_t i, uint32_t l) const {
+        for (uint32_t j = i + 1; j < code.size() && (code[j].op == OP_LABEL || code[j].op == OP_DECL); j++) {
+            if (code[j].op == OP_LABEL && alias[code[j].src1.id] == l) return true;
+        }
+        return false;
+    }
+
+    // One round of all rewrites; true if anything changed
+    bool sweep(tac_function& func) {
+        vector<tac_instr>& code = func.code;
+        index_labels(code);
+
+        // Jumps go to the first label of a run, past any gotos there
+        size_t changes = 0;
+        for (tac_instr& in : code) {
+            if (!is_jump(in.op)) continue;
+            uint32_t l = resolve(jump_label(in).id, code);
+            if (l != jump_label(in).id) {
+                if (alias[jump_label(in).id] != l) threaded++;
+                jump_label(in).id = l;
+                changes++;
+            }
+            refs[l]++;
+        }
+
+        size_t kept = 0;
+        bool reachable = true;
+        for (uint32_t i = 0; i < code.size(); i++) {
+            tac_instr in = code[i];
+            if (in.op == OP_LABEL) {
+                if (refs[in.src1.id] == 0) {
+                    labels++;
+                    changes++;
+                    continue;
+                }
+                reachable = true;
+            } else if (!reachable && in.op != OP_DECL) {
+                if (is_jump(in.op)) refs[jump_label(in).id]--;
+                unreachable++;
+                changes++;
+                continue;
+            } else if (is_cond_branch(in.op) && i + 1 < code.size() && code[i + 1].op == OP_GOTO
+                       && falls_into(code, i + 1, jump_label(in).id)) {
+                // if c goto L1; goto L2; L1:  becomes  ifFalse c goto L2; L1:
+                refs[jump_label(in).id]--;
+                in.op = make_branch(!branch_sense(in.op), branch_relation(in.op));
+                in.dst = code[i + 1].src1;
+                i++;
+                jumps++;
+                changes++;
+            }
+            if (in.op == OP_GOTO || in.op == OP_RETURN) reachable = false;
+            code[kept++] = in;
+        }
+        code.resize(kept);
+
+        // Backwards, so a jump sees the labels in front of the next instruction that
+        // stays, even when the jumps in between go as well
+        removed.assign(code.size(), 0);
+        uint32_t stamp = 1;
+        size_t dropped = 0;
+        for (uint32_t i = code.size(); i-- > 0;) {
+            const tac_instr& in = code[i];
+            if (in.op == OP_LABEL) {
+                reached[in.src1.id] = stamp;
+            } else if (is_jump(in.op) && reached[jump_label(in).id] == stamp) {
+                refs[jump_label(in).id]--;
+                removed[i] = 1;
+                dropped++;
+            } else if (in.op != OP_DECL) {
+                stamp++;
+            }
+        }
+        if (dropped > 0) {
+            jumps += dropped;
+            changes += dropped;
+            kept = 0;
+            for (uint32_t i = 0; i < code.size(); i++) {
+                if (!removed[i]) code[kept++] = code[i];
+            }
+            code.resize(kept);
+        }
+        return changes > 0;
+    }
+
+public:
+    size_t threaded = 0;        // jumps sent past a goto to its target
+    size_t jumps = 0;           // jumps removed or merged into a branch
+    size_t labels = 0;          // labels removed
+    size_t unreachable = 0;     // instructions after a goto or return removed
+
+    jump_peephole(tac_program& prog) : prog(prog) {}
+
+    void run(tac_function& func) {
+        threaded = jumps = labels = unreachable = 0;
+        alias.resize(prog.num_labels);
+        position.resize(prog.num_labels);
+        target.resize(prog.num_labels);
+        refs.resize(prog.num_labels);
+        resolved.resize(prog.num_labels);
+        reached.resize(prog.num_labels);
+        while (sweep(func)) {}
+    }
+};
+
+#endif // PEEPHOLE_H
@@ -2,40 +2,93 @@
 #define SCOPE_TABLE_H
 
 #include "symbol_info.h"
+#include "arena.h"
 #include <string>
 #include <fstream>
 
 using namespace std;
 
+// Symbols of one scope in an open-addressing hash table (linear probing). The slot
+// array has a power-of-two capacity and doubles once it is more than 3/4 full, so
+// probe sequences stay short however many names the scope declares.
+
 class scope_table
 {
 private:
-    symbol_info** chains;
-    int tbl_size;
+    struct slot
+    {
+        uint32_t hash;
+        uint32_t name; // name_table::none for an empty slot
+        symbol_info *sym;
+    };
+
+    slot* slots;
+    int tbl_size; // capacity, a power of two
+    int num_syms = 0;
     int num_chld = 0;
     int ID;
     scope_table *parent_scope = NULL;
-    int hash_func(string symbol)
+    arena *mem; // owns the symbols of the scope
+
+    // Print_scope output, rendered again only after the scope has changed. Symbols
+    // are annotated through the handle Insert_in_scope returns, before the scope is
+    // next printed, so marking the scope on insert and delete is enough.
+    string dump_text;
+    bool dump_stale = true;
+
+    int home_slot(uint32_t hash)
+    {
+        return hash & (tbl_size - 1);
+    }
+
+    // Slot holding name, or the empty slot where it would go
+    int find_slot(uint32_t name, uint32_t hash)
     {
-        int sum = 0;
-        for (int i = 0; i < symbol.size(); i++)
+        int i = home_slot(hash);
+        while(slots[i].name != name && slots[i].name != name_table::none)
         {
-            sum += (int)symbol[i];
+            i = (i + 1) & (tbl_size - 1);
         }
-        return sum%tbl_size;
+        return i;
     }
-public:
-    scope_table(){}
-    scope_table(int n, int ID)
+
+    void allocate_slots(int n)
     {
         tbl_size = n;
+        slots = new slot[n];
+        for(int i = 0; i < n; i++)
+        {
+            slots[i].name = name_table::none;
+            slots[i].sym = NULL;
+        }
+    }
 
-        chains = new symbol_info*[n];
+    void grow()
+    {
+        slot *old_slots = slots;
+        int old_size = tbl_size;
 
-        for(int i = 0; i < n; i++)
+        allocate_slots(old_size * 2);
+        for(int i = 0; i < old_size; i++)
         {
-            chains[i] = NULL;
+            if(old_slots[i].name != name_table::none)
+            {
+                slots[find_slot(old_slots[i].name, old_slots[i].hash)] = old_slots[i];
+            }
         }
+        delete[] old_slots;
+    }
+
+public:
+    scope_table(){}
+    scope_table(int n, int ID, arena& mem)
+    {
+        this->mem = &mem;
+
+        int capacity = 8;
+        while(capacity < n) capacity *= 2;
+        allocate_slots(capacity);
+
         this->ID = ID;
     }
 
@@ -72,160 +125,120 @@ public:
         return ID;
     }
 
-    symbol_info* Lookup_in_scope(string name)
+    symbol_info* Lookup_in_scope(uint32_t name)
     {
-        int pos=0;
-        int hash_val = hash_func(name);
-        symbol_info *curr_sym = chains[hash_val];
-
-        while(curr_sym != NULL)
-        {
-            if (curr_sym->getname() == name)
-            {
-                return curr_sym;
-            }
-            else
-            {
-                pos++;
-                curr_sym = curr_sym->get_next();
-            }
-        }
-
-        return curr_sym;
+        return slots[find_slot(name, names.get_hash(name))].sym;
     }
 
-    bool Insert_in_scope(string name, string type)
+    // Returns the new symbol, or the one already declared under name (inserted is
+    // set accordingly)
+    symbol_info* Insert_in_scope(uint32_t name, string type, bool& inserted)
     {
-        int pos = 0;
-        symbol_info *new_sym = new symbol_info(name,type);
-
-        int hash_val = hash_func(name);
+        uint32_t hash = names.get_hash(name);
+        int pos = find_slot(name, hash);
 
-        if(chains[hash_val]==NULL)
+        dump_stale = true; // the caller may annotate the returned symbol
+        if(slots[pos].name == name)
         {
-            chains[hash_val] = new_sym;
-            return true;
+            inserted = false;
+            return slots[pos].sym;
         }
-        else
-        {
-            if (chains[hash_val]->getname() == name)
-            {
-                return false;
-            }
 
-            pos++;
-            symbol_info *buffer = chains[hash_val];
-            symbol_info *curr_sym = chains[hash_val]->get_next();
-
-            while(true)
-            {
-                if(curr_sym == NULL)
-                {
-                    buffer->set_next(new_sym);
-                    return true;
-                }
-                else
-                {
-                    if (curr_sym->getname() == name)
-                    {
-                        return false;
-                    }
-                    pos++;
-                    buffer = curr_sym;
-                    curr_sym = curr_sym->get_next();
-                }
-            }
+        if((num_syms + 1) * 4 > tbl_size * 3)
+        {
+            grow();
+            pos = find_slot(name, hash);
         }
+
+        slots[pos].hash = hash;
+        slots[pos].name = name;
+        slots[pos].sym = mem->make<symbol_info>(name,type);
+        num_syms++;
+        inserted = true;
+        return slots[pos].sym;
     }
 
-    bool Delete_from_scope(string name)
+    bool Delete_from_scope(uint32_t name)
     {
-        int pos = 0;
-        int hash_val = hash_func(name);
-        symbol_info *curr_sym = chains[hash_val];
+        int pos = find_slot(name, names.get_hash(name));
 
-
-        if(curr_sym == NULL)
+        if(slots[pos].name == name_table::none)
         {
             return false;
         }
 
-        else if (curr_sym->getname() == name)
-        {
-            chains[hash_val] = curr_sym->get_next();
-            curr_sym->set_next(NULL);
-            delete curr_sym;
-            curr_sym = NULL;
-            return true;
-        }
+        dump_stale = true;
 
-        else
+        // Backward-shift deletion: pull later members of the probe run into the gap
+        // so lookups never need tombstones
+        int gap = pos;
+        int i = pos;
+        while(true)
         {
-            pos++;
-            symbol_info *buffer = curr_sym;
-            curr_sym = curr_sym->get_next();
-            while(curr_sym!=NULL)
+            i = (i + 1) & (tbl_size - 1);
+            if(slots[i].name == name_table::none) break;
+
+            int home = home_slot(slots[i].hash);
+            if(((i - home) & (tbl_size - 1)) >= ((i - gap) & (tbl_size - 1)))
             {
-                if (curr_sym->getname() == name)
-                {
-                    buffer->set_next(curr_sym->get_next());
-                    curr_sym->set_next(NULL);
-                    delete curr_sym;
-                    curr_sym = NULL;
-                    return true;
-                }
-                else
-                {
-                    pos++;
-                    buffer = curr_sym;
-                    curr_sym = curr_sym->get_next();
-                }
+                slots[gap] = slots[i];
+                gap = i;
             }
-            return false;
         }
+        slots[gap].name = name_table::none;
+        slots[gap].sym = NULL;
+        num_syms--;
+        return true;
     }
 
-    void Print_scope(ofstream& outlog)
+    void Print_scope(ostream& outlog)
     {
-    	string s = "";
+        if(!dump_stale)
+        {
+            outlog.write(dump_text.data(), dump_text.size());
+            return;
+        }
+
+    	string& s = dump_text;
+    	s.clear();
     	s+="ScopeTable # "+to_string(ID)+"\n";
         //cout<<"ScopeTable # "<<ID<<endl;
 
         for(int i = 0; i < tbl_size; i++)
         {
-            if(chains[i]!=NULL)
+            if(slots[i].name!=name_table::none)
             {
             	s+=to_string(i)+" --> ";
             	//cout<<i<<" --> ";
 
-		        symbol_info *curr_sym = chains[i];
+		        symbol_info *curr_sym = slots[i].sym;
 
-		        while(curr_sym!=NULL)
-		        {
-		        	s+="\n< "+curr_sym->getname()+" : "+curr_sym->gettype()+" >\n";
-                    if (curr_sym->getidtype() == "func_def")
+		        s+="\n< "+curr_sym->getname()+" : "+curr_sym->gettype()+" >\n";
+                    if (curr_sym->getidtype() == ID_FUNC_DEF)
                     {
                         s+="Function Definition\n";
-                        s+="Return Type: "+curr_sym->getvartype()+"\n";
-                        s+="Number of Parameters: "+to_string(curr_sym->getparamlist().size())+"\n";
+                        s+="Return Type: "+type_name(curr_sym->getvartype())+"\n";
+                        const vector<data_type>& param_list = curr_sym->getparamlist();
+                        const vector<uint32_t>& param_name = curr_sym->getparamname();
+                        s+="Number of Parameters: "+to_string(param_list.size())+"\n";
                         s+="Parameter Details: ";
-                        for(int i = 0; i<curr_sym->getparamlist().size(); i++)
+                        for(size_t i = 0; i<param_list.size(); i++)
                         {
-                            s+=curr_sym->getparamlist()[i] + " " + curr_sym->getparamname()[i];
-                            if(i!=curr_sym->getparamlist().size()-1) s+=", ";
+                            s+=type_name(param_list[i]) + " " + names.get_name(param_name[i]);
+                            if(i!=param_list.size()-1) s+=", ";
                         }
                         //cout<<"Function Definition"<<endl;
                     }
-                    else if (curr_sym->getidtype() == "var")
+                    else if (curr_sym->getidtype() == ID_VAR)
                     {
                         s+="Variable\n";
-                        s+="Type: "+curr_sym->getvartype()+"\n";
+                        s+="Type: "+type_name(curr_sym->getvartype())+"\n";
                         //cout<<"Variable"<<endl;
                     }
-                    else if (curr_sym->getidtype() == "array")
+                    else if (curr_sym->getidtype() == ID_ARRAY)
                     {
                         s+="Array\n";
-                        s+="Type: "+curr_sym->getvartype()+"\n";
+                        s+="Type: "+type_name(curr_sym->getvartype())+"\n";
                         s+="Size: "+to_string(curr_sym->getarraysize())+"\n";
                         //cout<<"Array"<<endl;
                     }
@@ -235,14 +248,13 @@ public:
                         //cout<<"Error"<<endl;
                     }
 		            //cout<<"< "<<curr_sym->getname()<<" : "<<curr_sym->gettype()<<" > ";
-		            curr_sym = curr_sym->get_next();
-		        }
 				s+="\n";
 		        //cout<<endl;
             }
         }
 		s+="\n";
-		outlog<<s;
+		dump_stale = false;
+		outlog.write(s.data(), s.size());
         //cout<<endl;
         //return s;
     }
@@ -250,18 +262,8 @@ public:
     ~scope_table()
     {
         //cout<<"delete scope"<<endl;
-        for(int i = 0; i<tbl_size; i++)
-        {
-            while(chains[i]!=NULL)
-            {
-                symbol_info *buffer = chains[i];
-                chains[i] = chains[i]->get_next();
-                buffer->set_next(NULL);
-                delete buffer;
-                buffer = NULL;
-            }
-        }
-        delete[] chains;
+        // symbols are released with the arena
+        delete[] slots;
     }
 };
 
@@ -9,7 +9,7 @@ flex 22101848_22101069.l
 echo 'Scanner C file generated'
 g++ -fpermissive -w -c -o l.o lex.yy.c
 echo 'Scanner object file created'
-g++ y.o l.o -o two_pass_compiler
+g++ y.o l.o -o two_pass_compiler -pthread
 echo 'Compilation complete, executing two-pass compiler...'
 
 # Execute the compiler on the input file
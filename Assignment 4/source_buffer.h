@@ -0,0 +1,115 @@
+#ifndef SOURCE_BUFFER_H
+#define SOURCE_BUFFER_H
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace std;
+
+// Whole input file held in memory for the scanner. The file is memory-mapped when
+// possible (read into a heap buffer otherwise) and followed by the two NUL bytes
+// flex's yy_scan_buffer() expects, so the scanner works directly on the file bytes
+// and token lexemes stay valid for the whole compilation.
+//
+// The mapping is private and writable: flex temporarily writes a NUL after each
+// token, which only copies the touched pages.
+
+class source_buffer
+{
+private:
+    char *data = NULL;
+    size_t file_size = 0;
+    size_t region_size = 0; // size of the mapping, 0 when data is a heap buffer
+
+    bool map_file(int fd)
+    {
+        size_t page = sysconf(_SC_PAGESIZE);
+        size_t size = (file_size + 2 + page - 1) / page * page;
+
+        // Reserve zero-filled pages first so the two bytes after the file are
+        // readable even when the file ends exactly on a page boundary
+        void *region = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if(region == MAP_FAILED) return false;
+
+        if(file_size > 0)
+        {
+            void *mapped = mmap(region, file_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0);
+            if(mapped == MAP_FAILED)
+            {
+                munmap(region, size);
+                return false;
+            }
+            madvise(region, file_size, MADV_SEQUENTIAL);
+        }
+
+        data = (char*)region;
+        region_size = size;
+        return true;
+    }
+
+    bool read_file(int fd)
+    {
+        data = (char*)malloc(file_size + 2);
+        if(data == NULL) return false;
+
+        size_t done = 0;
+        while(done < file_size)
+        {
+            ssize_t n = read(fd, data + done, file_size - done);
+            if(n <= 0) break;
+            done += n;
+        }
+        file_size = done;
+        data[file_size] = data[file_size + 1] = '\0';
+        return true;
+    }
+
+public:
+    source_buffer() {}
+    source_buffer(const source_buffer&) = delete;
+    source_buffer& operator=(const source_buffer&) = delete;
+
+    bool open(const char *path)
+    {
+        int fd = ::open(path, O_RDONLY);
+        if(fd < 0) return false;
+
+        struct stat st;
+        if(fstat(fd, &st) != 0 || !S_ISREG(st.st_mode))
+        {
+            close(fd);
+            return false;
+        }
+        file_size = st.st_size;
+
+        bool ok = map_file(fd) || read_file(fd);
+        close(fd);
+        return ok;
+    }
+
+    // Start of the buffer handed to yy_scan_buffer()
+    char* base()
+    {
+        return data;
+    }
+
+    // Buffer size including the two terminating NUL bytes
+    size_t scan_size()
+    {
+        return file_size + 2;
+    }
+
+    ~source_buffer()
+    {
+        if(data == NULL) return;
+        if(region_size != 0) munmap(data, region_size);
+        else free(data);
+    }
+};
+
+#endif // SOURCE_BUFFER_H
@@ -3,7 +3,10 @@
 
 #include <iostream>
 #include <string>
+#include <string_view>
 #include <vector>
+#include "name_table.h"
+#include "types.h"
 
 using namespace std;
 
@@ -13,60 +16,81 @@ class ASTNode;
 class symbol_info
 {
 private:
-    string sym_name;
+    string sym_name; // non-identifier values (type names)
+    uint32_t name_id; // interned name of identifiers, name_table::none otherwise
+    string_view lexeme; // token text, points into the scanner's source buffer (tokens only)
     string sym_type;
-    string ID_type; //var, array, func_dec, func_def
-    string var_type; //int, float, void, error
+    id_kind ID_type = ID_NONE;
+    data_type var_type = TYPE_NONE;
     int array_size;
-    vector<string> param_list;//for functions
-    vector<string> param_name;
-    symbol_info *next_sym;
+    vector<data_type> param_list;//for functions
+    vector<uint32_t> param_name;
     ASTNode* ast_node; // Pointer to AST node
+    symbol_info *shadowed; // Binding of the same name in an enclosing scope (not owned)
 public:
     //symbol_info(){}
     symbol_info(string name, string type)
     {
         sym_name = name;
+        name_id = name_table::none;
         sym_type = type;
-        next_sym = NULL;
         ast_node = NULL;
+        shadowed = NULL;
     }
-
-    void set_next(symbol_info *symbol)
+    
+    // Token built by the lexer: keeps a view of the source text instead of a copy
+    symbol_info(const char *text, int len, string type)
     {
-        next_sym = symbol;
+        lexeme = string_view(text, len);
+        name_id = name_table::none;
+        sym_type = type;
+        ast_node = NULL;
+        shadowed = NULL;
     }
-
-    symbol_info* get_next()
+    
+    // Identifier, named by its interned id
+    symbol_info(uint32_t id, string type)
     {
-        return next_sym;
+        name_id = id;
+        sym_type = type;
+        ast_node = NULL;
+        shadowed = NULL;
     }
 
-    string getname()
+    const string& getname()
     {
+        if(name_id != name_table::none) return names.get_name(name_id);
         return sym_name;
     }
+    uint32_t getnameid()
+    {
+        return name_id;
+    }
+    string_view getlexeme()
+    {
+        return lexeme;
+    }
     string gettype()
     {
         return sym_type;
     }
     
-    string getvartype()
+    data_type getvartype()
     {
         return var_type;
     }
     
-    void setvartype(string tp)
+    void setvartype(data_type tp)
     {
     	var_type = tp;
     }
     
-    string getidtype()
+    id_kind getidtype()
     {
         return ID_type;
     }
     
-    void setidtype(string tp)
+    void setidtype(id_kind tp)
     {
     	ID_type = tp;
     }
@@ -81,22 +105,22 @@ public:
     	array_size = sz;
     }
     
-    void setparamlist(vector<string> list)
+    void setparamlist(vector<data_type> list)
     {
     	param_list = list;
     }
     
-    vector<string> getparamlist()
+    const vector<data_type>& getparamlist()
     {
     	return param_list;
     }
     
-    vector<string> getparamname()
+    const vector<uint32_t>& getparamname()
     {
     	return param_name;
     }
     
-    void setparamname(vector<string> list)
+    void setparamname(vector<uint32_t> list)
     {
     	param_name = list;
     }
@@ -106,6 +130,16 @@ public:
     	return param_list.size();
     }
 
+    void setshadowed(symbol_info *symbol)
+    {
+        shadowed = symbol;
+    }
+
+    symbol_info* getshadowed()
+    {
+        return shadowed;
+    }
+
     // New methods for AST support
     void set_ast_node(ASTNode* node)
     {
@@ -116,14 +150,6 @@ public:
     {
         return ast_node;
     }
-
-    ~symbol_info()
-    {
-        delete next_sym;
-        param_list.clear();
-        param_name.clear();
-        // Don't delete ast_node here - will be managed separately
-    }
 };
 
 #endif // SYMBOL_INFO_H
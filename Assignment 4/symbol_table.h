@@ -3,16 +3,39 @@
 
 #include "scope_table.h"
 #include <fstream>
+#include <vector>
 
 using namespace std;
 
+// Nested scopes with LeBlanc-Cook name resolution. Besides the scope tables (which
+// detect redeclarations and produce the log dumps), every name maps to the innermost
+// live declaration of it; declarations it hides are chained through getshadowed().
+// Entering a declaration pushes onto that stack and leaving its scope pops it, so a
+// lookup is a single probe however deep the nesting is. Interned ids are dense, so
+// the name-to-binding map is a vector indexed by id.
+
 class symbol_table
 {
 private:
+    struct binding_entry
+    {
+        uint32_t name;
+        symbol_info *sym;
+    };
+
+    vector<symbol_info*> visible; // innermost declaration of each name id, NULL if none
+    vector<binding_entry> bindings; // declarations in the order they were made
+    vector<size_t> scope_marks; // size of bindings when each open scope was entered
+
     scope_table *curr_scope = NULL;
-    int scope_size = 10;
+    int scope_size = 8; // initial capacity of block scopes
+    int global_scope_size = 64; // initial capacity of the global scope, which holds every function
     int ID = 0;
+    bool trace = true; // log scope creation and removal
+    arena& mem;
 public:
+    symbol_table(arena& mem) : mem(mem) {}
+    
 	int getID()
 	{
 		return curr_scope->getID();
@@ -21,19 +44,38 @@ public:
     {
         scope_size = n;
     }
-    void enter_scope(ofstream& outlog)
+    void set_global_size(int n)
+    {
+        global_scope_size = n;
+    }
+    void set_trace(bool on)
+    {
+        trace = on;
+    }
+    void enter_scope(ostream& outlog)
     {
         ID+=1;
-        scope_table *new_scope = new scope_table(scope_size, ID);
+        scope_table *new_scope = new scope_table(curr_scope == NULL ? global_scope_size : scope_size, ID, mem);
         new_scope->set_prnt(curr_scope);
         curr_scope = new_scope;
-        outlog<<"New ScopeTable with ID "<<curr_scope->getID()<<" created"<<endl<<endl;
+        scope_marks.push_back(bindings.size());
+        if(trace) outlog<<"New ScopeTable with ID "<<curr_scope->getID()<<" created"<<endl<<endl;
         //if(new_scope->getID() != "1")cout<<curr_scope->getID()<<" "<<(curr_scope->get_prnt())->getID()<<endl;
     }
 
-    void exit_scope(ofstream& outlog)
+    void exit_scope(ostream& outlog)
     {
-    	outlog<<"Scopetable with ID "<<curr_scope->getID()<<" removed"<<endl<<endl;
+    	if(trace) outlog<<"Scopetable with ID "<<curr_scope->getID()<<" removed"<<endl<<endl;
+
+        // Pop the declarations of the scope, newest first (ones already removed are skipped)
+        while(bindings.size() > scope_marks.back())
+        {
+            binding_entry entry = bindings.back();
+            if(visible[entry.name] == entry.sym) visible[entry.name] = entry.sym->getshadowed();
+            bindings.pop_back();
+        }
+        scope_marks.pop_back();
+
         scope_table *buffer = curr_scope;
         curr_scope = curr_scope->get_prnt();
         delete buffer;
@@ -41,33 +83,35 @@ public:
         //cout<<curr_scope->getID()<<endl;
     }
 
-    bool Insert_in_table(string name, string type)
+    // Declares name in the current scope. Returns the new symbol, or the one the
+    // current scope already declares under that name (inserted tells which), so the
+    // caller can fill it in without looking it up again.
+    symbol_info* Insert_in_table(uint32_t name, string type, bool& inserted)
     {
-        if(curr_scope->Insert_in_scope(name,type)) return true;
-        else return false;
+        symbol_info *symbol = curr_scope->Insert_in_scope(name,type,inserted);
+        if(!inserted) return symbol;
+
+        if(name >= visible.size()) visible.resize(names.size(), NULL);
+        symbol->setshadowed(visible[name]);
+        visible[name] = symbol;
+        bindings.push_back({name, symbol});
+        return symbol;
     }
 
-    bool Remove_from_table(string name)
+    bool Remove_from_table(uint32_t name)
     {
-        if(curr_scope->Delete_from_scope(name)) return true;
-        else return false;
+        symbol_info *symbol = curr_scope->Lookup_in_scope(name);
+        if(!curr_scope->Delete_from_scope(name)) return false;
+
+        // a declaration of the current scope is always the innermost one
+        visible[name] = symbol->getshadowed();
+        return true;
     }
 
-    symbol_info* Lookup_in_table(string name)
+    symbol_info* Lookup_in_table(uint32_t name)
     {
-        symbol_info *symbol = curr_scope->Lookup_in_scope(name);
-        scope_table *buffer_scope = curr_scope->get_prnt();
-        if(symbol==NULL)
-        {
-            while(buffer_scope!=NULL)
-            {
-                symbol = buffer_scope->Lookup_in_scope(name);
-                if(symbol!=NULL) return symbol;
-                buffer_scope = buffer_scope->get_prnt();
-            }
-        }
-        
-        return symbol;
+        if(name >= visible.size()) return NULL;
+        return visible[name];
     }
 
     void Print_current_scope()
@@ -75,7 +119,7 @@ public:
         //curr_scope->Print_scope();
     }
 
-    void Print_all_scope(ofstream& outlog)
+    void Print_all_scope(ostream& outlog)
     {
         outlog<<"################################"<<endl<<endl;
         scope_table *buffer = curr_scope;
@@ -90,7 +134,12 @@ public:
 
     ~symbol_table()
     {
-        delete curr_scope;
+        while(curr_scope!=NULL)
+        {
+            scope_table *buffer = curr_scope;
+            curr_scope = curr_scope->get_prnt();
+            delete buffer;
+        }
     }
 
 };
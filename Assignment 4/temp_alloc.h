@@ -0,0 +1,137 @@
+#ifndef TEMP_ALLOC_H
+#define TEMP_ALLOC_H
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <vector>
+
+#include "cfg.h"
+#include "ir.h"
+#include "liveness.h"
+
+using namespace std;
+
+// Renumbers the temporaries of each function from t0 and lets temporaries whose
+// lifetimes do not overlap share a number, by linear scan (Poletto and Sarkar) over
+// the instructions in code order. A temporary's lifetime is the hull of the places
+// it is live; with loops that covers the whole loop. The number of temporaries a
+// function ends up with is the most that are live at once.
+
+class temp_allocator
+{
+private:
+    struct interval
+    {
+        uint32_t start, end;    // first and last instruction where the temporary is live
+        uint32_t slot;          // tac_values slot
+    };
+
+    tac_program& prog;
+    tac_values values;
+    liveness live;
+    vector<interval> intervals;
+    vector<uint32_t> interval_of;   // by slot, index in intervals
+    vector<uint32_t> new_numbers;   // by slot
+
+    void cover(uint32_t s, uint32_t position) {
+        if (values.operands[s].kind != OPND_TEMP) return;
+        if (interval_of[s] == UINT32_MAX) {
+            interval_of[s] = intervals.size();
+            intervals.push_back(interval{position, position, s});
+            return;
+        }
+        interval& range = intervals[interval_of[s]];
+        range.start = min(range.start, position);
+        range.end = max(range.end, position);
+    }
+
+    void cover_set(const uint64_t* set, uint32_t position) {
+        for (size_t w = 0; w < live.words; w++) {
+            for (uint64_t bits = set[w]; bits != 0; bits &= bits - 1) {
+                cover(w * 64 + __builtin_ctzll(bits), position);
+            }
+        }
+    }
+
+    void find_intervals(const tac_function& func, const control_flow_graph& cfg) {
+        intervals.clear();
+        interval_of.assign(values.size(), UINT32_MAX);
+        for (uint32_t b = 0; b < cfg.blocks.size(); b++) {
+            const basic_block& block = cfg.blocks[b];
+            if (block.begin == block.end) continue;
+            if (cfg.reachable(b)) {
+                cover_set(&live.live_in[b * live.words], block.begin);
+                cover_set(&live.live_out[b * live.words], block.end - 1);
+            }
+            for (uint32_t i = block.begin; i < block.end; i++) {
+                const tac_instr& in = func.code[i];
+                if (in.op == OP_DECL) continue;
+                uint32_t s;
+                if ((s = values.slot(in.dst)) != no_slot) cover(s, i);
+                if ((s = values.slot(in.src1)) != no_slot) cover(s, i);
+                if ((s = values.slot(in.src2)) != no_slot) cover(s, i);
+            }
+        }
+    }
+
+    void rename(tac_operand& opnd) {
+        if (opnd.kind == OPND_TEMP) opnd.id = new_numbers[values.slot(opnd)];
+    }
+
+public:
+    size_t temps_before = 0;    // distinct temporaries the function used
+    size_t temps_after = 0;     // numbers given out, the peak of simultaneously live ones
+
+    temp_allocator(tac_program& prog) : prog(prog), values(prog) {}
+
+    void run(tac_function& func, const control_flow_graph& cfg) {
+        values.build(func);
+        live.run(func, cfg, values);
+        find_intervals(func, cfg);
+        temps_before = intervals.size();
+
+        sort(intervals.begin(), intervals.end(), [](const interval& a, const interval& b) {
+            return a.start != b.start ? a.start < b.start : a.slot < b.slot;
+        });
+
+        // A number is free again once its temporary's last use is at or before the
+        // next start, since an instruction reads its operands before it writes
+        typedef pair<uint32_t, uint32_t> end_and_number;
+        priority_queue<end_and_number, vector<end_and_number>, greater<end_and_number>> active;
+        priority_queue<uint32_t, vector<uint32_t>, greater<uint32_t>> free_numbers;
+        new_numbers.assign(values.size(), 0);
+        uint32_t used = 0;
+        for (const interval& range : intervals) {
+            while (!active.empty() && active.top().first <= range.start) {
+                free_numbers.push(active.top().second);
+                active.pop();
+            }
+            uint32_t number;
+            if (free_numbers.empty()) {
+                number = used++;
+            } else {
+                number = free_numbers.top();
+                free_numbers.pop();
+            }
+            new_numbers[range.slot] = number;
+            active.push(make_pair(range.end, number));
+        }
+        temps_after = used;
+        func.num_temps = used;
+
+        // A copy between temporaries that now share a number does nothing
+        size_t kept = 0;
+        for (tac_instr& in : func.code) {
+            rename(in.dst);
+            rename(in.src1);
+            rename(in.src2);
+            if (in.op == OP_COPY && in.dst.kind == OPND_TEMP && in.dst == in.src1) continue;
+            func.code[kept++] = in;
+        }
+        func.code.resize(kept);
+    }
+};
+
+#endif // TEMP_ALLOC_H
@@ -0,0 +1,24 @@
+#!/bin/bash
+
+# Runs each InputOutput/inputN.c with --run, optimized, unoptimized and optimized for
+# a target with slow division (so division by constants is lowered), and compares
+# what the program prints and returns with InputOutput/outputN.txt. Build the
+# compiler with script.sh first.
+status=0
+for input in InputOutput/input*.c
+do
+	expected="${input/input/output}"
+	expected="${expected%.c}.txt"
+	for mode in "" "--no-optimize" "--division-cost=8"
+	do
+		./two_pass_compiler "$input" --run --log-level none $mode | sed -n '/^==== Running/,$p' | sed '1d; s/ after .*//' > run.txt
+		if ! diff -q run.txt "$expected" > /dev/null
+		then
+			echo "FAILED: $input $mode"
+			status=1
+		fi
+	done
+done
+rm -f run.txt
+if [ $status -eq 0 ]; then echo 'All tests passed'; fi
+exit $status
@@ -2,25 +2,36 @@
 #define THREE_ADDR_CODE_H
 
 #include "ast.h"
-#include <fstream>
+#include "ir.h"
+#include <ostream>
 #include <string>
-#include <map>
 
 using namespace std;
 
 class ThreeAddrCodeGenerator {
 private:
     ProgramNode* ast_root;
-    ofstream& outcode;
-    map<string, string> symbol_to_temp;
-    int temp_count;
-    int label_count;
+    ostream& outcode;
+    tac_program program;
 
 public:
-    ThreeAddrCodeGenerator(ProgramNode* root, ofstream& out)
-        : ast_root(root), outcode(out), temp_count(0), label_count(0) {}
+    ThreeAddrCodeGenerator(ProgramNode* root, ostream& out)
+        : ast_root(root), outcode(out) {}
 
-    void generate() {
+    // Lowers the AST into the in-memory three-address code
+    void build() {
+        if (ast_root) {
+            tac_builder builder(program);
+            ast_root->generate_code(builder);
+        }
+    }
+
+    tac_program& get_program() {
+        return program;
+    }
+
+    // Writes the program to the code file
+    void print() {
         // Write header section to output file
         outcode << "//========== THREE ADDRESS CODE ==========" << endl;
         outcode << "" << endl;
@@ -32,16 +43,18 @@ public:
         outcode << "" << endl;
         outcode << "// Three Address Code" << endl << endl;
 
-        // Generate code from AST root
-        if (ast_root) {
-            ast_root->generate_code(outcode, symbol_to_temp, temp_count, label_count);
-        }
+        tac_printer(program).print_program(outcode);
 
         outcode << "" << endl;
 
         // Write footer section to output file
         outcode << "//========== END OF CODE ==========" << endl;
     }
+
+    void generate() {
+        build();
+        print();
+    }
 };
 
 #endif // THREE_ADDR_CODE_H
@@ -0,0 +1,40 @@
+#ifndef TYPES_H
+#define TYPES_H
+
+#include <cstdint>
+#include <string>
+
+using namespace std;
+
+// Data type of a variable, function result or expression. TYPE_ERROR marks an
+// expression that failed to type check, so that one error is not reported again by
+// every enclosing expression.
+
+enum data_type : uint8_t
+{
+    TYPE_NONE, // not set
+    TYPE_INT,
+    TYPE_FLOAT,
+    TYPE_VOID,
+    TYPE_ERROR
+};
+
+// What an identifier names
+
+enum id_kind : uint8_t
+{
+    ID_NONE, // not set
+    ID_VAR,
+    ID_ARRAY,
+    ID_FUNC_DEC,
+    ID_FUNC_DEF
+};
+
+// Type name as written in the source (and in the log and code files)
+inline const string& type_name(data_type type)
+{
+    static const string type_names[] = {"", "int", "float", "void", "error"};
+    return type_names[type];
+}
+
+#endif // TYPES_H
@@ -0,0 +1,289 @@
+#ifndef VALUE_NUMBER_H
+#define VALUE_NUMBER_H
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "cfg.h"
+#include "ir.h"
+
+using namespace std;
+
+// Dominator-based value numbering (Briggs, Cooper and Simpson). Blocks are visited
+// down the dominator tree and every computation and array load is keyed by its
+// opcode and the value numbers of its operands; a key seen before in the block or a
+// dominator is replaced by a copy of the temporary that already holds the value,
+// and operands are rewritten to that temporary. Dead code elimination then removes
+// the copies nobody reads.
+//
+// The TAC is not in SSA form, so only temporaries and local variables assigned at
+// most once keep their value numbers across blocks. Other variables and arrays get
+// fresh numbers in each block, and globals after each call as well. A store to an
+// array gives the array a new number, which retires its earlier loads, and makes the
+// stored value available to a following load of the same element.
+
+static const uint32_t no_value = UINT32_MAX;
+
+class value_numbering
+{
+private:
+    struct expr_key
+    {
+        uint32_t op, a, b;
+        bool operator==(const expr_key& other) const { return op == other.op && a == other.a && b == other.b; }
+    };
+
+    struct expr_hash
+    {
+        size_t operator()(const expr_key& k) const {
+            uint64_t h = ((uint64_t)k.a << 32 | k.b) * 0x9E3779B97F4A7C15ull;
+            return (size_t)(h ^ (h >> 29) ^ k.op);
+        }
+    };
+
+    // Undo information for one block on the dominator tree walk
+    struct frame
+    {
+        uint32_t block, next_child;
+        size_t exprs, slots, leaders;
+    };
+
+    tac_program& prog;
+    tac_values values;
+
+    unordered_map<expr_key, uint32_t, expr_hash> exprs;
+    vector<expr_key> expr_log;                  // keys added by the blocks on the walk
+    uint32_t next_value = 0;
+    vector<tac_operand> leaders;                // by value number: constant or stable holder
+    vector<uint32_t> leader_log;
+    vector<uint32_t> const_values;              // by constant id
+    vector<uint8_t> stable;                     // by slot: keeps its value number across blocks
+    vector<uint32_t> slot_values;               // by slot, for stable slots whose assignment dominates
+    vector<pair<uint32_t, uint32_t>> slot_log;  // stable slot and its previous value number
+    vector<uint32_t> local_values;              // by slot, numbers that only hold in the current block
+    vector<uint64_t> local_times;               // by slot, when the local number was given
+    uint64_t clock = 0, block_start = 0, last_call = 0;
+
+    uint32_t new_value() {
+        leaders.push_back(tac_operand());
+        return next_value++;
+    }
+
+    void set_leader(uint32_t v, const tac_operand& opnd) {
+        if (!leaders[v].is_none()) return;
+        leaders[v] = opnd;
+        leader_log.push_back(v);
+    }
+
+    uint32_t value_of(const tac_operand& opnd) {
+        if (opnd.kind == OPND_CONST) {
+            if (const_values[opnd.id] == no_value) {
+                const_values[opnd.id] = new_value();
+                leaders[const_values[opnd.id]] = opnd; // constants hold everywhere
+            }
+            return const_values[opnd.id];
+        }
+        uint32_t s = values.slot(opnd);
+        if (s == no_slot) return new_value();
+        if (stable[s] && slot_values[s] != no_value) return slot_values[s];
+
+        // Unstable, or stable but read where its assignment does not dominate
+        uint64_t valid_from = values.is_global[s] ? last_call : block_start;
+        if (local_times[s] <= valid_from) {
+            local_values[s] = new_value();
+            local_times[s] = ++clock;
+        }
+        return local_values[s];
+    }
+
+    void assign(const tac_operand& opnd, uint32_t v) {
+        uint32_t s = values.slot(opnd);
+        if (stable[s]) {
+            slot_log.push_back(make_pair(s, slot_values[s]));
+            slot_values[s] = v;
+            set_leader(v, opnd);
+        } else {
+            local_values[s] = v;
+            local_times[s] = ++clock;
+        }
+    }
+
+    // Rewrites a temporary or variable operand to the constant or stable holder of its value
+    void substitute(tac_operand& opnd) {
+        if (values.scalar_slot(opnd) == no_slot) return;
+        const tac_operand& leader = leaders[value_of(opnd)];
+        if (!leader.is_none() && leader != opnd) {
+            opnd = leader;
+            replaced++;
+        }
+    }
+
+    static bool commutes(tac_opcode op) {
+        return op == OP_ADD || op == OP_MUL || op == OP_EQ || op == OP_NE || op == OP_AND || op == OP_OR
+            || op == OP_BITAND || op == OP_MULHI;
+    }
+
+    expr_key key_of(const tac_instr& in) {
+        expr_key key{in.op, value_of(in.src1), in.src2.is_none() ? no_value : value_of(in.src2)};
+        if (key.op == OP_GT || key.op == OP_GE) {
+            key.op = key.op == OP_GT ? OP_LT : OP_LE;
+            swap(key.a, key.b);
+        } else if (commutes(in.op) && key.a > key.b) {
+            swap(key.a, key.b);
+        }
+        return key;
+    }
+
+    void add_expr(const expr_key& key, uint32_t v) {
+        if (exprs.emplace(key, v).second) expr_log.push_back(key);
+    }
+
+    // A computation or load: reuse an earlier holder of the same value if there is one
+    void number(tac_instr& in) {
+        expr_key key = key_of(in);
+        uint32_t v;
+        auto found = exprs.find(key);
+        if (found != exprs.end()) {
+            v = found->second;
+            const tac_operand& leader = leaders[v];
+            if (!leader.is_none() && leader != in.dst
+                && values.type_of(leader) == values.type_of(in.dst) && values.type_of(leader) != TYPE_NONE) {
+                if (in.op == OP_LOAD) loads++;
+                else reused++;
+                in = tac_instr{OP_COPY, in.dst, leader, tac_operand()};
+            }
+        } else {
+            v = new_value();
+            add_expr(key, v);
+        }
+        // A variable of another type than the result holds a converted value
+        if (values.type_of(in.dst) != values.result_type(in) || values.type_of(in.dst) == TYPE_NONE) v = new_value();
+        assign(in.dst, v);
+    }
+
+    void visit(tac_function& func, const control_flow_graph& cfg, uint32_t b) {
+        block_start = last_call = ++clock;
+        for (uint32_t i = cfg.blocks[b].begin; i < cfg.blocks[b].end; i++) {
+            tac_instr& in = func.code[i];
+            switch (in.op) {
+                case OP_COPY: {
+                    substitute(in.src1);
+                    uint32_t v = value_of(in.src1);
+                    data_type type = values.type_of(in.dst);
+                    if (type != values.type_of(in.src1) || type == TYPE_NONE) v = new_value();
+                    assign(in.dst, v);
+                    break;
+                }
+                case OP_LOAD:
+                    substitute(in.src2);
+                    number(in);
+                    break;
+                case OP_STORE: {
+                    substitute(in.src1);
+                    substitute(in.src2);
+                    uint32_t array = new_value();
+                    assign(in.dst, array);
+                    if (values.type_of(in.dst) == values.type_of(in.src2)) {
+                        add_expr(expr_key{OP_LOAD, array, value_of(in.src1)}, value_of(in.src2));
+                    }
+                    break;
+                }
+                case OP_CALL:
+                    last_call = ++clock;
+                    if (!in.dst.is_none()) assign(in.dst, new_value());
+                    break;
+                case OP_PARAM:
+                case OP_RETURN:
+                case OP_PRINT:
+                    substitute(in.src1);
+                    break;
+                case OP_DECL:
+                case OP_LABEL:
+                case OP_GOTO:
+                    break;
+                default:
+                    substitute(in.src1);
+                    substitute(in.src2);
+                    if (!is_cond_branch(in.op)) number(in);
+                    break;
+            }
+        }
+    }
+
+    void undo(const frame& f) {
+        while (expr_log.size() > f.exprs) {
+            exprs.erase(expr_log.back());
+            expr_log.pop_back();
+        }
+        while (slot_log.size() > f.slots) {
+            slot_values[slot_log.back().first] = slot_log.back().second;
+            slot_log.pop_back();
+        }
+        while (leader_log.size() > f.leaders) {
+            leaders[leader_log.back()] = tac_operand();
+            leader_log.pop_back();
+        }
+    }
+
+    void start(const tac_function& func) {
+        values.build(func);
+        exprs.clear();
+        expr_log.clear();
+        leader_log.clear();
+        slot_log.clear();
+        leaders.clear();
+        next_value = 0;
+        const_values.assign(prog.constants.size(), no_value);
+        clock = block_start = last_call = 0;
+
+        // Temporaries and local scalars assigned at most once are stable; those never
+        // assigned (parameters, uninitialized locals) hold one value throughout
+        vector<uint32_t> defs(values.size(), 0);
+        for (const tac_instr& in : func.code) {
+            if (in.op == OP_STORE || in.op == OP_DECL) continue;
+            uint32_t s = values.slot(in.dst);
+            if (s != no_slot) defs[s]++;
+        }
+        stable.assign(values.size(), 0);
+        slot_values.assign(values.size(), no_value);
+        local_values.assign(values.size(), no_value);
+        local_times.assign(values.size(), 0);
+        for (uint32_t s = 0; s < values.size(); s++) {
+            stable[s] = defs[s] <= 1 && !values.is_global[s] && !values.is_array[s];
+            if (stable[s] && defs[s] == 0) {
+                slot_values[s] = new_value();
+                leaders[slot_values[s]] = values.operands[s];
+            }
+        }
+    }
+
+public:
+    size_t reused = 0;      // computations replaced by a copy of an earlier result
+    size_t loads = 0;       // array loads replaced likewise
+    size_t replaced = 0;    // operands rewritten to an earlier holder of their value
+
+    value_numbering(tac_program& prog) : prog(prog), values(prog) {}
+
+    void run(tac_function& func, const control_flow_graph& cfg) {
+        reused = loads = replaced = 0;
+        start(func);
+
+        vector<frame> stack;
+        stack.push_back(frame{0, cfg.blocks[0].child_begin, 0, 0, 0});
+        visit(func, cfg, 0);
+        while (!stack.empty()) {
+            frame& top = stack.back();
+            if (top.next_child < cfg.blocks[top.block].child_end) {
+                uint32_t child = cfg.dom_children[top.next_child++];
+                stack.push_back(frame{child, cfg.blocks[child].child_begin, expr_log.size(), slot_log.size(), leader_log.size()});
+                visit(func, cfg, child);
+            } else {
+                undo(top);
+                stack.pop_back();
+            }
+        }
+    }
+};
+
+#endif // VALUE_NUMBER_H
@@ -0,0 +1,560 @@
+#ifndef VM_H
+#define VM_H
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "ir.h"
+
+using namespace std;
+
+// Executes a tac_program. The program is first encoded into one flat instruction
+// array: labels and declarations disappear (jumps hold instruction indices), and each
+// operand becomes a 32-bit reference to a frame cell, a global cell or a constant,
+// or an index into the table of arrays. Every function has a frame of one cell per
+// temporary and scalar it uses, followed by its arrays at their declared sizes;
+// frames live on one value stack and are set to typed zeros on each call.
+//
+// Values carry their type. Arithmetic follows the source language: int operations
+// wrap around in 32 bits, an int meeting a float is converted, and a value written
+// to a variable, array element, parameter or return value takes its declared type.
+// Floats are single precision, as in constant folding.
+
+static const uint32_t no_ref = UINT32_MAX;
+
+struct vm_value
+{
+    union
+    {
+        int32_t i;
+        float f;
+    };
+    data_type type;
+
+    static vm_value of_int(int32_t v) { vm_value r; r.i = v; r.type = TYPE_INT; return r; }
+    static vm_value of_float(float v) { vm_value r; r.f = v; r.type = TYPE_FLOAT; return r; }
+};
+
+class tac_vm
+{
+private:
+    // Operand references: kind in the top two bits, index below
+    static const uint32_t ref_frame = 0u << 30;
+    static const uint32_t ref_global = 1u << 30;
+    static const uint32_t ref_const = 2u << 30;
+    static const uint32_t ref_index = (1u << 30) - 1;
+
+    static const size_t max_stack = 1 << 22;   // value cells for all frames
+    static const size_t max_depth = 1 << 18;   // nested calls
+
+    // One instruction: for jumps the target is an instruction index (in dst for
+    // branches, a for goto, as in the TAC); LOAD and STORE name their array by its
+    // index in arrays, CALL its function by its index in functions
+    struct vm_instr
+    {
+        tac_opcode op;
+        data_type convert;      // type the destination takes, TYPE_NONE for temporaries
+        uint32_t dst, a, b;
+    };
+
+    struct vm_array
+    {
+        uint32_t offset;        // first cell, in the frame or the globals
+        uint32_t size;
+        data_type type;
+        bool global;
+    };
+
+    struct vm_function
+    {
+        uint32_t name;
+        data_type return_type;
+        uint32_t entry;
+        uint32_t frame_begin, frame_size;   // typed zeros in initial_frames
+        vector<pair<uint32_t, data_type>> params; // frame cell (no_ref if unnamed) and type
+    };
+
+    struct vm_frame
+    {
+        uint32_t function, return_pc, base;
+        uint32_t dst;           // caller's destination for the result
+        data_type convert;
+    };
+
+    const tac_program& prog;
+    vector<vm_instr> code;
+    vector<vm_function> functions;
+    vector<vm_array> arrays;
+    vector<vm_value> constants;
+    vector<vm_value> globals;
+    vector<vm_value> initial_globals;
+    vector<vm_value> initial_frames;
+    vector<uint32_t> global_refs;       // by name id, cell or array index of a global, no_ref if none
+    vector<uint32_t> function_index;    // by name id, no_ref if not defined
+    vector<uint32_t> cells;             // by slot of the function being encoded, cell or array index
+
+    unique_ptr<vm_value[]> stack;
+    vm_value* bases[3];                 // by reference kind: current frame, globals, constants
+    vector<vm_frame> calls;
+    vector<vm_value> args;
+
+    static vm_value zero(data_type type) {
+        return type == TYPE_FLOAT ? vm_value::of_float(0) : vm_value::of_int(0);
+    }
+
+    // Float to int as the hardware truncates, INT_MIN when out of range
+    static int32_t to_int(float f) {
+        if (!(f > (float)INT_MIN - 1 && f < (float)INT_MAX)) return INT_MIN;
+        return (int32_t)f;
+    }
+
+    static vm_value convert(const vm_value& v, data_type type) {
+        if (type == TYPE_INT && v.type == TYPE_FLOAT) return vm_value::of_int(to_int(v.f));
+        if (type == TYPE_FLOAT && v.type == TYPE_INT) return vm_value::of_float((float)v.i);
+        return v;
+    }
+
+    static bool is_true(const vm_value& v) {
+        return v.type == TYPE_FLOAT ? v.f != 0 : v.i != 0;
+    }
+
+    static bool both_int(const vm_value& x, const vm_value& y) {
+        return x.type != TYPE_FLOAT && y.type != TYPE_FLOAT;
+    }
+
+    static float as_float(const vm_value& v) {
+        return v.type == TYPE_FLOAT ? v.f : (float)v.i;
+    }
+
+    static double as_double(const vm_value& v) {
+        return v.type == TYPE_FLOAT ? (double)v.f : (double)v.i;
+    }
+
+    // Encoding
+
+    void add_global(const tac_instr& decl) {
+        data_type type = (data_type)decl.src1.id;
+        uint32_t size = decl.src2.id;
+        if (global_refs[decl.dst.id] != no_ref) return;
+        if (size == 0) {
+            global_refs[decl.dst.id] = initial_globals.size();
+            initial_globals.push_back(zero(type));
+        } else {
+            global_refs[decl.dst.id] = arrays.size();
+            arrays.push_back(vm_array{(uint32_t)initial_globals.size(), size, type, true});
+            initial_globals.resize(initial_globals.size() + size, zero(type));
+        }
+    }
+
+    // Frame cells for the function's temporaries and scalars, then its arrays
+    void lay_out(const tac_function& func, const tac_values& values, vm_function& f) {
+        // Declared sizes of the function's arrays, the first declaration wins
+        vector<uint32_t> array_size(values.size(), 0);
+        for (const tac_instr& in : func.code) {
+            if (in.op != OP_DECL) continue;
+            uint32_t s = values.slot(in.dst);
+            if (array_size[s] == 0) array_size[s] = in.src2.id;
+        }
+
+        cells.assign(values.size(), no_ref);
+        f.frame_begin = initial_frames.size();
+        uint32_t size = 0;
+        for (uint32_t s = 0; s < values.size(); s++) {
+            if (values.is_global[s] || values.is_array[s]) continue;
+            cells[s] = size++;
+            initial_frames.push_back(zero(values.operands[s].kind == OPND_VAR ? values.types[s] : TYPE_INT));
+        }
+        for (uint32_t s = 0; s < values.size(); s++) {
+            if (values.is_global[s]) {
+                cells[s] = global_refs[values.operands[s].id];
+            } else if (values.is_array[s]) {
+                cells[s] = arrays.size();
+                arrays.push_back(vm_array{size, array_size[s], values.types[s], false});
+                size += array_size[s];
+                initial_frames.resize(initial_frames.size() + array_size[s], zero(values.types[s]));
+            }
+        }
+        f.frame_size = size;
+    }
+
+    uint32_t encode(const tac_operand& opnd, const tac_values& values) const {
+        switch (opnd.kind) {
+            case OPND_CONST: return ref_const | opnd.id;
+            case OPND_TEMP:
+            case OPND_VAR: {
+                uint32_t s = values.slot(opnd);
+                if (values.is_array[s]) return cells[s];
+                return (values.is_global[s] ? ref_global : ref_frame) | cells[s];
+            }
+            default: return no_ref;
+        }
+    }
+
+    // Type a scalar destination converts values to
+    static data_type declared_type(const tac_operand& opnd, const tac_values& values) {
+        uint32_t s = values.slot(opnd);
+        return opnd.kind == OPND_VAR && s != no_slot ? values.types[s] : TYPE_NONE;
+    }
+
+    void encode_function(const tac_function& func, tac_values& values, vector<uint32_t>& label_target,
+                         vector<pair<uint32_t, uint32_t>>& jumps) {
+        values.build(func);
+        vm_function f;
+        f.name = func.name;
+        f.return_type = func.return_type;
+        f.entry = code.size();
+        lay_out(func, values, f);
+        for (const auto& param : func.params) {
+            uint32_t s = param.second == name_table::none ? no_slot : values.slot(tac_operand(OPND_VAR, param.second));
+            f.params.push_back(make_pair(s == no_slot ? no_ref : cells[s], param.first));
+        }
+        functions.push_back(f);
+
+        for (const tac_instr& in : func.code) {
+            if (in.op == OP_DECL) continue;
+            if (in.op == OP_LABEL) {
+                label_target[in.src1.id] = code.size();
+                continue;
+            }
+            vm_instr out{in.op, TYPE_NONE, no_ref, no_ref, no_ref};
+            switch (in.op) {
+                case OP_GOTO:
+                    jumps.push_back(make_pair(code.size(), in.src1.id));
+                    break;
+                case OP_LOAD:
+                    out.dst = encode(in.dst, values);
+                    out.convert = declared_type(in.dst, values);
+                    out.a = cells[values.slot(in.src1)];
+                    out.b = encode(in.src2, values);
+                    break;
+                case OP_STORE:
+                    out.dst = cells[values.slot(in.dst)];
+                    out.convert = arrays[out.dst].type;
+                    out.a = encode(in.src1, values);
+                    out.b = encode(in.src2, values);
+                    break;
+                case OP_CALL:
+                    out.dst = encode(in.dst, values);
+                    out.convert = declared_type(in.dst, values);
+                    out.a = in.src1.id;     // name until every function has its index
+                    out.b = in.src2.id;
+                    break;
+                default:
+                    if (is_cond_branch(in.op)) jumps.push_back(make_pair(code.size(), in.dst.id));
+                    else out.dst = encode(in.dst, values);
+                    out.convert = is_cond_branch(in.op) ? TYPE_NONE : declared_type(in.dst, values);
+                    out.a = encode(in.src1, values);
+                    out.b = encode(in.src2, values);
+                    break;
+            }
+            code.push_back(out);
+        }
+        // Falling off the end returns
+        code.push_back(vm_instr{OP_RETURN, TYPE_NONE, no_ref, no_ref, no_ref});
+    }
+
+    void encode_program() {
+        global_refs.assign(names.size(), no_ref);
+        function_index.assign(names.size(), no_ref);
+        for (const tac_global& g : prog.globals) add_global(g.decl);
+        for (const tac_constant& c : prog.constants) {
+            constants.push_back(c.type == TYPE_INT ? vm_value::of_int((int32_t)c.int_value) : vm_value::of_float((float)c.float_value));
+        }
+
+        tac_values values(prog);
+        vector<uint32_t> label_target(prog.num_labels, no_ref);
+        vector<pair<uint32_t, uint32_t>> jumps;     // instruction and the label it jumps to
+        for (const tac_function& func : prog.functions) {
+            if (function_index[func.name] == no_ref) function_index[func.name] = functions.size();
+            encode_function(func, values, label_target, jumps);
+        }
+        for (const pair<uint32_t, uint32_t>& jump : jumps) {
+            vm_instr& in = code[jump.first];
+            (in.op == OP_GOTO ? in.a : in.dst) = label_target[jump.second];
+        }
+        for (vm_instr& in : code) {
+            if (in.op == OP_CALL) in.a = function_index[in.a];
+        }
+    }
+
+    // Execution
+
+    const vm_value& read(uint32_t ref) const {
+        return bases[ref >> 30][ref & ref_index];
+    }
+
+    void write(uint32_t ref, const vm_value& v, data_type type) {
+        vm_value& cell = bases[ref >> 30][ref & ref_index];
+        cell = type == TYPE_NONE ? v : convert(v, type);
+    }
+
+    vm_value* array_cells(const vm_array& array) {
+        return (array.global ? globals.data() : bases[0]) + array.offset;
+    }
+
+    bool fail(const string& message) {
+        error = "Runtime error in " + names.get_name(functions[calls.back().function].name) + ": " + message;
+        return false;
+    }
+
+    // Sets up a frame for function f and passes it the last count arguments
+    bool enter(uint32_t f, uint32_t count, uint32_t return_pc, uint32_t dst, data_type type, uint32_t& pc) {
+        const vm_function& callee = functions[f];
+        uint32_t base = calls.empty() ? 0 : calls.back().base + functions[calls.back().function].frame_size;
+        bool overflow = calls.size() >= max_depth || base + callee.frame_size > max_stack;
+        calls.push_back(vm_frame{f, return_pc, base, dst, type});
+        if (overflow) return fail("call stack overflow");
+        bases[0] = stack.get() + base;
+        copy(initial_frames.begin() + callee.frame_begin, initial_frames.begin() + callee.frame_begin + callee.frame_size, bases[0]);
+        size_t first = args.size() - count;
+        for (uint32_t k = 0; k < count && k < callee.params.size(); k++) {
+            if (callee.params[k].first != no_ref) bases[0][callee.params[k].first] = convert(args[first + k], callee.params[k].second);
+        }
+        args.resize(first);
+        pc = callee.entry;
+        calls_made++;
+        return true;
+    }
+
+    static bool compare(tac_opcode relation, const vm_value& x, const vm_value& y) {
+        if (both_int(x, y)) {
+            switch (relation) {
+                case OP_LT: return x.i < y.i;
+                case OP_LE: return x.i <= y.i;
+                case OP_GT: return x.i > y.i;
+                case OP_GE: return x.i >= y.i;
+                case OP_EQ: return x.i == y.i;
+                default: return x.i != y.i;
+            }
+        }
+        double a = as_double(x), b = as_double(y);
+        switch (relation) {
+            case OP_LT: return a < b;
+            case OP_LE: return a <= b;
+            case OP_GT: return a > b;
+            case OP_GE: return a >= b;
+            case OP_EQ: return a == b;
+            default: return a != b;
+        }
+    }
+
+    bool binary(tac_opcode op, const vm_value& x, const vm_value& y, vm_value& r) {
+        if (is_relation(op)) {
+            r = vm_value::of_int(compare(op, x, y));
+            return true;
+        }
+        if (op == OP_AND || op == OP_OR) {
+            r = vm_value::of_int(op == OP_AND ? is_true(x) && is_true(y) : is_true(x) || is_true(y));
+            return true;
+        }
+
+        if (both_int(x, y)) {
+            uint32_t a = x.i, b = y.i;
+            switch (op) {
+                case OP_ADD: r = vm_value::of_int(a + b); return true;
+                case OP_SUB: r = vm_value::of_int(a - b); return true;
+                case OP_MUL: r = vm_value::of_int(a * b); return true;
+                case OP_DIV:
+                case OP_MOD:
+                    if (y.i == 0) return fail("division by zero");
+                    if (x.i == INT_MIN && y.i == -1) r = vm_value::of_int(op == OP_DIV ? INT_MIN : 0);
+                    else r = vm_value::of_int(op == OP_DIV ? x.i / y.i : x.i % y.i);
+                    return true;
+                case OP_SHL: r = vm_value::of_int(a << (b & 31)); return true;
+                case OP_SHR: r = vm_value::of_int(x.i >> (b & 31)); return true;
+                case OP_BITAND: r = vm_value::of_int(a & b); return true;
+                case OP_MULHI: r = vm_value::of_int((int32_t)(((int64_t)x.i * y.i) >> 32)); return true;
+                default: return fail("bad operator");
+            }
+        }
+
+        float a = as_float(x), b = as_float(y);
+        switch (op) {
+            case OP_ADD: r = vm_value::of_float(a + b); return true;
+            case OP_SUB: r = vm_value::of_float(a - b); return true;
+            case OP_MUL: r = vm_value::of_float(a * b); return true;
+            case OP_DIV: r = vm_value::of_float(a / b); return true;
+            case OP_MOD: r = vm_value::of_float(fmodf(a, b)); return true;
+            default: return fail("int operator on a float");
+        }
+    }
+
+    bool array_index(const vm_array& array, const vm_value& index, uint32_t& i) {
+        int32_t k = index.type == TYPE_FLOAT ? to_int(index.f) : index.i;
+        if (k < 0 || (uint32_t)k >= array.size) {
+            return fail("index " + to_string(k) + " out of bounds for an array of " + to_string(array.size));
+        }
+        i = k;
+        return true;
+    }
+
+    bool execute(ostream& out, uint32_t pc) {
+        for (;;) {
+            const vm_instr& in = code[pc++];
+            executed++;
+            switch (in.op) {
+                case OP_COPY:
+                    write(in.dst, read(in.a), in.convert);
+                    break;
+                case OP_NEG: {
+                    const vm_value& x = read(in.a);
+                    write(in.dst, x.type == TYPE_FLOAT ? vm_value::of_float(-x.f) : vm_value::of_int(0u - (uint32_t)x.i), in.convert);
+                    break;
+                }
+                case OP_POS:
+                    write(in.dst, read(in.a), in.convert);
+                    break;
+                case OP_NOT:
+                    write(in.dst, vm_value::of_int(!is_true(read(in.a))), in.convert);
+                    break;
+                case OP_LOAD: {
+                    const vm_array& array = arrays[in.a];
+                    uint32_t i;
+                    if (!array_index(array, read(in.b), i)) return false;
+                    write(in.dst, array_cells(array)[i], in.convert);
+                    break;
+                }
+                case OP_STORE: {
+                    const vm_array& array = arrays[in.dst];
+                    uint32_t i;
+                    if (!array_index(array, read(in.a), i)) return false;
+                    array_cells(array)[i] = convert(read(in.b), in.convert);
+                    break;
+                }
+                case OP_GOTO:
+                    pc = in.a;
+                    break;
+                case OP_IF:
+                case OP_IFFALSE:
+                    if (is_true(read(in.a)) == (in.op == OP_IF)) pc = in.dst;
+                    break;
+                case OP_PARAM:
+                    args.push_back(read(in.a));
+                    break;
+                case OP_CALL:
+                    if (in.a == no_ref) return fail("call to a function without a definition");
+                    if (!enter(in.a, in.b, pc, in.dst, in.convert, pc)) return false;
+                    break;
+                case OP_RETURN: {
+                    vm_frame done = calls.back();
+                    const vm_function& f = functions[done.function];
+                    vm_value result = in.a == no_ref ? zero(f.return_type) : convert(read(in.a), f.return_type);
+                    calls.pop_back();
+                    if (calls.empty()) {
+                        exit_value = result;
+                        return true;
+                    }
+                    bases[0] = stack.get() + calls.back().base;
+                    pc = done.return_pc;
+                    if (done.dst != no_ref) write(done.dst, result, done.convert);
+                    break;
+                }
+                case OP_PRINT: {
+                    const vm_value& x = read(in.a);
+                    if (x.type == TYPE_FLOAT) out << x.f << '\n';
+                    else out << x.i << '\n';
+                    break;
+                }
+
+                // Common int operations are done here, everything else in binary()
+                case OP_ADD: {
+                    const vm_value& x = read(in.a);
+                    const vm_value& y = read(in.b);
+                    if (both_int(x, y)) write(in.dst, vm_value::of_int((uint32_t)x.i + (uint32_t)y.i), in.convert);
+                    else write(in.dst, vm_value::of_float(as_float(x) + as_float(y)), in.convert);
+                    break;
+                }
+                case OP_SUB: {
+                    const vm_value& x = read(in.a);
+                    const vm_value& y = read(in.b);
+                    if (both_int(x, y)) write(in.dst, vm_value::of_int((uint32_t)x.i - (uint32_t)y.i), in.convert);
+                    else write(in.dst, vm_value::of_float(as_float(x) - as_float(y)), in.convert);
+                    break;
+                }
+                case OP_MUL: {
+                    const vm_value& x = read(in.a);
+                    const vm_value& y = read(in.b);
+                    if (both_int(x, y)) write(in.dst, vm_value::of_int((uint32_t)x.i * (uint32_t)y.i), in.convert);
+                    else write(in.dst, vm_value::of_float(as_float(x) * as_float(y)), in.convert);
+                    break;
+                }
+                case OP_SHL: write(in.dst, vm_value::of_int((uint32_t)read(in.a).i << (read(in.b).i & 31)), in.convert); break;
+                case OP_SHR: write(in.dst, vm_value::of_int(read(in.a).i >> (read(in.b).i & 31)), in.convert); break;
+                case OP_BITAND: write(in.dst, vm_value::of_int(read(in.a).i & read(in.b).i), in.convert); break;
+                case OP_MULHI:
+                    write(in.dst, vm_value::of_int((int32_t)(((int64_t)read(in.a).i * read(in.b).i) >> 32)), in.convert);
+                    break;
+                case OP_LT: write(in.dst, vm_value::of_int(compare(OP_LT, read(in.a), read(in.b))), in.convert); break;
+                case OP_LE: write(in.dst, vm_value::of_int(compare(OP_LE, read(in.a), read(in.b))), in.convert); break;
+                case OP_GT: write(in.dst, vm_value::of_int(compare(OP_GT, read(in.a), read(in.b))), in.convert); break;
+                case OP_GE: write(in.dst, vm_value::of_int(compare(OP_GE, read(in.a), read(in.b))), in.convert); break;
+                case OP_EQ: write(in.dst, vm_value::of_int(compare(OP_EQ, read(in.a), read(in.b))), in.convert); break;
+                case OP_NE: write(in.dst, vm_value::of_int(compare(OP_NE, read(in.a), read(in.b))), in.convert); break;
+                case OP_IF_LT: if (compare(OP_LT, read(in.a), read(in.b))) pc = in.dst; break;
+                case OP_IF_LE: if (compare(OP_LE, read(in.a), read(in.b))) pc = in.dst; break;
+                case OP_IF_GT: if (compare(OP_GT, read(in.a), read(in.b))) pc = in.dst; break;
+                case OP_IF_GE: if (compare(OP_GE, read(in.a), read(in.b))) pc = in.dst; break;
+                case OP_IF_EQ: if (compare(OP_EQ, read(in.a), read(in.b))) pc = in.dst; break;
+                case OP_IF_NE: if (compare(OP_NE, read(in.a), read(in.b))) pc = in.dst; break;
+                case OP_IFFALSE_LT: if (!compare(OP_LT, read(in.a), read(in.b))) pc = in.dst; break;
+                case OP_IFFALSE_LE: if (!compare(OP_LE, read(in.a), read(in.b))) pc = in.dst; break;
+                case OP_IFFALSE_GT: if (!compare(OP_GT, read(in.a), read(in.b))) pc = in.dst; break;
+                case OP_IFFALSE_GE: if (!compare(OP_GE, read(in.a), read(in.b))) pc = in.dst; break;
+                case OP_IFFALSE_EQ: if (!compare(OP_EQ, read(in.a), read(in.b))) pc = in.dst; break;
+                case OP_IFFALSE_NE: if (!compare(OP_NE, read(in.a), read(in.b))) pc = in.dst; break;
+                default: {
+                    vm_value r;
+                    if (!binary(in.op, read(in.a), read(in.b), r)) return false;
+                    write(in.dst, r, in.convert);
+                    break;
+                }
+            }
+        }
+    }
+
+public:
+    string error;               // what stopped the program, empty if it returned
+    vm_value exit_value;        // what main returned
+    size_t executed = 0;        // instructions executed, without labels and declarations
+    size_t calls_made = 0;      // function calls, main included
+
+    tac_vm(const tac_program& prog) : prog(prog) {
+        encode_program();
+    }
+
+    // Runs main, writing what the program prints to out; false on a runtime error
+    bool run(ostream& out) {
+        error.clear();
+        executed = calls_made = 0;
+        exit_value = vm_value::of_int(0);
+        uint32_t main_index = no_ref;
+        for (uint32_t f = 0; f < functions.size() && main_index == no_ref; f++) {
+            if (names.get_name(functions[f].name) == "main") main_index = f;
+        }
+        if (main_index == no_ref) {
+            error = "Runtime error: no main function";
+            return false;
+        }
+
+        // Globals start at zero on every run
+        globals = initial_globals;
+        bases[1] = globals.data();
+        bases[2] = constants.data();
+        stack.reset(new vm_value[max_stack]);
+        calls.clear();
+        args.clear();
+        uint32_t pc;
+        if (!enter(main_index, 0, 0, no_ref, TYPE_NONE, pc)) return false;
+        bool returned = execute(out, pc);
+        out.flush();
+        return returned;
+    }
+};
+
+#endif // VM_H
@@ -0,0 +1,7 @@
+int main() {
+  int a, b, x;
+  a = 0; b = 5;
+  x = a != 0 && b / a > 1;
+  printf(x);
+  return x;
+}
@@ -0,0 +1,8 @@
+int main() {
+  int i, x;
+  int f[10];
+  i = 10;
+  x = i < 10 && f[i] > 0;
+  printf(x);
+  return x;
+}
@@ -0,0 +1,9 @@
+int main() {
+  int i;
+  i = 5;
+  {
+    int i;
+    i = 0;
+  }
+  return i;
+}